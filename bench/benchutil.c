@@ -0,0 +1,183 @@
+/**
+ * @file benchutil.c
+ * @brief Shared Helpers of the Benchmark Programs
+ *
+ * This file implements the clock, setup and list generators shared by
+ * the programs in bench/, and the console size query the models call
+ * when the user interface is not linked.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // For clock_gettime
+#endif
+
+// Standard C library includes
+#include <stdio.h>      // For snprintf and remove
+#include <stdlib.h>     // For memory allocation and atoi
+#include <string.h>     // For strncpy
+#include <time.h>       // For clock_gettime
+#ifdef _WIN32
+#include <windows.h>    // For QueryPerformanceCounter and GetSystemInfo
+#else
+#include <unistd.h>     // For sysconf
+#endif
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers header
+#include "../include/headers/apctxt.h"          // For the configuration
+#include "../include/headers/interface.h"       // For getConsoleSize()
+#include "../include/models/employee.h"         // Generated employees
+#include "../include/models/student.h"          // Generated students
+#include "../src/modules/payroll.h"             // For setPayrollWarnings()
+
+/**
+ * @brief Returns a monotonic time in seconds.
+ * @return The current time in seconds.
+ */
+double benchClock(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+#endif
+}
+
+/**
+ * @brief Prepares the configuration and data directory for a benchmark.
+ */
+void benchSetup(void) {
+    setDefaultConfig();
+    setPayrollWarnings(false);
+    appCreateDirectory("data");
+}
+
+/**
+ * @brief Returns the number of processors the benchmark can run on.
+ * @return The number of online processors, at least 1.
+ */
+int benchProcessorCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (info.dwNumberOfProcessors > 0) ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (int)count : 1;
+#endif
+}
+
+/**
+ * @brief Reads the record count of a benchmark from its arguments.
+ * @param argc The argument count passed to main().
+ * @param argv The arguments passed to main().
+ * @param fallback The count used when no argument is given.
+ * @return The record count, at least 1.
+ */
+int benchRecordCount(int argc, char* argv[], int fallback) {
+    int count = (argc > 1) ? atoi(argv[1]) : fallback;
+    return (count > 0) ? count : 1;
+}
+
+/**
+ * @brief Formats the record number of generated record i.
+ * @param buffer The buffer receiving the key.
+ * @param size The size of the buffer.
+ * @param index The position of the record in the generated list.
+ */
+void benchRecordKey(char* buffer, size_t size, int index) {
+    snprintf(buffer, size, "%010d", index);
+}
+
+/**
+ * @brief Builds a list of synthetic employees.
+ * @param listType The list implementation to build.
+ * @param count The number of employees.
+ * @return The list, or NULL on memory allocation failure.
+ */
+list* benchEmployeeList(ListType listType, int count) {
+    list* employeeList = NULL;
+    if (createEmployeeListOfType(&employeeList, listType) != 0) {
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        Employee* employee = calloc(1, sizeof(Employee));
+        if (employee == NULL) {
+            destroyList(&employeeList, freeEmployee);
+            return NULL;
+        }
+        benchRecordKey(employee->personal.employeeNumber, employeeNumberLen, i);
+        snprintf(employee->personal.name.lastName, sizeof(employee->personal.name.lastName), "Last%d", i % 997);
+        snprintf(employee->personal.name.firstName, sizeof(employee->personal.name.firstName), "First%d", i % 113);
+        employee->employment.status = (i % 3 == 0) ? statusCasual : statusRegular;
+        employee->employment.hoursWorked = i % 200;
+        employee->employment.basicRate = 100.0f + (float)(i % 50);
+        addNode(&employeeList, employee);
+    }
+    return employeeList;
+}
+
+/**
+ * @brief Builds a list of synthetic students.
+ * @param listType The list implementation to build.
+ * @param count The number of students.
+ * @return The list, or NULL on memory allocation failure.
+ */
+list* benchStudentList(ListType listType, int count) {
+    list* studentList = NULL;
+    if (createStudentListOfType(&studentList, listType) != 0) {
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        Student* student = calloc(1, sizeof(Student));
+        if (student == NULL) {
+            destroyList(&studentList, freeStudent);
+            return NULL;
+        }
+        benchRecordKey(student->personal.studentNumber, studentNumberLen, i);
+        snprintf(student->personal.name.lastName, sizeof(student->personal.name.lastName), "Last%d", i % 997);
+        snprintf(student->personal.name.firstName, sizeof(student->personal.name.firstName), "First%d", i % 113);
+        strncpy(student->personal.programCode, "IT", programCodeLen - 1);
+        student->academic.unitsEnrolled = 21;
+        student->academic.prelimGrade = (float)(i % 101);
+        student->academic.midtermGrade = (float)((i * 7) % 101);
+        student->academic.finalExamGrade = (float)((i * 13) % 101);
+        student->academic.finalGrade = (student->academic.prelimGrade + student->academic.midtermGrade +
+                                        student->academic.finalExamGrade) / 3.0f;
+        strncpy(student->academic.remarks, (student->academic.finalGrade >= 75.0f) ? "Passed" : "Failed",
+                studentRemarksLen - 1);
+        addNode(&studentList, student);
+    }
+    return studentList;
+}
+
+/**
+ * @brief Removes a benchmark data file and its journal.
+ * @param fileName The file name inside the data directory.
+ */
+void benchRemoveFile(const char* fileName) {
+    char path[256];
+    snprintf(path, sizeof(path), "data/%s", fileName);
+    remove(path);
+    snprintf(path, sizeof(path), "data/%s.jnl", fileName);
+    remove(path);
+}
+
+/**
+ * @brief Reports a fixed console size; the benchmarks never draw.
+ * @param width Receives the console width.
+ * @param height Receives the console height.
+ */
+void getConsoleSize(int* width, int* height) {
+    *width = 80;
+    *height = 25;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file benchutil.h
+ * @brief Shared Helpers of the Benchmark Programs
+ *
+ * This header declares the small helpers every benchmark in bench/
+ * shares: a monotonic clock, the setup that puts the configuration in a
+ * known state and the generators of synthetic employee and student
+ * lists. The benchmarks link the data layer and the models but not the
+ * user interface, so benchutil.c also stands in for the one interface
+ * function the models call.
+ *
+ * Benchmarks write their files to data/bench_*.dat and remove them again
+ * when they finish.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+// Application-specific includes
+#include "../include/headers/list.h"    // Generated lists
+
+/**
+ * @brief Returns a monotonic time in seconds.
+ *
+ * Only differences between two calls are meaningful.
+ *
+ * @return The current time in seconds.
+ */
+double benchClock(void);
+
+/**
+ * @brief Prepares the configuration and data directory for a benchmark.
+ *
+ * Loads the default configuration, turns off the per-employee payroll
+ * warnings and makes sure the data directory exists.
+ */
+void benchSetup(void);
+
+/**
+ * @brief Returns the number of processors the benchmark can run on.
+ *
+ * Printed next to thread scaling results, which mean little on a
+ * machine with fewer processors than threads.
+ *
+ * @return The number of online processors, at least 1.
+ */
+int benchProcessorCount(void);
+
+/**
+ * @brief Reads the record count of a benchmark from its arguments.
+ * @param argc The argument count passed to main().
+ * @param argv The arguments passed to main().
+ * @param fallback The count used when no argument is given.
+ * @return The record count, at least 1.
+ */
+int benchRecordCount(int argc, char* argv[], int fallback);
+
+/**
+ * @brief Builds a list of synthetic employees.
+ *
+ * Employee numbers are the zero-padded record positions, so record i can
+ * be looked up with the key printed by benchRecordKey().
+ *
+ * @param listType The list implementation to build.
+ * @param count The number of employees.
+ * @return The list, or NULL on memory allocation failure.
+ */
+list* benchEmployeeList(ListType listType, int count);
+
+/**
+ * @brief Builds a list of synthetic students.
+ *
+ * Student numbers are the zero-padded record positions and grades are
+ * spread over the whole 0-100 range.
+ *
+ * @param listType The list implementation to build.
+ * @param count The number of students.
+ * @return The list, or NULL on memory allocation failure.
+ */
+list* benchStudentList(ListType listType, int count);
+
+/**
+ * @brief Formats the record number of generated record i.
+ * @param buffer The buffer receiving the key (at least 16 bytes).
+ * @param size The size of the buffer.
+ * @param index The position of the record in the generated list.
+ */
+void benchRecordKey(char* buffer, size_t size, int index);
+
+/**
+ * @brief Removes a benchmark data file and its journal.
+ * @param fileName The file name inside the data directory.
+ */
+void benchRemoveFile(const char* fileName);
+
+#endif // BENCHUTIL_H
@@ -0,0 +1,179 @@
+/**
+ * @file columnar_bench.c
+ * @brief Benchmark of Columnar Grade Summaries
+ *
+ * Saves a large student list as rows with journaling on, converts the
+ * file with saveStudentColumnDataFromFile(), and saves an edited list
+ * to it again with saveStudentDataFromFile(), which must keep it
+ * columnar and leave no journal behind. The grade summary of the file
+ * is then computed twice: by summarizeStudentColumnFile(), which reads
+ * only the exam grade columns, and from a full load of the file. Both
+ * must agree with the list in memory.
+ *
+ * Usage: columnar_bench [records]   (default 200000)
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For printf and fopen
+#include <string.h>     // For strcmp
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers
+#include "../include/headers/apctxt.h"          // For g_config and getPassingGrade()
+#include "../include/headers/delta.h"           // For untrackDataFile()
+#include "../include/headers/journal.h"         // For getJournalPath()
+#include "../include/models/student.h"          // Student records
+#include "../src/modules/columnar.h"            // Columnar student files
+#include "../src/modules/data.h"                // For saving and loading lists
+
+#define benchFileName "bench_columnar.dat"  // File the benchmark writes
+#define benchRepeats 5                      // Timed runs of each summary
+
+/**
+ * @brief Computes the grade summary of a list the way summarizeStudentColumnFile() does.
+ * @param studentList The student list.
+ * @param summary Receives the statistics.
+ */
+static void summarizeList(const list* studentList, StudentGradeSummary* summary) {
+    memset(summary, 0, sizeof(*summary));
+    float passingGrade = getPassingGrade();
+    double total = 0.0;
+    node* current = studentList->head;
+    for (int i = 0; i < studentList->size; i++, current = current->next) {
+        const Student* student = (const Student*)current->data;
+        float finalGrade = (student->academic.prelimGrade + student->academic.midtermGrade +
+                            student->academic.finalExamGrade) / 3.0f;
+        total += finalGrade;
+        if (finalGrade >= passingGrade) {
+            summary->passedCount++;
+        } else {
+            summary->failedCount++;
+        }
+        if (finalGrade >= 90.0f) {
+            summary->deansListCount++;
+        }
+    }
+    summary->count = studentList->size;
+    summary->averageGrade = (studentList->size > 0) ? total / studentList->size : 0.0;
+}
+
+/**
+ * @brief Checks a summary against the one of the list in memory.
+ * @param name What produced the summary.
+ * @param summary The summary to check.
+ * @param expected The summary of the list in memory.
+ * @param failures Incremented if the summaries differ.
+ */
+static void checkSummary(const char* name, const StudentGradeSummary* summary, const StudentGradeSummary* expected,
+                         int* failures) {
+    if (summary->count != expected->count || summary->passedCount != expected->passedCount ||
+        summary->failedCount != expected->failedCount || summary->deansListCount != expected->deansListCount ||
+        summary->averageGrade != expected->averageGrade) {
+        printf("  %s: %d students, average %.4f, %d passed; expected %d, %.4f, %d\n", name, summary->count,
+               summary->averageGrade, summary->passedCount, expected->count, expected->averageGrade,
+               expected->passedCount);
+        (*failures)++;
+    }
+}
+
+/**
+ * @brief Checks that the benchmark file is columnar and has no journal.
+ * @param step The save that was just made.
+ * @param failures Incremented for every check that fails.
+ */
+static void checkFormat(const char* step, int* failures) {
+    if (!isStudentColumnFile(benchFileName)) {
+        printf("  after %s: the file is not columnar\n", step);
+        (*failures)++;
+    }
+    char logPath[300];
+    getJournalPath("data/" benchFileName, logPath, sizeof(logPath));
+    FILE* log = fopen(logPath, "rb");
+    if (log) {
+        fclose(log);
+        printf("  after %s: a journal was left behind\n", step);
+        (*failures)++;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int count = benchRecordCount(argc, argv, 200000);
+    int failures = 0;
+    benchSetup();
+    g_config.journalSaves = 1; // The row save attaches a journal that the conversion must drop
+    benchRemoveFile(benchFileName);
+
+    list* studentList = benchStudentList(DYNAMIC_ARRAY, count);
+    if (studentList == NULL || saveStudentDataFromFile(studentList, benchFileName) != count) {
+        printf("Could not write the row file\n");
+        return 1;
+    }
+    double start = benchClock();
+    int saved = saveStudentColumnDataFromFile(studentList, benchFileName);
+    double convert = (benchClock() - start) * 1e3;
+    if (saved != count) {
+        printf("  conversion saved %d records, expected %d\n", saved, count);
+        failures++;
+    }
+    checkFormat("the conversion", &failures);
+
+    // An ordinary save of the edited list keeps the file columnar
+    char key[16];
+    benchRecordKey(key, sizeof(key), count / 2);
+    Student* student = searchStudentByNumber(studentList, key);
+    if (student) {
+        Student newData = *student;
+        newData.academic.prelimGrade = 99.0f;
+        newData.academic.midtermGrade = 98.0f;
+        newData.academic.finalExamGrade = 97.0f;
+        editStudentInList(studentList, key, &newData);
+    }
+    if (saveStudentDataFromFile(studentList, benchFileName) != count) {
+        printf("  save of the edited list failed\n");
+        failures++;
+    }
+    checkFormat("saving the edited list", &failures);
+
+    StudentGradeSummary expected;
+    StudentGradeSummary summary;
+    summarizeList(studentList, &expected);
+
+    double projection = 0.0;
+    for (int i = 0; i < benchRepeats; i++) {
+        start = benchClock();
+        if (summarizeStudentColumnFile(benchFileName, &summary) != 0) {
+            summary.count = -1;
+        }
+        projection += (benchClock() - start) * 1e3;
+    }
+    checkSummary("grade columns", &summary, &expected, &failures);
+
+    double fullLoad = 0.0;
+    for (int i = 0; i < benchRepeats; i++) {
+        start = benchClock();
+        list* loaded = loadStudentDataFromFile(benchFileName, DYNAMIC_ARRAY);
+        if (loaded) {
+            summarizeList(loaded, &summary);
+            untrackDataFile(loaded);
+            destroyList(&loaded, freeStudent);
+        } else {
+            summary.count = -1;
+        }
+        fullLoad += (benchClock() - start) * 1e3;
+    }
+    checkSummary("full load", &summary, &expected, &failures);
+
+    printf("Grade summary of %d students (%zu byte records) in a columnar file\n", count, sizeof(Student));
+    printf("  convert the row file:           %8.1f ms\n", convert);
+    printf("  summary from grade columns:     %8.1f ms\n", projection / benchRepeats);
+    printf("  summary from a full load:       %8.1f ms\n", fullLoad / benchRepeats);
+
+    destroyList(&studentList, freeStudent);
+    benchRemoveFile(benchFileName);
+    printf("%s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
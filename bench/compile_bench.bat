@@ -0,0 +1,60 @@
+@echo off
+echo Compiling PUP Information Management System benchmarks...
+
+:: Create bin directory if it doesn't exist
+if not exist bin mkdir bin
+
+:: Every benchmark links the data layer and the models, but not the user interface
+set BENCH_SOURCES=bench/benchutil.c ^
+    src/modules/data.c ^
+    src/modules/payroll.c ^
+    src/modules/extsort.c ^
+    src/modules/columnar.c ^
+    src/modules/manifest.c ^
+    include/models/employee.c ^
+    include/models/student.c ^
+    include/models/course.c ^
+    include/src/apctxt.c ^
+    include/src/lismgr.c ^
+    include/src/lisops.c ^
+    include/src/lissrt.c ^
+    include/src/lispar.c ^
+    include/src/lisrdx.c ^
+    include/src/liskey.c ^
+    include/src/sklist.c ^
+    include/src/datfile.c ^
+    include/src/journal.c ^
+    include/src/delta.c ^
+    include/src/lzpack.c ^
+    include/src/state.c ^
+    include/src/validation.c
+
+set BENCH_FLAGS=-Iinclude -Iinclude/headers -Iinclude/models -Iinclude/src -Wall -Wextra -std=c99 -O2 -pthread
+
+gcc -o bin/columnar_bench.exe bench/columnar_bench.c %BENCH_SOURCES% %BENCH_FLAGS%
+if not %errorlevel% == 0 goto failed
+
+gcc -o bin/delta_bench.exe bench/delta_bench.c %BENCH_SOURCES% %BENCH_FLAGS%
+if not %errorlevel% == 0 goto failed
+
+gcc -o bin/extsort_bench.exe bench/extsort_bench.c %BENCH_SOURCES% %BENCH_FLAGS%
+if not %errorlevel% == 0 goto failed
+
+gcc -o bin/pool_bench.exe bench/pool_bench.c %BENCH_SOURCES% %BENCH_FLAGS%
+if not %errorlevel% == 0 goto failed
+
+gcc -o bin/remove_bench.exe bench/remove_bench.c %BENCH_SOURCES% %BENCH_FLAGS%
+if not %errorlevel% == 0 goto failed
+
+gcc -o bin/sort_bench.exe bench/sort_bench.c %BENCH_SOURCES% %BENCH_FLAGS%
+if not %errorlevel% == 0 goto failed
+
+echo Compilation successful!
+echo Benchmarks created in bin/. Run them from the project directory, e.g. bin/delta_bench.exe 200000
+goto done
+
+:failed
+echo Compilation failed! Check the errors above.
+
+:done
+pause
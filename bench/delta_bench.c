@@ -0,0 +1,174 @@
+/**
+ * @file delta_bench.c
+ * @brief Benchmark of Delta Saves
+ *
+ * Saves a large employee list once, then times saves after a single
+ * update, after scattered updates, after an update plus an appended
+ * record, and the full rewrite a removal forces. The saved file is
+ * reloaded after each step and checked, so a delta save that writes the
+ * wrong slot fails the benchmark instead of only looking fast.
+ *
+ * Usage: delta_bench [records]   (default 200000)
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For printf
+#include <stdlib.h>     // For memory allocation
+#include <string.h>     // For strcpy
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers
+#include "../include/headers/apctxt.h"          // For g_config
+#include "../include/headers/delta.h"           // For untrackAllDataFiles()
+#include "../include/models/employee.h"         // Employee records
+#include "../src/modules/data.h"                // For saving and loading lists
+
+#define benchFileName "bench_delta.dat"     // File the benchmark writes
+#define benchRepeats 20                     // Timed single-update saves
+#define benchScattered 200                  // Updates saved by one scattered save
+
+/**
+ * @brief Sets the hours worked of one generated employee.
+ * @param employeeList The employee list.
+ * @param index The position of the employee in the generated list.
+ * @param hours The new hours worked.
+ * @return 0 on success, -1 if the employee is missing.
+ */
+static int setHours(list* employeeList, int index, int hours) {
+    char key[16];
+    benchRecordKey(key, sizeof(key), index);
+    Employee* employee = searchEmployeeByNumber(employeeList, key);
+    if (employee == NULL) {
+        return -1;
+    }
+    Employee newData = *employee;
+    newData.employment.hoursWorked = hours;
+    return editEmployeeInList(employeeList, key, &newData);
+}
+
+/**
+ * @brief Returns the hours worked of one employee of a list.
+ * @param employeeList The employee list.
+ * @param key The employee number.
+ * @return The hours worked, or -1 if the employee is missing.
+ */
+static int getHours(list* employeeList, const char* key) {
+    Employee* employee = searchEmployeeByNumber(employeeList, key);
+    return employee ? employee->employment.hoursWorked : -1;
+}
+
+/**
+ * @brief Saves a list and returns how long the save took.
+ * @param employeeList The employee list.
+ * @param expected The record count the save must report.
+ * @param failures Incremented if the save fails.
+ * @return The time of the save in milliseconds.
+ */
+static double timeSave(list* employeeList, int expected, int* failures) {
+    double start = benchClock();
+    int saved = saveEmployeeDataFromFile(employeeList, benchFileName);
+    double elapsed = (benchClock() - start) * 1e3;
+    if (saved != expected) {
+        printf("  save reported %d records, expected %d\n", saved, expected);
+        (*failures)++;
+    }
+    return elapsed;
+}
+
+/**
+ * @brief Checks one employee through the key index and by reloading the saved file.
+ * @param key The employee number to check.
+ * @param hours The hours the employee must have, or -1 if it must be missing.
+ * @param size The record count the file must have.
+ * @param failures Incremented if the file does not match.
+ */
+static void checkFile(const char* key, int hours, int size, int* failures) {
+    Employee found;
+    int result = lookupRecordInFile(benchFileName, "employee", key, &found);
+    if (result != (hours >= 0 ? 1 : 0) || (result == 1 && found.employment.hoursWorked != hours)) {
+        printf("  index lookup of %s failed\n", key);
+        (*failures)++;
+    }
+    list* reloaded = loadEmployeeDataFromFile(benchFileName, DYNAMIC_ARRAY);
+    if (reloaded == NULL || reloaded->size != size || getHours(reloaded, key) != hours) {
+        printf("  reload check of %s failed\n", key);
+        (*failures)++;
+    }
+    if (reloaded) {
+        untrackDataFile(reloaded);
+        destroyList(&reloaded, freeEmployee);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int count = benchRecordCount(argc, argv, 200000);
+    int failures = 0;
+    char key[16];
+    benchSetup();
+    g_config.journalSaves = 0; // Delta saves are only used without a journal
+    g_config.mappedLoadMB = 0;  // Keep the reloaded list in ordinary memory
+    benchRemoveFile(benchFileName);
+
+    list* employeeList = benchEmployeeList(DYNAMIC_ARRAY, count);
+    if (employeeList == NULL) {
+        printf("Out of memory\n");
+        return 1;
+    }
+    printf("Delta saves of %d employees (%zu byte records)\n", count, sizeof(Employee));
+    printf("  first full save:                %8.2f ms\n", timeSave(employeeList, count, &failures));
+    destroyList(&employeeList, freeEmployee);
+    employeeList = loadEmployeeDataFromFile(benchFileName, DYNAMIC_ARRAY);
+    if (employeeList == NULL) {
+        printf("Reload failed\n");
+        return 1;
+    }
+
+    double total = 0.0;
+    for (int i = 0; i < benchRepeats; i++) {
+        setHours(employeeList, (i * 7919) % count, 1000 + i);
+        total += timeSave(employeeList, count, &failures);
+    }
+    printf("  save after 1 update (average):  %8.2f ms\n", total / benchRepeats);
+    benchRecordKey(key, sizeof(key), ((benchRepeats - 1) * 7919) % count);
+    checkFile(key, 1000 + benchRepeats - 1, count, &failures);
+
+    for (int i = 0; i < benchScattered; i++) {
+        setHours(employeeList, (i * 104729) % count, 3000 + i);
+    }
+    printf("  save after %d updates:         %8.2f ms\n", benchScattered, timeSave(employeeList, count, &failures));
+
+    Employee* added = calloc(1, sizeof(Employee));
+    if (added) {
+        strcpy(added->personal.employeeNumber, "NEW0000001");
+        added->employment.hoursWorked = 77;
+        createEmployee(added, &employeeList);
+    }
+    setHours(employeeList, count - 1, 555);
+    printf("  save after update + append:     %8.2f ms\n", timeSave(employeeList, count + 1, &failures));
+    checkFile("NEW0000001", 77, count + 1, &failures);
+
+    benchRecordKey(key, sizeof(key), count / 2);
+    removeEmployeeFromList(employeeList, key);
+    printf("  save after removal (rewrite):   %8.2f ms\n", timeSave(employeeList, count, &failures));
+    checkFile(key, -1, count, &failures);
+
+    // A new record may reuse the freed address; it must still be saved
+    Employee* reused = calloc(1, sizeof(Employee));
+    if (reused) {
+        strcpy(reused->personal.employeeNumber, "NEW0000002");
+        reused->employment.hoursWorked = 88;
+        createEmployee(reused, &employeeList);
+    }
+    printf("  save after append:              %8.2f ms\n", timeSave(employeeList, count + 1, &failures));
+    checkFile("NEW0000002", 88, count + 1, &failures);
+
+    untrackAllDataFiles();
+    destroyList(&employeeList, freeEmployee);
+    benchRemoveFile(benchFileName);
+    printf("%s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file extsort_bench.c
+ * @brief Benchmark of External File Sorts
+ *
+ * Saves a large student list with journaling on, journals a few updates,
+ * removals and additions, and then sorts the file by grade on disk with
+ * externalSortStudentFile(): once with a memory budget small enough to
+ * force sorted runs and merging, once with a budget that holds the whole
+ * file, and once in place. Every output is reloaded and compared record
+ * by record with the changed list sorted in memory, and its key index,
+ * manifest entry and journal are checked, so a sort that skips the
+ * journal or writes a broken file fails the benchmark.
+ *
+ * Usage: extsort_bench [records]   (default 200000)
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For printf
+#include <stdlib.h>     // For memory allocation
+#include <string.h>     // For memcmp and strcpy
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers
+#include "../include/headers/apctxt.h"          // For g_config
+#include "../include/headers/delta.h"           // For untrackDataFile()
+#include "../include/headers/journal.h"         // For detachJournal()
+#include "../include/models/student.h"          // Student records
+#include "../src/modules/data.h"                // For saving and loading lists
+#include "../src/modules/extsort.h"             // External sorting
+#include "../src/modules/manifest.h"            // For the manifest check
+
+#define benchFileName "bench_extsort.dat"           // Journaled input file
+#define benchSortedName "bench_extsort_sorted.dat"  // Output of the copying sorts
+#define benchSmallBudget (4 * 1024 * 1024)          // Budget that forces runs
+#define benchLargeBudget (512 * 1024 * 1024)        // Budget that holds the file
+#define benchChanges 300                            // Journaled changes of each kind
+
+/**
+ * @brief Grade order of the sort menu: highest grade first, then student number.
+ */
+static const StudentSortSpec gradeOrder[] = { { STUDENT_SORT_FINAL_GRADE, true }, { STUDENT_SORT_NUMBER, false } };
+
+/**
+ * @brief Journals updates, removals and additions to a saved student list and saves them.
+ * @param studentList The student list, journaled to the benchmark file.
+ * @param count The number of generated students.
+ * @return 0 on success, -1 on failure.
+ */
+static int journalChanges(list* studentList, int count) {
+    char key[16];
+    for (int i = 0; i < benchChanges; i++) {
+        benchRecordKey(key, sizeof(key), (i * 7919) % count);
+        Student* student = searchStudentByNumber(studentList, key);
+        if (student) {
+            Student newData = *student;
+            newData.academic.prelimGrade = 100.0f;
+            newData.academic.midtermGrade = 100.0f;
+            newData.academic.finalExamGrade = (float)(i % 100);
+            calculateFinalGrade(&newData);
+            editStudentInList(studentList, key, &newData);
+        }
+        benchRecordKey(key, sizeof(key), (i * 104729 + 1) % count);
+        removeStudentFromList(studentList, key);
+
+        Student* added = calloc(1, sizeof(Student));
+        if (added == NULL) {
+            return -1;
+        }
+        snprintf(added->personal.studentNumber, studentNumberLen, "N%09d", i);
+        added->academic.finalGrade = (float)(i % 101);
+        strcpy(added->academic.remarks, "Added");
+        createStudent(added, &studentList);
+    }
+    return saveStudentDataFromFile(studentList, benchFileName) >= 0 ? 0 : -1;
+}
+
+/**
+ * @brief Checks a sorted file against the expected records.
+ * @param fileName The sorted file.
+ * @param expected The changed list, sorted in memory.
+ * @param failures Incremented for every check that fails.
+ */
+static void checkSortedFile(const char* fileName, list* expected, int* failures) {
+    DataFileRegistration registration;
+    list* sorted = loadListUnregistered(fileName, "student", DYNAMIC_ARRAY, &registration);
+    if (sorted == NULL || sorted->size != expected->size) {
+        printf("  %s: %d records, expected %d\n", fileName, sorted ? sorted->size : -1, expected->size);
+        (*failures)++;
+    } else {
+        for (int i = 0; i < sorted->size; i++) {
+            if (memcmp(sorted->slots[i].data, expected->slots[i].data, sizeof(Student)) != 0) {
+                printf("  %s: record %d differs\n", fileName, i);
+                (*failures)++;
+                break;
+            }
+        }
+    }
+    if (sorted) {
+        destroyList(&sorted, freeStudent);
+    }
+
+    // An updated student and an added one are found through the key index
+    char updated[16];
+    benchRecordKey(updated, sizeof(updated), 0);
+    const char* keys[] = { updated, "N000000001" };
+    for (int i = 0; i < 2; i++) {
+        Student found;
+        const Student* wanted = searchStudentByNumber(expected, keys[i]);
+        int result = lookupRecordInFile(fileName, "student", keys[i], &found);
+        if (result != (wanted ? 1 : 0) || (wanted && memcmp(&found, wanted, sizeof(Student)) != 0)) {
+            printf("  %s: key index lookup of %s failed\n", fileName, keys[i]);
+            (*failures)++;
+        }
+    }
+
+    ManifestEntry* entries = NULL;
+    int entryCount = getDataFileManifest("bench_extsort", &entries);
+    bool listed = false;
+    for (int i = 0; i < entryCount; i++) {
+        listed = listed || (strcmp(entries[i].name, fileName) == 0 && entries[i].recordCount == (uint32_t)expected->size &&
+                            entries[i].journalSize < 0);
+    }
+    free(entries);
+    if (!listed) {
+        printf("  %s: manifest entry missing or wrong\n", fileName);
+        (*failures)++;
+    }
+}
+
+/**
+ * @brief Sorts the benchmark file and returns how long it took.
+ * @param outputFile The file to write.
+ * @param memoryLimit The memory budget.
+ * @param expected The number of records the sort must write.
+ * @param failures Incremented if the sort fails.
+ * @return The time in milliseconds.
+ */
+static double timeSort(const char* outputFile, size_t memoryLimit, int expected, int* failures) {
+    double start = benchClock();
+    int sorted = externalSortStudentFile(benchFileName, outputFile, gradeOrder, 2, memoryLimit);
+    double elapsed = (benchClock() - start) * 1e3;
+    if (sorted != expected) {
+        printf("  sort wrote %d records, expected %d\n", sorted, expected);
+        (*failures)++;
+    }
+    return elapsed;
+}
+
+int main(int argc, char* argv[]) {
+    int count = benchRecordCount(argc, argv, 200000);
+    int failures = 0;
+    benchSetup();
+    g_config.journalSaves = 1; // The sort must apply the journal of its input
+    benchRemoveFile(benchFileName);
+    benchRemoveFile(benchSortedName);
+
+    list* studentList = benchStudentList(DYNAMIC_ARRAY, count);
+    if (studentList == NULL || saveStudentDataFromFile(studentList, benchFileName) != count ||
+        journalChanges(studentList, count) != 0) {
+        printf("Could not write the input file\n");
+        return 1;
+    }
+    detachJournal(studentList);
+    untrackDataFile(studentList);
+
+    // The expected output: the changed list sorted in memory, in the same stable order
+    double start = benchClock();
+    sortStudentsBySpec(studentList, gradeOrder, 2);
+    double inMemory = (benchClock() - start) * 1e3;
+
+    printf("Sorting %d students (%zu byte records) by grade, %d journaled changes of each kind\n",
+           studentList->size, sizeof(Student), benchChanges);
+    printf("  in-memory sort of the loaded list:  %8.1f ms\n", inMemory);
+    printf("  file sort, %3d MB budget (runs):    %8.1f ms\n", benchSmallBudget >> 20,
+           timeSort(benchSortedName, benchSmallBudget, studentList->size, &failures));
+    checkSortedFile(benchSortedName, studentList, &failures);
+    printf("  file sort, %3d MB budget (1 run):   %8.1f ms\n", benchLargeBudget >> 20,
+           timeSort(benchSortedName, benchLargeBudget, studentList->size, &failures));
+    checkSortedFile(benchSortedName, studentList, &failures);
+    printf("  in-place file sort, %3d MB budget:  %8.1f ms\n", benchSmallBudget >> 20,
+           timeSort(benchFileName, benchSmallBudget, studentList->size, &failures));
+    checkSortedFile(benchFileName, studentList, &failures);
+
+    destroyList(&studentList, freeStudent);
+    benchRemoveFile(benchFileName);
+    benchRemoveFile(benchSortedName);
+    printf("%s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
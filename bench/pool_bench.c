@@ -0,0 +1,203 @@
+/**
+ * @file pool_bench.c
+ * @brief Benchmark of the List Node Pool
+ *
+ * Adds a large number of employee records to a DOUBLY list one by one
+ * with addNode(), which takes its nodes from the list's slab pool, then
+ * clears the list, fills it again and destroys it. The same steps are
+ * timed on a minimal list that allocates every node with malloc() and
+ * frees it with free(), the way addNode() and clearList() worked before
+ * the pool. Both runs allocate and free the records the same way, so
+ * the difference is the cost of the nodes. The two lists take turns
+ * running first, and the node counts are checked after every step.
+ *
+ * Usage: pool_bench [records]   (default 500000)
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For printf
+#include <stdlib.h>     // For memory allocation
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers
+#include "../include/headers/list.h"            // Lists with the node pool
+#include "../include/models/employee.h"         // Employee records
+
+#define benchRounds 5       // Timed rounds; the fastest of each step is reported
+
+/**
+ * @brief Doubly linked list with one malloc() per node
+ */
+typedef struct {
+    node* head;     // First node
+    node* tail;     // Last node
+    int size;       // Number of nodes
+} MallocList;
+
+/**
+ * @brief Steps of a round that are timed.
+ */
+enum { STEP_ADD, STEP_CLEAR, STEP_DESTROY, stepCount };
+
+/**
+ * @brief Appends a record to a malloc-per-node list.
+ * @param l The list.
+ * @param data The record.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+static int mallocAddNode(MallocList* l, void* data) {
+    node* newNode = (node*)malloc(sizeof(node));
+    if (!newNode) {
+        return -1;
+    }
+    newNode->data = data;
+    newNode->next = NULL;
+    newNode->prev = l->tail;
+    if (l->tail) {
+        l->tail->next = newNode;
+    } else {
+        l->head = newNode;
+    }
+    l->tail = newNode;
+    l->size++;
+    return 0;
+}
+
+/**
+ * @brief Frees every node and record of a malloc-per-node list.
+ * @param l The list.
+ */
+static void mallocClearList(MallocList* l) {
+    node* current = l->head;
+    while (current) {
+        node* next = current->next;
+        freeEmployee(current->data);
+        free(current);
+        current = next;
+    }
+    l->head = NULL;
+    l->tail = NULL;
+    l->size = 0;
+}
+
+/**
+ * @brief Counts the nodes of a chain.
+ * @param head The first node.
+ * @return The number of nodes.
+ */
+static int countNodes(const node* head) {
+    int count = 0;
+    for (const node* current = head; current; current = current->next) {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Fills a list with new employee records.
+ * @param pooled The pooled list, or NULL to fill the malloc-per-node list.
+ * @param plain The malloc-per-node list.
+ * @param count The number of records.
+ * @return 0 on success, -1 on memory allocation failure.
+ */
+static int fillList(list** pooled, MallocList* plain, int count) {
+    for (int i = 0; i < count; i++) {
+        Employee* employee = calloc(1, sizeof(Employee));
+        if (!employee) {
+            return -1;
+        }
+        int result = pooled ? addNode(pooled, employee) : mallocAddNode(plain, employee);
+        if (result != 0) {
+            free(employee);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Times one round of add, clear, add again and destroy.
+ * @param pooled true for the pooled list, false for the malloc-per-node list.
+ * @param count The number of records.
+ * @param times Receives the time of every step in milliseconds.
+ * @param failures Incremented for every step that leaves the wrong node count.
+ */
+static void timeRound(bool pooled, int count, double times[stepCount], int* failures) {
+    list* l = NULL;
+    MallocList plain = { NULL, NULL, 0 };
+    if (pooled && createList(&l, DOUBLY) != 0) {
+        (*failures)++;
+        return;
+    }
+
+    double start = benchClock();
+    int result = fillList(pooled ? &l : NULL, &plain, count);
+    times[STEP_ADD] = (benchClock() - start) * 1e3;
+    if (result != 0 || countNodes(pooled ? l->head : plain.head) != count) {
+        (*failures)++;
+    }
+
+    start = benchClock();
+    if (pooled) {
+        clearList(l, freeEmployee);
+    } else {
+        mallocClearList(&plain);
+    }
+    times[STEP_CLEAR] = (benchClock() - start) * 1e3;
+    if ((pooled ? l->size : plain.size) != 0) {
+        (*failures)++;
+    }
+
+    // The list is filled again so destroying it frees a full list
+    if (fillList(pooled ? &l : NULL, &plain, count) != 0) {
+        (*failures)++;
+    }
+    start = benchClock();
+    if (pooled) {
+        destroyList(&l, freeEmployee);
+    } else {
+        mallocClearList(&plain);
+    }
+    times[STEP_DESTROY] = (benchClock() - start) * 1e3;
+}
+
+int main(int argc, char* argv[]) {
+    int count = benchRecordCount(argc, argv, 500000);
+    int failures = 0;
+    benchSetup();
+
+    double best[2][stepCount];
+    for (int run = 0; run < 2; run++) {
+        for (int step = 0; step < stepCount; step++) {
+            best[run][step] = -1.0;
+        }
+    }
+    for (int round = 0; round < benchRounds; round++) {
+        // The list that runs first inherits a different heap, so the order alternates
+        for (int i = 0; i < 2; i++) {
+            int run = (round + i) % 2;
+            double times[stepCount] = { 0.0 };
+            timeRound(run == 0, count, times, &failures);
+            for (int step = 0; step < stepCount; step++) {
+                if (best[run][step] < 0.0 || times[step] < best[run][step]) {
+                    best[run][step] = times[step];
+                }
+            }
+        }
+    }
+
+    const char* names[stepCount] = { "add one by one", "clear", "destroy" };
+    printf("%d employees (%zu byte records) in a DOUBLY list, best of %d rounds\n", count, sizeof(Employee),
+           benchRounds);
+    printf("  %-16s %12s %16s %10s\n", "step", "node pool", "malloc per node", "speedup");
+    for (int step = 0; step < stepCount; step++) {
+        printf("  %-16s %9.1f ms %13.1f ms %9.2fx\n", names[step], best[0][step], best[1][step],
+               (best[0][step] > 0.0) ? best[1][step] / best[0][step] : 0.0);
+    }
+    printf("%s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
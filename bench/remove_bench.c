@@ -0,0 +1,150 @@
+/**
+ * @file remove_bench.c
+ * @brief Benchmark of Removing Records by Number
+ *
+ * Removes a fifth of a large employee list in random order, once with
+ * removeEmployeeFromList(), which finds each node through the list's key
+ * index, and once with a plain scan of the list followed by
+ * removeNodeByHandle(), the way removals worked before the index. Both
+ * runs must leave the same employees behind. Every list type that the
+ * menus create is measured.
+ *
+ * Usage: remove_bench [records]   (default 100000)
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For printf
+#include <stdlib.h>     // For memory allocation and rand
+#include <string.h>     // For strcmp
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers
+#include "../include/models/employee.h"         // Employee records
+
+/**
+ * @brief Shuffles the record positions to remove.
+ * @param order The positions.
+ * @param count The number of positions.
+ */
+static void shuffle(int* order, int count) {
+    srand(42);
+    for (int i = count - 1; i > 0; i--) {
+        int j = (int)(((unsigned long)rand() * RAND_MAX + (unsigned long)rand()) % (unsigned long)(i + 1));
+        int swap = order[i];
+        order[i] = order[j];
+        order[j] = swap;
+    }
+}
+
+/**
+ * @brief Finds the node of an employee by comparing every employee number in list order.
+ * @param employeeList The employee list.
+ * @param employeeNumber The employee number to look for.
+ * @return The node if found, NULL otherwise.
+ */
+static node* scanEmployeeNode(const list* employeeList, const char* employeeNumber) {
+    node* current = employeeList->head;
+    for (int i = 0; i < employeeList->size; i++, current = current->next) {
+        const Employee* employee = (const Employee*)current->data;
+        if (employee && strcmp(employee->personal.employeeNumber, employeeNumber) == 0) {
+            return current;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Removes employees by number and returns how long it took.
+ * @param employeeList The employee list.
+ * @param order The positions of the employees to remove.
+ * @param removals The number of employees to remove.
+ * @param indexed true to use removeEmployeeFromList(), false to scan the list.
+ * @param failures Incremented for every employee that could not be removed.
+ * @return The time in milliseconds.
+ */
+static double timeRemovals(list* employeeList, const int* order, int removals, bool indexed, int* failures) {
+    char key[16];
+    double start = benchClock();
+    for (int i = 0; i < removals; i++) {
+        benchRecordKey(key, sizeof(key), order[i]);
+        if (indexed) {
+            if (removeEmployeeFromList(employeeList, key) != 0) {
+                (*failures)++;
+            }
+        } else {
+            node* found = scanEmployeeNode(employeeList, key);
+            if (found == NULL) {
+                (*failures)++;
+                continue;
+            }
+            removeNodeByHandle(employeeList, found, freeEmployee);
+        }
+    }
+    return (benchClock() - start) * 1e3;
+}
+
+/**
+ * @brief Checks that exactly the employees that were not removed are left.
+ * @param employeeList The employee list.
+ * @param order The positions in removal order.
+ * @param count The number of employees the list started with.
+ * @param removals The number of employees removed.
+ * @return The number of employees in the wrong state.
+ */
+static int checkRemaining(list* employeeList, const int* order, int count, int removals) {
+    char key[16];
+    int wrong = (employeeList->size == count - removals) ? 0 : 1;
+    for (int i = 0; i < count; i += 97) {
+        benchRecordKey(key, sizeof(key), order[i]);
+        bool present = searchEmployeeByNumber(employeeList, key) != NULL;
+        if (present != (i >= removals)) {
+            wrong++;
+        }
+    }
+    return wrong;
+}
+
+int main(int argc, char* argv[]) {
+    int count = benchRecordCount(argc, argv, 100000);
+    int removals = (count >= 5) ? count / 5 : 1;
+    int failures = 0;
+    benchSetup();
+
+    int* order = (int*)malloc((size_t)count * sizeof(int));
+    if (order == NULL) {
+        printf("Out of memory\n");
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    shuffle(order, count);
+
+    const ListType types[] = { DOUBLY, DOUBLY_CIRCULAR, DYNAMIC_ARRAY, UNROLLED };
+    const char* names[] = { "DOUBLY", "DOUBLY_CIRCULAR", "DYNAMIC_ARRAY", "UNROLLED" };
+    printf("Removing %d of %d employees by number in random order\n", removals, count);
+    printf("  %-16s %12s %12s\n", "list type", "key index", "list scan");
+    for (int t = 0; t < 4; t++) {
+        double times[2];
+        for (int run = 0; run < 2; run++) {
+            list* employeeList = benchEmployeeList(types[t], count);
+            if (employeeList == NULL) {
+                printf("Out of memory\n");
+                free(order);
+                return 1;
+            }
+            times[run] = timeRemovals(employeeList, order, removals, run == 0, &failures);
+            failures += checkRemaining(employeeList, order, count, removals);
+            destroyList(&employeeList, freeEmployee);
+        }
+        printf("  %-16s %9.1f ms %9.1f ms\n", names[t], times[0], times[1]);
+    }
+
+    free(order);
+    printf("%s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
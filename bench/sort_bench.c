@@ -0,0 +1,139 @@
+/**
+ * @file sort_bench.c
+ * @brief Benchmark of Sorting Students by Grade
+ *
+ * Sorts a large student list by grade (highest first, ties by student
+ * number) with the radix sort of sortStudentsBySpec() and with the
+ * comparator sort of sortListParallel() on 1, 2, 4 and 8 threads, and
+ * finally with sortStudentsByGrade(), which the menu uses. Every run
+ * starts from the same generated list and must produce the same order
+ * as the radix sort.
+ *
+ * Thread scaling depends on the machine, so the number of processors is
+ * printed with the results; run it on the hardware the numbers are for.
+ *
+ * Usage: sort_bench [records]   (default 500000)
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For printf
+#include <stdlib.h>     // For memory allocation
+#include <string.h>     // For memcpy and memcmp
+
+// Application-specific includes
+#include "benchutil.h"                          // Benchmark helpers
+#include "../include/headers/apctxt.h"          // For getSortThreads()
+#include "../include/models/student.h"          // Student records
+#include "../src/modules/data.h"                // For sortStudentsByGrade()
+
+#define benchRepeats 3      // Timed runs of each sort; the fastest is reported
+
+/**
+ * @brief Grade order of the sort menu: highest grade first, then student number.
+ */
+static const StudentSortSpec gradeOrder[] = { { STUDENT_SORT_FINAL_GRADE, true }, { STUDENT_SORT_NUMBER, false } };
+
+/**
+ * @brief Ways of sorting the list that are timed.
+ */
+typedef enum {
+    SORT_RADIX,         // sortStudentsBySpec()
+    SORT_COMPARATOR,    // sortListParallel() with compareStudentByGrade()
+    SORT_MENU           // sortStudentsByGrade()
+} SortMethod;
+
+/**
+ * @brief Copies the student numbers of a list in list order.
+ * @param studentList The student list.
+ * @param numbers Receives studentNumberLen bytes per student.
+ */
+static void copyOrder(const list* studentList, char* numbers) {
+    node* current = studentList->head;
+    for (int i = 0; i < studentList->size; i++, current = current->next) {
+        memcpy(numbers + (size_t)i * studentNumberLen, ((const Student*)current->data)->personal.studentNumber,
+               studentNumberLen);
+    }
+}
+
+/**
+ * @brief Sorts freshly generated lists and returns the fastest time.
+ * @param method How to sort.
+ * @param threads The thread count of SORT_COMPARATOR.
+ * @param count The number of students.
+ * @param expected The expected order, or NULL to fill it in.
+ * @param failures Incremented for every run that fails or sorts differently.
+ * @return The fastest time in milliseconds.
+ */
+static double timeSort(SortMethod method, int threads, int count, char* expected, int* failures) {
+    size_t orderSize = (size_t)count * studentNumberLen;
+    char* order = (char*)malloc(orderSize);
+    double best = -1.0;
+    for (int run = 0; run < benchRepeats && order; run++) {
+        list* studentList = benchStudentList(DYNAMIC_ARRAY, count);
+        if (studentList == NULL) {
+            break;
+        }
+        double start = benchClock();
+        int ok;
+        switch (method) {
+            case SORT_RADIX: ok = sortStudentsBySpec(studentList, gradeOrder, 2) == 0; break;
+            case SORT_COMPARATOR: ok = sortListParallel(studentList, compareStudentByGrade, true, threads) == 0; break;
+            default: ok = sortStudentsByGrade(studentList, 1) == 1; break;
+        }
+        double elapsed = (benchClock() - start) * 1e3;
+        if (best < 0.0 || elapsed < best) {
+            best = elapsed;
+        }
+
+        copyOrder(studentList, order);
+        if (!ok || (run == 0 && expected && memcmp(order, expected, orderSize) != 0)) {
+            (*failures)++;
+        }
+        destroyList(&studentList, freeStudent);
+    }
+    if (order && expected == NULL) {
+        (*failures) += (best < 0.0) ? 1 : 0;
+    }
+    free(order);
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int count = benchRecordCount(argc, argv, 500000);
+    int failures = 0;
+    benchSetup();
+
+    char* expected = (char*)malloc((size_t)count * studentNumberLen);
+    list* reference = benchStudentList(DYNAMIC_ARRAY, count);
+    if (expected == NULL || reference == NULL || sortStudentsBySpec(reference, gradeOrder, 2) != 0) {
+        printf("Out of memory\n");
+        return 1;
+    }
+    copyOrder(reference, expected);
+    destroyList(&reference, freeStudent);
+
+    printf("Sorting %d students (%zu byte records) by grade on %d processor(s), best of %d\n", count, sizeof(Student),
+           benchProcessorCount(), benchRepeats);
+    double radix = timeSort(SORT_RADIX, 1, count, expected, &failures);
+    printf("  radix sort (sortStudentsBySpec):    %8.1f ms\n", radix);
+    const int threadCounts[] = { 1, 2, 4, 8 };
+    double serial = 0.0;
+    for (int t = 0; t < 4; t++) {
+        double elapsed = timeSort(SORT_COMPARATOR, threadCounts[t], count, expected, &failures);
+        if (t == 0) {
+            serial = elapsed;
+        }
+        printf("  comparator sort, %d thread(s):       %8.1f ms  (%.2fx of 1 thread)\n", threadCounts[t], elapsed,
+               (elapsed > 0.0) ? serial / elapsed : 0.0);
+    }
+    printf("  menu sort, sort_threads = %d:        %8.1f ms\n", getSortThreads(),
+           timeSort(SORT_MENU, 0, count, expected, &failures));
+
+    free(expected);
+    printf("%s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
@@ -13,6 +13,13 @@ gcc -o bin/PUP-InformationManagementSystem.exe ^
     src/ui/courseio.c ^
     src/modules/data.c ^
     src/modules/payroll.c ^
+    src/modules/extsort.c ^
+    src/modules/autosave.c ^
+    src/modules/columnar.c ^
+    src/modules/csvimport.c ^
+    src/modules/export.c ^
+    src/modules/manifest.c ^
+    src/modules/session.c ^
     include/models/employee.c ^
     include/models/student.c ^
     include/models/course.c ^
@@ -21,6 +28,15 @@ gcc -o bin/PUP-InformationManagementSystem.exe ^
     include/src/auth.c ^
     include/src/lismgr.c ^
     include/src/lisops.c ^
+    include/src/lissrt.c ^
+    include/src/lispar.c ^
+    include/src/lisrdx.c ^
+    include/src/liskey.c ^
+    include/src/sklist.c ^
+    include/src/datfile.c ^
+    include/src/journal.c ^
+    include/src/delta.c ^
+    include/src/lzpack.c ^
     include/src/interface.c ^
     include/src/state.c ^
     include/src/validation.c ^
@@ -28,7 +44,7 @@ gcc -o bin/PUP-InformationManagementSystem.exe ^
     -Iinclude/headers ^
     -Iinclude/models ^
     -Iinclude/src ^
-    -Wall -Wextra -std=c99
+    -Wall -Wextra -std=c99 -pthread
 
 if %errorlevel% == 0 (
     echo Compilation successful!
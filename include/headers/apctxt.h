@@ -20,8 +20,12 @@
 #include <stdlib.h>     // For memory allocation and general utilities
 #include <string.h>     // For string manipulation functions
 #include <stdbool.h>    // For boolean data type support
+#include <stdint.h>     // For SIZE_MAX
+#include <time.h>       // For file modification times
+#ifdef _WIN32
 #include <conio.h>      // For console I/O operations
 #include <windows.h>    // For Windows-specific terminal functions
+#endif
 
 /**
  * @struct Config
@@ -40,6 +44,16 @@ typedef struct {
     float passingGrade;    // Minimum grade required to pass (e.g., 75.0)
     float minGrade;        // Minimum possible grade (e.g., 0.0)
     float maxGrade;        // Maximum possible grade (e.g., 100.0)
+    
+    // Performance settings
+    int sortThreads;       // Threads used to sort large lists (1 disables parallel sorting)
+    int sortMemoryMB;      // Memory budget of external file sorts in megabytes
+    int mappedLoadMB;      // Data files at least this large are memory-mapped (0 disables)
+    int journalSaves;      // Save changes to a journal instead of rewriting files (0 disables)
+    int autosaveSeconds;   // Seconds between background autosaves of modified lists (0 disables)
+    int compressSaves;     // Write data files in compressed blocks (0 disables)
+    int loadThreads;       // Threads that load the files of a load session
+    int startupSession;    // Load every saved list at startup (0 disables)
 } Config;
 
 // Global configuration instance - accessible throughout the application
@@ -106,8 +120,66 @@ float getOvertimeRate(void);
  */
 float getPassingGrade(void);
 
+/**
+ * @brief Gets the number of threads used to sort large lists
+ * @return Sort thread count from configuration (at least 1)
+ */
+int getSortThreads(void);
+
+/**
+ * @brief Gets the memory budget for sorting data files larger than memory
+ * @return External sort memory limit in bytes (at least 1 MB)
+ */
+size_t getSortMemoryLimit(void);
+
+/**
+ * @brief Gets the file size from which data files are memory-mapped
+ * @return Mapped load threshold in bytes (SIZE_MAX if mapping is disabled)
+ */
+size_t getMappedLoadThreshold(void);
+
+/**
+ * @brief Checks whether saves append to a journal instead of rewriting the file
+ * @return true if journaled saves are enabled in the configuration
+ */
+bool isJournalEnabled(void);
+
+/**
+ * @brief Gets the time between background autosaves of modified lists
+ * @return Autosave interval in seconds (0 if autosaving is disabled)
+ */
+int getAutosaveInterval(void);
+
+/**
+ * @brief Checks whether data files are written in compressed blocks
+ * @return true if compressed saves are enabled in the configuration
+ */
+bool isCompressionEnabled(void);
+
+/**
+ * @brief Gets the number of threads that load the files of a load session
+ * @return Load thread count from configuration (at least 1)
+ */
+int getLoadThreads(void);
+
+/**
+ * @brief Checks whether every saved list is loaded at startup
+ * @return true if the startup session is enabled in the configuration
+ */
+bool isStartupSessionEnabled(void);
+
 /** @} */ // End of Configuration Accessor Functions
 
+/**
+ * @struct AppFileInfo
+ * @brief A file found by appScanDirectory() or appGetFileInfo()
+ */
+typedef struct {
+    char name[256];         // File name without the directory
+    long long size;         // Size in bytes
+    time_t modified;        // Last modification time
+} AppFileInfo;
+
 /**
  * @name File System Utility Functions
  * @brief Cross-platform file system operations
@@ -129,6 +201,30 @@ int appCreateDirectory(const char* dirPath);
  */
 int appListFiles(const char* directory, const char* pattern);
 
+/**
+ * @brief Lists the files of a directory that match a pattern, with their sizes and times
+ * 
+ * Reads the directory once: FindFirstFile()/FindNextFile() on Windows,
+ * which return the size and time with each name, and readdir() with
+ * fnmatch() and one fstatat() per match elsewhere. No file is opened, so
+ * directories with thousands of files are listed quickly. Subdirectories
+ * are skipped and the files are sorted by name.
+ * 
+ * @param directory Directory path to search
+ * @param pattern File pattern to match (e.g., "*.dat")
+ * @param files Receives the files, to be released with free() (NULL if none)
+ * @return Number of files found (0 if the directory does not exist), or -1 on error
+ */
+int appScanDirectory(const char* directory, const char* pattern, AppFileInfo** files);
+
+/**
+ * @brief Gets the size and modification time of one file without opening it
+ * @param path Path of the file
+ * @param info Receives the file's name (without the directory), size and time
+ * @return 0 on success, -1 if there is no such regular file
+ */
+int appGetFileInfo(const char* path, AppFileInfo* info);
+
 /** @} */ // End of File System Utility Functions
 
 /**
@@ -340,6 +436,38 @@ void readLine(char* buffer, int size);
  */
 bool isValid(const char* input, IValidationType type, IValidationParams params, const char* fieldName);
 
+/**
+ * @brief Validates input against specified criteria without printing
+ *
+ * Applies the same rules as isValid(), which prints the message this
+ * function returns. Used where input does not come from the console,
+ * such as bulk imports that report errors per row.
+ *
+ * @param input Input string to validate
+ * @param type Type of validation to perform
+ * @param params Parameters for the validation
+ * @param fieldName Name of the field (for error messages)
+ * @param message Receives the reason if the input is invalid (may be NULL)
+ * @param messageSize Size of the message buffer
+ * @return true if input is valid, false otherwise
+ */
+bool validateInput(const char* input, IValidationType type, IValidationParams params, const char* fieldName,
+                   char* message, size_t messageSize);
+
+/**
+ * @brief Parses a decimal number independently of the C locale
+ *
+ * Accepts an optional sign, digits with an optional '.' fraction and an
+ * optional exponent, and nothing else, so "12.50" means the same under
+ * every locale. The result is correctly rounded for up to 15 significant
+ * digits, which covers every rate and grade the system stores.
+ *
+ * @param text Text to parse
+ * @param value Receives the number
+ * @return true if the whole text is a decimal number, false otherwise
+ */
+bool parseDecimal(const char* text, double* value);
+
 /**
  * @brief Gets validated input from user using form fields
  * @param fields Array of form field definitions
@@ -439,7 +567,11 @@ static inline MenuOption createMenuOption(char key, const char* text, const char
  */
 static inline void waitForKeypress(const char* message) {
     printf("%s", message ? message : "Press any key to continue...");
+#ifdef _WIN32
     _getch();
+#else
+    getchar(); // No unbuffered console input without conio
+#endif
 }
 
 /** @} */ // End of Utility Helper Functions
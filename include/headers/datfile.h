@@ -0,0 +1,580 @@
+/**
+ * @file datfile.h
+ * @brief Binary Data File Format
+ *
+ * Every employee, student and course catalog file starts with a
+ * DataFileHeader that identifies the file, describes its records and
+ * carries a CRC32C of everything after the header. Readers can reject a
+ * foreign, truncated or corrupted file before touching the records and
+ * know the exact record count to allocate for.
+ *
+ * File layout:
+ * - DataFileHeader (headerSize bytes)
+ * - Metadata (metadataSize bytes, e.g. the catalog name; usually empty)
+ * - recordCount records of recordSize bytes each
+ *
+ * Files with the dataFileCompressed option hold the records in blocks of
+ * blockRecords records, each compressed on its own with lzpack (see
+ * lzpack.h), followed by an index of where each block starts:
+ * - DataFileHeader, metadata
+ * - Per block: packed size (uint32_t), then the packed bytes; a block
+ *   whose packed size equals its raw size is stored uncompressed
+ * - Block index: one uint64_t file offset per block
+ * The checksum still covers the uncompressed metadata and records, so a
+ * file reads back to the same payload whichever way it was stored. Use a
+ * DataFileReader to read the records of either kind of file.
+ *
+ * Files with the dataFileIndexed option end with a key index after the
+ * records (or the block index), so one record can be found by its key
+ * without loading the file:
+ * - Entries: every record's key (zero-padded to keyLength bytes) and its
+ *   slot (uint32_t), sorted by key, then slot
+ * - Fences: the first key of every fenceStride entries and the CRC32C of
+ *   those entries
+ * - DataFileIndexFooter at the very end of the file
+ * A lookup reads the footer and the fences, binary searches them and then
+ * reads a single run of entries and a single record. The index is not
+ * covered by the header checksum; the footer and each run carry their own.
+ *
+ * Files written before the header existed (a plain int count followed
+ * by the records) are still accepted and reported as version 0.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef DATFILE_H
+#define DATFILE_H
+
+#include <stdio.h>      // For FILE
+#include <stdint.h>     // For fixed-width header fields
+#include <stddef.h>     // For size_t
+#include <stdbool.h>    // For boolean data type support
+#include "list.h"       // For writing lists of records
+
+/**
+ * @name Data File Format Constants
+ * @brief Identification of the binary data file format
+ *
+ * The low byte of the header flags holds the record type and the bits
+ * above it hold format options. Files with unknown options are rejected.
+ * @{
+ */
+#define dataFileMagic 0x44505550u       // "PUPD" in little-endian byte order
+#define dataFileVersion 1               // Current header layout
+#define dataFileTypeMask 0xFFu          // Flag bits holding the record type
+#define dataFileEmployees 1u            // File holds Employee records
+#define dataFileStudents 2u             // File holds Student records
+#define dataFileCourses 3u              // File holds Course records (catalog)
+#define dataFileStudentColumns 4u       // File holds Student fields column by column (see columnar.h)
+#define dataFileCompressed 0x100u       // Option: records are stored in compressed blocks
+#define dataFileIndexed 0x200u          // Option: a key index follows the records
+#define dataFileOptionMask 0x300u       // All options this version understands
+#define dataFileBlockBytes 65536        // Target uncompressed size of one block
+#define dataFileIndexMagic 0x58505550u  // "PUPX", magic of the key index footer
+#define dataFileFenceStride 256         // Index entries per fence
+#define dataFileMaxKeyLength 64         // Longest key field an index accepts
+
+/** @} */ // End of Data File Format Constants
+
+/**
+ * @struct DataFileHeader
+ * @brief Fixed header at the start of every data file
+ *
+ * All fields are stored in the byte order of the machine that wrote the
+ * file, like the records themselves.
+ */
+typedef struct DataFileHeader {
+    uint32_t magic;         // dataFileMagic
+    uint16_t version;       // Header layout version (0 for headerless legacy files)
+    uint16_t headerSize;    // Size of this header in bytes
+    uint32_t recordSize;    // Size of one record in bytes
+    uint32_t recordCount;   // Number of records after the metadata
+    uint32_t flags;         // Record type and format options
+    uint32_t metadataSize;  // Bytes of metadata between the header and the records
+    uint32_t checksum;      // CRC32C of the metadata and the records
+    uint32_t blockRecords;  // Records per compressed block (0 if the records are stored plainly)
+} DataFileHeader;
+
+/**
+ * @struct DataFileKey
+ * @brief Location of the NUL-terminated key field indexed by dataFileIndexed
+ */
+typedef struct DataFileKey {
+    size_t offset;          // Offset of the key field in the record
+    size_t length;          // Size of the key field in bytes
+} DataFileKey;
+
+/**
+ * @struct DataFileIndexFooter
+ * @brief Last bytes of a file with a key index
+ */
+typedef struct DataFileIndexFooter {
+    uint32_t magic;         // dataFileIndexMagic
+    uint32_t keyOffset;     // Offset of the key field in the record
+    uint32_t keyLength;     // Size of the key field (and of each stored key) in bytes
+    uint32_t entryCount;    // Number of entries (the record count)
+    uint32_t fenceStride;   // Entries per fence
+    uint32_t checksum;      // CRC32C of the fences and of the footer fields before this one
+    uint64_t indexSize;     // Bytes of entries, fences and this footer
+} DataFileIndexFooter;
+
+/**
+ * @struct DataFileReader
+ * @brief Sequential reader for the records of a plain or compressed data file
+ */
+typedef struct DataFileReader {
+    FILE* file;                 // File positioned by readDataFileHeader()
+    DataFileHeader header;      // Header of the file
+    size_t recordsLeft;         // Records not yet returned
+    unsigned char* block;       // Decompressed block being handed out (compressed files only)
+    size_t blockOffset;         // Bytes of the block already returned
+    size_t blockSize;           // Bytes in the block
+    unsigned char* packed;      // Buffer for one packed block
+} DataFileReader;
+
+/**
+ * @brief Writer of a data file whose records arrive in pieces (see openDataFileWriter())
+ */
+typedef struct DataFileWriter DataFileWriter;
+
+/**
+ * @name Checksum Functions
+ * @brief CRC32C (Castagnoli) checksums
+ * @{
+ */
+
+/**
+ * @brief Updates a CRC32C checksum with more data
+ *
+ * Uses the SSE4.2 CRC32 instruction when the processor supports it and
+ * a table-driven software implementation otherwise. Both give the same
+ * result. Start with 0 and pass the previous result to checksum data in
+ * several pieces. Safe to call from several threads at once; the software
+ * tables are built once, on first use.
+ *
+ * @param crc Checksum of the data so far (0 for none)
+ * @param data Data to add
+ * @param length Number of bytes to add
+ * @return Checksum of the data so far including the new bytes
+ */
+uint32_t crc32c(uint32_t crc, const void* data, size_t length);
+
+/**
+ * @brief Updates the CRC32C of a buffer after a range of it was overwritten
+ *
+ * Only reads the old and new bytes of the range, so the checksum of a
+ * large file can be kept current when a few records are rewritten in
+ * place. The cost of skipping the bytes after the range grows with the
+ * logarithm of their number.
+ *
+ * @param crc crc32c() of the whole buffer before the change
+ * @param oldData Previous contents of the range
+ * @param newData New contents of the range
+ * @param length Length of the range in bytes
+ * @param bytesAfter Number of bytes in the buffer after the range
+ * @return crc32c() of the whole buffer after the change
+ */
+uint32_t crc32cReplace(uint32_t crc, const void* oldData, const void* newData, size_t length, uint64_t bytesAfter);
+
+/**
+ * @brief Combines the CRC32C checksums of two pieces of data
+ *
+ * Gives the checksum of the first piece followed by the second without
+ * reading either, so pieces checksummed separately (or written in a
+ * different order than they are checksummed) can share one checksum.
+ *
+ * @param first crc32c() of the first piece
+ * @param second crc32c() of the second piece
+ * @param secondLength Length of the second piece in bytes
+ * @return crc32c() of both pieces one after another
+ */
+uint32_t crc32cCombine(uint32_t first, uint32_t second, uint64_t secondLength);
+
+/** @} */ // End of Checksum Functions
+
+/**
+ * @name Data File Header Functions
+ * @brief Writing and validating data file headers
+ * @{
+ */
+
+/**
+ * @brief Initializes a header for a new data file
+ *
+ * The record count and checksum start at 0 and are filled in once all
+ * records have been written.
+ *
+ * @param header Header to initialize
+ * @param recordType Record type (dataFileEmployees, dataFileStudents or dataFileCourses),
+ *                   optionally combined with dataFileCompressed and dataFileIndexed
+ * @param recordSize Size of one record in bytes
+ * @param metadataSize Size of the metadata written before the records
+ */
+void initDataFileHeader(DataFileHeader* header, uint32_t recordType, size_t recordSize, size_t metadataSize);
+
+/**
+ * @brief Writes a header at the start of a data file
+ *
+ * Writers call this once before the records to reserve the space and
+ * again with the final count and checksum. The file position is left at
+ * the end of the file.
+ *
+ * @param file File opened for binary writing
+ * @param header Header to write
+ * @return 0 on success, -1 on error
+ */
+int writeDataFileHeader(FILE* file, const DataFileHeader* header);
+
+/**
+ * @brief Reads and validates the header and metadata of a data file
+ *
+ * Checks the magic number, version, record type and record size, and
+ * that the file size matches the record count exactly, so truncated
+ * files are rejected without reading the records. For compressed files
+ * the block index is checked against the file size instead. The footer
+ * of a key index is checked and the index left out of the size. Legacy files
+ * without a header are accepted if their size matches their count. On
+ * success the file is positioned at the first record or block.
+ *
+ * @param file File opened for binary reading, positioned at the start
+ * @param recordType Expected record type (without options)
+ * @param recordSize Expected size of one record in bytes
+ * @param metadata Buffer for the metadata (NULL if metadataSize is 0)
+ * @param metadataSize Expected size of the metadata in bytes
+ * @param header Receives the header (version 0 for legacy files)
+ * @return 0 if the file is valid, -1 otherwise
+ */
+int readDataFileHeader(FILE* file, uint32_t recordType, size_t recordSize,
+                       void* metadata, size_t metadataSize, DataFileHeader* header);
+
+/**
+ * @brief Checks the checksum of a data file's payload
+ *
+ * @param header Header returned by readDataFileHeader()
+ * @param payloadChecksum crc32c() of the metadata followed by the records
+ * @return 0 if the checksum matches or the file has none (legacy), -1 otherwise
+ */
+int verifyDataFileChecksum(const DataFileHeader* header, uint32_t payloadChecksum);
+
+/**
+ * @brief Forces the buffered contents of a file to disk
+ *
+ * @param file File opened for writing
+ * @return 0 on success, -1 on error
+ */
+int syncDataFile(FILE* file);
+
+/**
+ * @brief Replaces a file with a completed temporary file in one step
+ *
+ * Readers and a crash at any moment see either the old or the new file,
+ * never neither: MoveFileExA() with MOVEFILE_REPLACE_EXISTING and
+ * MOVEFILE_WRITE_THROUGH on Windows, rename() elsewhere. If the replace
+ * fails, the old file is left as it was and the temporary file removed.
+ *
+ * @param savingPath Path of the temporary file, already synced to disk
+ * @param path Path of the file to replace (need not exist)
+ * @return 0 on success, -1 on error
+ */
+int replaceDataFile(const char* savingPath, const char* path);
+
+/**
+ * @brief Moves the position of a file by a 64-bit offset
+ *
+ * fseek() takes a long, which is 32 bits on Windows, so files of 2 GB or
+ * more cannot be addressed with it. Uses _fseeki64() on Windows and
+ * fseeko() elsewhere.
+ *
+ * @param file Open file
+ * @param offset Offset relative to origin
+ * @param origin SEEK_SET, SEEK_CUR or SEEK_END
+ * @return 0 on success, -1 on error
+ */
+int seekDataFile(FILE* file, int64_t offset, int origin);
+
+/**
+ * @brief Returns the position of a file as a 64-bit offset
+ *
+ * The counterpart of seekDataFile(), using _ftelli64() on Windows and
+ * ftello() elsewhere.
+ *
+ * @param file Open file
+ * @return Offset from the start of the file, or -1 on error
+ */
+int64_t tellDataFile(FILE* file);
+
+/**
+ * @brief Writes the records of a list as a complete data file
+ *
+ * The file is written under "<path>.saving.tmp", synced to disk and then
+ * renamed over path, so a crash or error during the save leaves the old
+ * file intact and a list mapped from the old file keeps working.
+ *
+ * @param dataList List of fixed-size records
+ * @param path Path of the data file
+ * @param recordType Record type stored in the header, with dataFileCompressed to compress the records
+ * @param recordSize Size of one record in bytes
+ * @param key Key field to index, or NULL to write the file without a key index
+ * @param header Receives the header that was written (can be NULL)
+ * @return Number of records written, or -1 on error
+ */
+int writeDataFile(const list* dataList, const char* path, uint32_t recordType, size_t recordSize,
+                  const DataFileKey* key, DataFileHeader* header);
+
+/**
+ * @brief Writes an array of records as a complete data file
+ *
+ * Same as writeDataFile() for records that lie one after another in
+ * memory, such as a snapshot of a list. Does not touch any list, so it
+ * can run on a thread other than the one that owns the records' list.
+ *
+ * @param records The records
+ * @param count Number of records
+ * @param path Path of the data file
+ * @param recordType Record type stored in the header, with dataFileCompressed to compress the records
+ * @param recordSize Size of one record in bytes
+ * @param key Key field to index, or NULL to write the file without a key index
+ * @return Number of records written, or -1 on error
+ */
+int writeDataFileRecords(const void* records, size_t count, const char* path, uint32_t recordType,
+                         size_t recordSize, const DataFileKey* key);
+
+/**
+ * @brief Starts writing a data file whose records arrive in pieces
+ *
+ * For writers that never hold all of the records at once, such as the
+ * external sort. The records are passed to appendDataFileRecords() in
+ * file order and closeDataFileWriter() completes the file. Like
+ * writeDataFile(), the file is written under "<path>.saving.tmp" and
+ * only renamed over path once it is complete. A key index keeps its key
+ * and slot (key length + 4 bytes) of every record in memory until the
+ * file is closed.
+ *
+ * @param path Path of the data file
+ * @param recordType Record type stored in the header, with dataFileCompressed to compress the records
+ * @param recordSize Size of one record in bytes
+ * @param key Key field to index, or NULL to write the file without a key index
+ * @return The writer, or NULL on error
+ */
+DataFileWriter* openDataFileWriter(const char* path, uint32_t recordType, size_t recordSize, const DataFileKey* key);
+
+/**
+ * @brief Writes the next records of a data file
+ *
+ * After a failed write the writer ignores further records, and
+ * closeDataFileWriter() discards the file.
+ *
+ * @param writer Writer from openDataFileWriter()
+ * @param records The records, one after another
+ * @param count Number of records
+ * @return 0 on success, -1 on error
+ */
+int appendDataFileRecords(DataFileWriter* writer, const void* records, size_t count);
+
+/**
+ * @brief Completes a data file and renames it into place, or discards it
+ *
+ * Writes the block index and key index, completes the header and syncs
+ * the file before renaming it over the path given to openDataFileWriter().
+ * The writer is freed either way.
+ *
+ * @param writer Writer from openDataFileWriter()
+ * @param keep true to complete the file, false to remove it (after an error elsewhere)
+ * @param header Receives the header that was written (can be NULL)
+ * @return Number of records written, or -1 on error or if the file was discarded
+ */
+int closeDataFileWriter(DataFileWriter* writer, bool keep, DataFileHeader* header);
+
+/** @} */ // End of Data File Header Functions
+
+/**
+ * @name Data File Reader Functions
+ * @brief Reading the records of plain and compressed data files
+ * @{
+ */
+
+/**
+ * @brief Starts reading the records of a validated data file
+ *
+ * @param reader Reader to initialize
+ * @param file File positioned at the first record by readDataFileHeader()
+ * @param header Header returned by readDataFileHeader()
+ * @return 0 on success, -1 if the block buffers could not be allocated
+ */
+int initDataFileReader(DataFileReader* reader, FILE* file, const DataFileHeader* header);
+
+/**
+ * @brief Reads the next records of a data file
+ *
+ * Plain files are read with a single fread. Compressed blocks that the
+ * request covers completely are decompressed straight into records; only
+ * a block split between two calls goes through the reader's buffer.
+ *
+ * @param reader Reader from initDataFileReader()
+ * @param records Buffer for count records
+ * @param count Number of records to read
+ * @return 0 if count records were read, -1 on error, corruption or end of file
+ */
+int readDataFileRecords(DataFileReader* reader, void* records, size_t count);
+
+/**
+ * @brief Releases the buffers of a reader (the file stays open)
+ *
+ * @param reader Reader from initDataFileReader()
+ */
+void closeDataFileReader(DataFileReader* reader);
+
+/**
+ * @brief Reads one block of records from anywhere in a data file
+ *
+ * Random access through the block index: only the requested block is
+ * read and decompressed. Plain files are treated as if they were split
+ * into blocks of the same size.
+ *
+ * @param file Data file validated with readDataFileHeader()
+ * @param header Header returned by readDataFileHeader()
+ * @param blockIndex Index of the block (record blockIndex * getDataFileBlockRecords())
+ * @param records Buffer for getDataFileBlockRecords() records
+ * @return Number of records read (fewer for the last block), or -1 on error
+ */
+int readDataFileBlock(FILE* file, const DataFileHeader* header, size_t blockIndex, void* records);
+
+/**
+ * @brief Returns the number of records per block used by readDataFileBlock()
+ *
+ * @param header Header returned by readDataFileHeader()
+ * @return Records per block (at least 1)
+ */
+size_t getDataFileBlockRecords(const DataFileHeader* header);
+
+/**
+ * @brief Reads one record by its slot
+ *
+ * @param file Data file validated with readDataFileHeader()
+ * @param header Header returned by readDataFileHeader()
+ * @param slot Position of the record in the file
+ * @param record Buffer for the record
+ * @return 0 on success, -1 on error
+ */
+int readDataFileRecord(FILE* file, const DataFileHeader* header, size_t slot, void* record);
+
+/** @} */ // End of Data File Reader Functions
+
+/**
+ * @name Data File Key Index Functions
+ * @brief Finding records of an indexed file by key
+ * @{
+ */
+
+/**
+ * @brief Finds the slot of the first record with a key through the key index
+ *
+ * Reads the footer and the fences, then one run of at most
+ * dataFileFenceStride entries; the records are not read. Keys compare
+ * like strcmp() over the key field.
+ *
+ * @param file Data file validated with readDataFileHeader()
+ * @param header Header returned by readDataFileHeader()
+ * @param field Key field the index must have been built over
+ * @param key Key to find (NUL-terminated)
+ * @param slot Receives the slot of the first record in file order with the key
+ * @param duplicated Receives whether more than one record has the key (can be NULL)
+ * @return 1 if a record has the key, 0 if none has, -1 if the file has no
+ *         valid index or on error
+ */
+int findDataFileKey(FILE* file, const DataFileHeader* header, const DataFileKey* field, const char* key,
+                    size_t* slot, bool* duplicated);
+
+/**
+ * @brief Builds the key index of a file whose records are patched in place
+ *
+ * Gives the same bytes (entries, fences and footer) that writeDataFile()
+ * writes after the records, for writers that append or rekey records
+ * without rewriting the file. The index goes right after the last record.
+ *
+ * @param records Pointers to the records in file order
+ * @param count Number of records
+ * @param key Key field to index
+ * @param size Receives the size of the index in bytes
+ * @return The index, to be released with free(), or NULL on error
+ */
+void* buildDataFileKeyIndex(const void* const* records, size_t count, const DataFileKey* key, size_t* size);
+
+/**
+ * @brief Builds the key index of a file that only had records appended
+ *
+ * Same result as buildDataFileKeyIndex() over all of the records, but
+ * only the appended records are sorted; they are merged into the sorted
+ * entries of the old index, so appending to a large file costs a pass
+ * over its index rather than a sort. The old index is checked against
+ * its footer, fences and run checksums first. The keys of the records
+ * already in the file must not have changed since the old index was
+ * written.
+ *
+ * @param oldIndex The index as read from the end of the file
+ * @param oldSize Size of the old index in bytes (its footer's indexSize)
+ * @param records Pointers to the appended records in file order
+ * @param count Number of appended records
+ * @param size Receives the size of the new index in bytes
+ * @return The index, to be released with free(), or NULL if the old index
+ *         is damaged or on error
+ */
+void* appendDataFileKeyIndex(const void* oldIndex, size_t oldSize, const void* const* records, size_t count,
+                             size_t* size);
+
+/** @} */ // End of Data File Key Index Functions
+
+/**
+ * @name Mapped Data File Functions
+ * @brief Zero-copy access to data files
+ * @{
+ */
+
+/**
+ * @brief Maps the start of a data file into memory copy-on-write
+ *
+ * The records can be used in place: pages are read from the page cache
+ * only when touched, and a page is copied into private memory the first
+ * time a record on it is modified. Changes never reach the file. The
+ * file can be closed and replaced while the mapping is in use on POSIX
+ * systems; Windows refuses to replace a mapped file, so the mapping must
+ * be detached with detachDataFileMapping() first.
+ *
+ * @param path Path of the file, already validated with readDataFileHeader()
+ * @param size Number of bytes to map (header, metadata and records)
+ * @return Start of the mapping, or NULL on error
+ */
+void* mapDataFile(const char* path, size_t size);
+
+/**
+ * @brief Turns a mapping into private memory at the same address
+ *
+ * Copies the mapped bytes, modified or not, releases the view and puts
+ * private memory with the same contents at the same address, so pointers
+ * into the mapping stay valid while the file itself is no longer in use.
+ * Reads the whole mapping and briefly needs twice its size. Does nothing
+ * on POSIX systems, which replace mapped files, or for a mapping that was
+ * already detached. Must not run while another thread uses the mapping.
+ *
+ * @param memory Start of the mapping
+ * @param size Size passed to mapDataFile()
+ * @return 0 on success, -1 on error (the mapping is left as it was)
+ */
+int detachDataFileMapping(void* memory, size_t size);
+
+/**
+ * @brief Releases a mapping created by mapDataFile()
+ *
+ * Also releases a mapping detached by detachDataFileMapping(). Matches the release function of adoptExternalDataBlock(), so a list can
+ * own the mapping of the file its records were loaded from.
+ *
+ * @param memory Start of the mapping
+ * @param size Size passed to mapDataFile()
+ */
+void unmapDataFile(void* memory, size_t size);
+
+/** @} */ // End of Mapped Data File Functions
+
+#endif // DATFILE_H
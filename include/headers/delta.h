@@ -0,0 +1,106 @@
+/**
+ * @file delta.h
+ * @brief Dirty Record Tracking and Delta Saves
+ *
+ * A list loaded from or saved to a data file remembers which file slot
+ * each of its records occupies. Edits mark their record dirty, and the
+ * next save of the list to the same file only rewrites the dirty slots in
+ * place, appends the records added since and patches the header count and
+ * checksum, so its cost grows with the number of changes instead of the
+ * number of records.
+ *
+ * A delta save is only possible while the list still matches the file
+ * slot by slot: once records were removed (which stops the tracking, so a
+ * record allocated where a removed one was is never taken for it) or the
+ * list was reordered, or the file was replaced by someone else,
+ * saveDataFileDelta() declines and the caller rewrites the whole file.
+ * Files with a key index (see datfile.h) get a new index after the
+ * records: appended records are merged into the old one, an edited key
+ * rebuilds it. Unlike a full save, a delta save changes the file in
+ * place; if it is interrupted, the checksum or size no longer match and
+ * the file is rejected on load instead of loading partly written records. The journal (see journal.h) is the crash-safe choice.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef DELTA_H
+#define DELTA_H
+
+#include "list.h"       // For the tracked lists
+#include "datfile.h"    // For data file headers
+
+/**
+ * @name Dirty Tracking Functions
+ * @brief Binding lists to file slots and marking changed records
+ * @{
+ */
+
+/**
+ * @brief Starts tracking a list that matches a data file slot by slot
+ *
+ * Called right after the list was loaded from the file, or saved to it
+ * in full, when record i of the list is record i of the file. Records
+ * that lie next to each other in memory, as loaded ones do, cost no
+ * memory to track; others take one pointer each. Any tracking the list
+ * had before is replaced.
+ *
+ * @param dataList The list
+ * @param path Path of the data file
+ * @param header Header of the data file
+ * @return 0 on success, -1 on error (the list is then not tracked)
+ */
+int trackDataFile(const list* dataList, const char* path, const DataFileHeader* header);
+
+/**
+ * @brief Marks a record as changed since the last save
+ *
+ * Called by the functions that edit records in place, such as
+ * updateEmployeeData(). Records of untracked lists and records added
+ * since the last save are ignored; the latter are saved anyway. Functions
+ * that remove records call untrackDataFile() instead.
+ *
+ * @param record The changed record
+ */
+void markRecordDirty(const void* record);
+
+/**
+ * @brief Stops tracking a list
+ * @param dataList The list (may be untracked)
+ */
+void untrackDataFile(const list* dataList);
+
+/**
+ * @brief Stops tracking all lists
+ */
+void untrackAllDataFiles(void);
+
+/** @} */ // End of Dirty Tracking Functions
+
+/**
+ * @name Delta Save Functions
+ * @brief Saving only the changed records
+ * @{
+ */
+
+/**
+ * @brief Saves a tracked list by rewriting only its changed records
+ *
+ * Dirty records are written over their slots with positioned writes,
+ * records added since the last save are appended, the key index of an
+ * indexed file is rewritten if records were added or a key changed, and
+ * the header count and checksum are updated last. The checksum is
+ * updated from the old and new bytes of the rewritten slots only (see
+ * crc32cReplace()).
+ *
+ * @param dataList The list
+ * @param path Path of the data file
+ * @return Number of records in the file, or -1 if a delta save is not
+ *         possible or failed (the caller should then write the whole file)
+ */
+int saveDataFileDelta(const list* dataList, const char* path);
+
+/** @} */ // End of Delta Save Functions
+
+#endif // DELTA_H
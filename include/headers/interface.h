@@ -4,6 +4,7 @@
 #include "apctxt.h"
 #include "state.h"
 #include "list.h"
+#include "sklist.h"
 #include "../models/employee.h"
 #include "../models/student.h"
 
@@ -36,6 +37,7 @@ typedef struct {
 typedef struct {
     list* employeeLists[10];  // Support up to 10 employee lists
     char employeeListNames[10][50];
+    bool employeeListModified[10]; // Changed since the list was last saved or autosaved
     int employeeListCount;
     int activeEmployeeList;
 } EmployeeManager;
@@ -43,13 +45,19 @@ typedef struct {
 typedef struct {
     list* studentLists[10];   // Support up to 10 student lists  
     char studentListNames[10][50];
+    bool studentListModified[10];  // Changed since the list was last saved or autosaved
     int studentListCount;
     int activeStudentList;
+    SkipList* gradeRankings[10]; // Students of each list kept ordered by final grade
 } StudentManager;
 
 extern EmployeeManager empManager;
 extern StudentManager stuManager;
 
+// Student ranking functions
+int rebuildStudentRanking(int listIndex);
+SkipList* getStudentRanking(const list* studentList);
+
 // State management functions
 void checkMenuStates(Menu* menu);
 void updateMenuOptionStates(Menu* menu, int hasActiveList, int hasItems, int hasMultipleLists);
@@ -0,0 +1,312 @@
+/**
+ * @file journal.h
+ * @brief Write-Ahead Journal for Data Files
+ *
+ * A journaled data file is a base file (see datfile.h) plus an
+ * append-only log "<base>.jnl" of the changes made since the base was
+ * written. Saving appends the pending changes to the log in one write
+ * and one sync (group commit), so its cost grows with the number of
+ * changes instead of the number of records. Loading replays the log on
+ * top of the base. Once the log grows past a fraction of the base, or the
+ * list was reordered, the next save compacts: it writes a new base and
+ * starts an empty log.
+ *
+ * The base file is only ever replaced by an atomic rename, so a crash
+ * during a save loses at most the changes of that save. Every log entry
+ * carries a sequence number and a CRC32C; replay stops at the first torn
+ * or corrupted entry. The log header stores the checksum of the base it
+ * belongs to, so a log left over from before a compaction is ignored.
+ *
+ * Changes are reported by the model functions that add, edit and remove
+ * records (createEmployee(), editEmployeeInList(), removeStudentFromList()
+ * and so on) through the journal*() hooks below. The hooks do nothing
+ * for lists without a journal.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdio.h>      // For FILE
+#include <stdint.h>     // For fixed-width log fields
+#include <stdbool.h>    // For boolean data type support
+#include "list.h"       // For the journaled lists
+#include "datfile.h"    // For data file headers
+
+/**
+ * @name Journal Constants
+ * @brief Log identification and compaction policy
+ *
+ * A log is compacted once it is larger than journalCompactMinBytes and
+ * larger than the base file divided by journalCompactRatio.
+ * @{
+ */
+#define journalMagic 0x4A505550u                // "PUPJ" in little-endian byte order
+#define journalVersion 1                        // Current log layout
+#define journalCompactMinBytes (256 * 1024)     // Logs smaller than this are never compacted
+#define journalCompactRatio 4                   // Compact when the log exceeds 1/ratio of the base
+
+/** @} */ // End of Journal Constants
+
+/**
+ * @enum JournalOp
+ * @brief Kind of change recorded by a log entry
+ */
+typedef enum {
+    JOURNAL_ADD = 1,    // A record was appended; the entry holds the whole record
+    JOURNAL_UPDATE,     // A record changed; the entry holds its old key and the changed bytes
+    JOURNAL_REMOVE      // A record was removed; the entry holds its key
+} JournalOp;
+
+/**
+ * @struct RecordFormat
+ * @brief Description of the records of a journaled file
+ *
+ * Records are identified by a NUL-terminated key field, such as the
+ * employee or student number.
+ */
+typedef struct RecordFormat {
+    uint32_t recordType;    // Data file record type (dataFileEmployees, ...)
+    size_t recordSize;      // Size of one record in bytes
+    size_t keyOffset;       // Offset of the key field in the record
+    size_t keyLength;       // Size of the key field in bytes
+    uint32_t fileOptions;   // Options of the base file when it is rewritten (dataFileCompressed, dataFileIndexed)
+} RecordFormat;
+
+/**
+ * @struct JournalHeader
+ * @brief Header at the start of a log file
+ */
+typedef struct JournalHeader {
+    uint32_t magic;         // journalMagic
+    uint16_t version;       // journalVersion
+    uint16_t headerSize;    // Size of this header in bytes
+    uint32_t recordType;    // Record type of the base file
+    uint32_t recordSize;    // Record size of the base file
+    uint32_t baseChecksum;  // Checksum of the base file this log applies to
+    uint32_t baseCount;     // Record count of the base file this log applies to
+    uint32_t reserved[2];   // Always 0
+} JournalHeader;
+
+/**
+ * @struct JournalEntry
+ * @brief Header of one log entry
+ *
+ * Followed by keyLength key bytes and length data bytes. The checksum
+ * covers everything after the checksum field, including key and data.
+ */
+typedef struct JournalEntry {
+    uint32_t checksum;      // CRC32C of the rest of the entry
+    uint32_t sequence;      // 1 for the first entry of the log, then increasing by 1
+    uint8_t op;             // JournalOp
+    uint8_t reserved;       // Always 0
+    uint16_t keyLength;     // Bytes of key after this header
+    uint32_t offset;        // Offset of the data in the record (UPDATE)
+    uint32_t length;        // Bytes of data after the key
+} JournalEntry;
+
+/**
+ * @struct JournalReplay
+ * @brief Where a replayed log ended, for appending to it afterwards
+ */
+typedef struct JournalReplay {
+    bool found;             // A log for this base was found and replayed
+    long validEnd;          // Offset just past the last valid entry
+    uint32_t nextSequence;  // Sequence number of the next entry
+    int applied;            // Number of entries replayed
+} JournalReplay;
+
+/**
+ * @name Journal Storage Functions
+ * @brief Loading, saving and compacting journaled files
+ * @{
+ */
+
+/**
+ * @brief Applies the log of a base file to its loaded records
+ *
+ * Called by the loaders after the base records were read and before
+ * they are linked into a list. Added records are malloc'd; removed base
+ * records are dropped from the array (they stay in the loader's block).
+ *
+ * @param basePath Path of the base data file
+ * @param base Header of the base file
+ * @param format Record format
+ * @param items In: the base records in file order. Out: the replayed records (may be reallocated)
+ * @param count In: number of base records. Out: number of replayed records
+ * @param replay Receives where the log ended
+ * @return 0 on success (also when there is no log), -1 on error
+ */
+int replayJournal(const char* basePath, const DataFileHeader* base, const RecordFormat* format,
+                  void*** items, size_t* count, JournalReplay* replay);
+
+/**
+ * @brief Applies the log of a base file to the records with one key
+ *
+ * Used to look up a record of a file that is not loaded: the caller finds
+ * the first base record with the key (see findDataFileKey()), and the log
+ * is replayed for that key alone. Replay can only follow one record, so
+ * it gives up when an update gives some record a key that might be this
+ * one, or when the first of several records with the key is removed.
+ *
+ * @param basePath Path of the base data file
+ * @param base Header of the base file
+ * @param format Record format
+ * @param key Key of the records (NUL-terminated)
+ * @param record In: the first base record with the key. Out: the first record with the key after replay
+ * @param matches In: number of base records with the key (0, 1, or 2 for two or more). Out: the same after replay
+ * @return 0 on success (also when there is no log), -1 if the log cannot be
+ *         replayed for one key or on error
+ */
+int replayJournalRecord(const char* basePath, const DataFileHeader* base, const RecordFormat* format,
+                        const char* key, void* record, size_t* matches);
+
+/**
+ * @brief Collects the keys of the base records a log updates or removes
+ *
+ * For readers that stream a base file instead of loading it, such as the
+ * external sort: only the base records with one of these keys can be
+ * changed by the log, so replayJournal() over just those records (in
+ * file order) gives the same result for them as a replay over the whole
+ * file. The log's added records are not included.
+ *
+ * @param basePath Path of the base data file
+ * @param base Header of the base file
+ * @param format Record format
+ * @param keys Receives the keys sorted by memcmp() and without repeats, each
+ *             zero-padded to format->keyLength bytes, to be released with
+ *             free() (NULL if there are none)
+ * @param count Receives the number of keys
+ * @return 1 if the base has a log, 0 if it has none, -1 on error
+ */
+int readJournalKeys(const char* basePath, const DataFileHeader* base, const RecordFormat* format,
+                    unsigned char** keys, size_t* count);
+
+/**
+ * @brief Starts journaling a list that was loaded from or saved to a base file
+ *
+ * Any journal the list had before is closed first (without committing).
+ *
+ * @param dataList The list
+ * @param basePath Path of the base data file
+ * @param format Record format
+ * @param base Header of the base file
+ * @param replay Result of replayJournal(), or NULL if the base has no log
+ * @return 0 on success, -1 on error
+ */
+int attachJournal(list* dataList, const char* basePath, const RecordFormat* format,
+                  const DataFileHeader* base, const JournalReplay* replay);
+
+/**
+ * @brief Saves a list as a journaled file
+ *
+ * If the list is journaled to basePath, its pending changes are appended
+ * to the log with one write and one sync, or the file is compacted when
+ * the policy says so. Otherwise the list is written as a new base file
+ * and journaled to it from now on.
+ *
+ * @param dataList The list
+ * @param basePath Path of the base data file
+ * @param format Record format
+ * @return Number of records in the saved list, or -1 on error
+ */
+int saveJournaledList(list* dataList, const char* basePath, const RecordFormat* format);
+
+/**
+ * @brief Writes a list's base file from scratch and empties its log
+ *
+ * @param dataList A journaled list
+ * @return Number of records written, or -1 on error (or if the list has no journal)
+ */
+int compactJournal(list* dataList);
+
+/**
+ * @brief Tells the journals of a base file that someone else replaced it
+ *
+ * Lists journaled to the file no longer append to its log, which would
+ * belong to the old base; their next save writes a new base instead.
+ *
+ * @param basePath Path of the base data file
+ */
+void journalBaseReplaced(const char* basePath);
+
+/**
+ * @brief Stops journaling a list and discards its uncommitted changes
+ *
+ * @param dataList The list (may have no journal)
+ */
+void detachJournal(const list* dataList);
+
+/**
+ * @brief Stops journaling all lists
+ */
+void detachAllJournals(void);
+
+/**
+ * @brief Returns the path of the log that belongs to a base file
+ *
+ * @param basePath Path of the base data file
+ * @param logPath Buffer for the log path
+ * @param size Size of the buffer
+ */
+void getJournalPath(const char* basePath, char* logPath, size_t size);
+
+/** @} */ // End of Journal Storage Functions
+
+/**
+ * @name Journal Change Hooks
+ * @brief Record changes of journaled lists
+ *
+ * Model functions call these after adding or editing and before removing
+ * a record. Entries are buffered until the next save.
+ * @{
+ */
+
+/**
+ * @brief Records that a record was appended to a list
+ * @param dataList The list
+ * @param record The new record
+ */
+void journalRecordAdded(const list* dataList, const void* record);
+
+/**
+ * @brief Records that a record of a list changed
+ * @param dataList The list
+ * @param before Copy of the record before the change
+ * @param after The record after the change
+ */
+void journalRecordUpdated(const list* dataList, const void* before, const void* after);
+
+/**
+ * @brief Records that a record is about to be removed from a list
+ * @param dataList The list
+ * @param record The record being removed
+ */
+void journalRecordRemoved(const list* dataList, const void* record);
+
+/**
+ * @brief Records that a list was reordered
+ *
+ * The log does not hold record order, so the next save compacts.
+ *
+ * @param dataList The list
+ */
+void journalListReordered(const list* dataList);
+
+/**
+ * @brief Makes the next save of a list write a new base file
+ *
+ * For changes that are cheaper to save as a new base than as one log
+ * entry each, such as a bulk import, or that bypass the other hooks.
+ * Entries buffered so far are dropped, since the new base holds them.
+ *
+ * @param dataList The list
+ */
+void journalForceCompaction(const list* dataList);
+
+/** @} */ // End of Journal Change Hooks
+
+#endif // JOURNAL_H
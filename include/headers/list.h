@@ -19,6 +19,7 @@
 #include <stdio.h>      // For standard I/O operations
 #include <stdlib.h>     // For memory allocation functions
 #include <stdbool.h>    // For boolean data type support
+#include <stddef.h>     // For size_t and offsetof in sort keys
 
 /**
  * @enum ListType
@@ -27,12 +28,28 @@
  * This enumeration specifies the various linking strategies available
  * for the linked list implementation. Each type has different performance
  * characteristics and use cases.
+ * 
+ * DYNAMIC_ARRAY keeps its nodes in a single contiguous buffer in list
+ * order. The nodes are still linked as a doubly circular list, so code
+ * that walks head/next keeps working, but scans touch memory sequentially
+ * and getNodeData() is O(1). Node addresses change when the buffer grows
+ * or a node is removed, so node pointers must not be kept across
+ * insertions or removals.
+ * 
+ * UNROLLED keeps its nodes in a chain of fixed-size blocks of
+ * unrolledBlockCapacity nodes each. Like DYNAMIC_ARRAY it is linked as a
+ * doubly circular list, so traversal reads consecutive memory, but
+ * appends never move existing nodes and a removal only shifts the nodes
+ * of one block. Node pointers inside the affected block (and the block
+ * merged into it) become invalid after a removal.
  */
 typedef enum { 
     SINGLY,           // Singly linked list (forward links only)
     DOUBLY,           // Doubly linked list (forward and backward links)
     SINGLY_CIRCULAR,  // Singly linked circular list (last node points to first)
-    DOUBLY_CIRCULAR   // Doubly linked circular list (bidirectional circular)
+    DOUBLY_CIRCULAR,  // Doubly linked circular list (bidirectional circular)
+    DYNAMIC_ARRAY,    // Nodes stored in one growable contiguous buffer (O(1) indexing)
+    UNROLLED          // Nodes stored in a chain of fixed-size blocks (unrolled list)
 } ListType;
 
 /**
@@ -41,14 +58,160 @@ typedef enum {
  * 
  * Represents a single node in the linked list. Contains pointers to
  * adjacent nodes and a void pointer to store data of any type.
- * The prev pointer is only used in doubly linked lists.
+ * The prev pointer is maintained for every list type (singly lists just
+ * never walk backwards) so that a node can be unlinked in O(1) through
+ * removeNodeByHandle().
  */
 typedef struct Node {
-    struct Node* prev;  // Pointer to previous node (NULL for singly linked)
+    struct Node* prev;  // Pointer to previous node (NULL for the head of a non-circular list)
     void* data;         // Pointer to the actual data stored in this node
     struct Node* next;  // Pointer to next node (NULL for end of list)
 } node;
 
+/**
+ * @name Node Storage Configuration
+ * @brief Sizing constants for the per-list node slab allocator and slot buffer
+ * 
+ * Nodes are carved out of slabs instead of being allocated one by one.
+ * The first slab holds nodePoolInitialSlab nodes and every following slab
+ * doubles in size up to nodePoolMaxSlab, so a 500k-record load needs only
+ * a few hundred allocations instead of half a million. DYNAMIC_ARRAY lists
+ * do not use the pool; their slot buffer starts at arrayListInitialCapacity
+ * and doubles whenever it is full. UNROLLED lists allocate one block of
+ * unrolledBlockCapacity nodes at a time.
+ * @{
+ */
+#define nodePoolInitialSlab 64      // Nodes in the first slab of a list
+#define nodePoolMaxSlab 8192        // Upper bound for the size of a single slab
+#define arrayListInitialCapacity 16 // First slot buffer size of a DYNAMIC_ARRAY list
+#define unrolledBlockCapacity 64    // Nodes per block of an UNROLLED list
+
+/** @} */ // End of Node Storage Configuration
+
+/**
+ * @name Sorting Configuration
+ * @brief Tuning constants for sortList() and sortListParallel()
+ * 
+ * Ranges of at most listSortInsertionThreshold items are finished with
+ * insertion sort, which beats both quicksort and merging on short runs.
+ * The parallel sort gives every thread at least listParallelSortMinRun
+ * items and samples listParallelSortSamples items per run to choose the
+ * merge partitions.
+ * @{
+ */
+#define listSortInsertionThreshold 16  // Largest range handled by insertion sort
+#define listSortMaxThreads 64           // Upper bound for the parallel sort thread count
+#define listParallelSortMinRun 8192     // Smallest run worth sorting on its own thread
+#define listParallelSortSamples 32      // Splitter candidates taken from every sorted run
+#define listSortMaxKeyBytes 128         // Largest packed key sortListByKeys() can radix sort
+
+/** @} */ // End of Sorting Configuration
+
+/**
+ * @struct NodeSlab
+ * @brief Contiguous block of nodes owned by a list's node pool
+ * 
+ * Slabs are chained together so the whole pool can be released in one
+ * pass. Nodes are handed out from the newest slab in order (bump
+ * allocation), which keeps consecutively added nodes adjacent in memory.
+ */
+typedef struct NodeSlab {
+    struct NodeSlab* next;  // Next (older) slab in the pool
+    int capacity;           // Number of nodes in this slab
+    int used;               // Number of nodes already handed out
+    node nodes[];           // Node storage (flexible array member)
+} NodeSlab;
+
+/**
+ * @struct NodePool
+ * @brief Per-list node allocator with a free list for recycled nodes
+ * 
+ * Removed nodes are pushed onto the free list (linked through their
+ * next pointer) and reused by later insertions before any new slab
+ * is allocated.
+ */
+typedef struct NodePool {
+    NodeSlab* slabs;    // Most recently allocated slab (head of slab chain)
+    node* freeList;     // Recycled nodes available for reuse
+    int nextSlabSize;   // Capacity to use for the next slab allocation
+} NodePool;
+
+/**
+ * @struct UnrolledBlock
+ * @brief Fixed-size block of nodes used by UNROLLED lists
+ * 
+ * The first count nodes of a block are in use and appear in list order.
+ * Blocks are chained in both directions; the block chain itself is not
+ * circular, only the node links are.
+ */
+typedef struct UnrolledBlock {
+    struct UnrolledBlock* prev;          // Previous block (NULL for the first block)
+    struct UnrolledBlock* next;          // Next block (NULL for the last block)
+    int count;                           // Number of nodes in use
+    node nodes[unrolledBlockCapacity];   // Node storage in list order
+} UnrolledBlock;
+
+/**
+ * @struct DataBlock
+ * @brief Block of record memory owned by a list
+ * 
+ * Bulk loaders read every record of a file into one allocation and hand
+ * it to the list with adoptDataBlock(). Records inside an owned block are
+ * never passed to the freeData callback; the whole block is released when
+ * the list is cleared or destroyed. Blocks that were not allocated with
+ * malloc(), such as file mappings, carry their own release function.
+ */
+typedef struct DataBlock {
+    struct DataBlock* next;                     // Next owned block
+    void* memory;                               // Start of the record memory
+    size_t size;                                // Size of the block in bytes
+    void (*release)(void* memory, size_t size); // Releases the block (NULL for free())
+} DataBlock;
+
+/**
+ * @struct SortItem
+ * @brief Entry of the contiguous array that sortList() sorts
+ * 
+ * Sorting moves these small entries instead of walking and relinking
+ * nodes, so every comparison reads two adjacent array slots.
+ */
+typedef struct SortItem {
+    void* data;     // Data pointer compared by the comparator
+    node* owner;    // Node that held the data before sorting
+} SortItem;
+
+/**
+ * @enum SortKeyType
+ * @brief Kind of record field a SortKey describes
+ */
+typedef enum {
+    SORT_KEY_STRING,    // Fixed-width, NUL-terminated character field (strcmp order)
+    SORT_KEY_FLOAT,     // float field (numeric order)
+    SORT_KEY_INT        // int or enum field (numeric order)
+} SortKeyType;
+
+/**
+ * @struct SortKey
+ * @brief Location and order of one key field inside a record
+ * 
+ * Keys are given by offset so the list stays independent of the record
+ * types, e.g. { SORT_KEY_STRING, offsetof(Employee, personal.employeeNumber),
+ * employeeNumberLen - 1, false }.
+ */
+typedef struct SortKey {
+    SortKeyType type;   // How the field is read and ordered
+    size_t offset;      // Byte offset of the field inside the record
+    int length;         // Characters compared for a string key (ignored for numbers)
+    bool descending;    // true to put the largest keys first
+} SortKey;
+
+/**
+ * @brief Hash index from the key field of every record of a list to its node
+ * 
+ * Private to the list functions; see findNodeByKey().
+ */
+typedef struct ListKeyIndex ListKeyIndex;
+
 /**
  * @struct LinkedList
  * @brief Main linked list structure
@@ -62,6 +225,13 @@ typedef struct LinkedList {
     ListType type;      // Type of linked list (singly, doubly, circular)
     struct Node* tail;  // Pointer to the last node in the list
     int size;           // Current number of nodes in the list
+    NodePool pool;      // Slab allocator that owns every node of this list
+    node* slots;        // Contiguous node buffer (DYNAMIC_ARRAY only)
+    int capacity;       // Number of nodes the slot buffer can hold (DYNAMIC_ARRAY only)
+    DataBlock* dataBlocks; // Record blocks owned by the list (bulk loads)
+    UnrolledBlock* firstBlock; // First node block (UNROLLED only)
+    UnrolledBlock* lastBlock;  // Last node block, where appends go (UNROLLED only)
+    ListKeyIndex* keyIndex;    // Hash from record keys to nodes (built by findNodeByKey)
 } list;
 
 /**
@@ -75,6 +245,8 @@ typedef struct LinkedList {
  * 
  * Creates a new node containing the provided data and adds it to the
  * end of the specified list. The linking behavior depends on the list type.
+ * The node is taken from the list's node pool, so recycled nodes are
+ * reused before any new memory is allocated.
  * 
  * @param l Double pointer to the list (allows modification of list pointer)
  * @param data Pointer to the data to store in the new node
@@ -82,6 +254,84 @@ typedef struct LinkedList {
  */
 int addNode(list** l, void* data);
 
+/**
+ * @brief Adds a new node to the end of the list and returns its handle
+ * 
+ * Works like addNode() but also hands back the node that now holds the
+ * data, for a caller that unlinks it again with removeNodeByHandle()
+ * before the list changes. A handle is not stable enough to be stored
+ * with the record: DYNAMIC_ARRAY slots move on every insertion or
+ * removal, sorts of DYNAMIC_ARRAY and UNROLLED lists move records
+ * between nodes, and skipListApplyOrder() does so for every list type.
+ * Code that needs a record's node later looks it up with
+ * findNodeByKey(), whose key index follows every such move.
+ * 
+ * @param l Double pointer to the list
+ * @param data Pointer to the data to store in the new node
+ * @param handle Receives the new node (may be NULL)
+ * @return 0 on success, non-zero on error
+ */
+int addNodeWithHandle(list** l, void* data, node** handle);
+
+/**
+ * @brief Removes a node previously returned as a handle
+ * 
+ * Unlinks the node in O(1) for SINGLY, DOUBLY, SINGLY_CIRCULAR and
+ * DOUBLY_CIRCULAR lists using the node's own prev/next pointers. For
+ * DYNAMIC_ARRAY lists the following slots are shifted down, which is O(n).
+ * For UNROLLED lists the owning block is located first (the last block is
+ * checked before walking the block chain) and only that block is shifted.
+ * 
+ * @param l Pointer to the list that owns the node
+ * @param handle Node to remove
+ * @param freeData Function pointer to free the node's data (may be NULL)
+ */
+void removeNodeByHandle(list* l, node* handle, void (*freeData)(void* data));
+
+/**
+ * @brief Finds the node that holds a specific data pointer
+ * 
+ * @param l Pointer to the list to search
+ * @param data Pointer to the data to look for (compared by address)
+ * @return The node holding the data, or NULL if not found
+ */
+node* findNodeByData(const list* l, const void* data);
+
+/**
+ * @brief Finds the first node whose record has a given key
+ * 
+ * The first call builds a hash index from the key field of every record
+ * to its node and keeps it in the list, so later lookups take O(1) on
+ * average instead of comparing every key. The index takes the place of
+ * a node handle stored with each record, which no list type keeps
+ * stable (see addNodeWithHandle()). Nodes added or removed through
+ * the list functions update the index as they go. Records that a sort
+ * moved to other nodes make the next lookup rebuild the index once. A
+ * DYNAMIC_ARRAY removal still shifts the later slots, so removing from
+ * an array-backed list stays O(n), but the key comparisons are gone.
+ * A record whose key field is changed in place must be followed by
+ * dropListKeyIndex(), since the index would not find it under its new key.
+ * 
+ * @param l Pointer to the list to search
+ * @param keyOffset Byte offset of the key field inside the record
+ * @param keyLength Size of the key field in bytes, including its terminator
+ * (at most listSortMaxKeyBytes)
+ * @param key Key to look for (NUL-terminated, compared like strcmp)
+ * @return The node holding the first record in list order with the key,
+ *         or NULL if no record has it
+ */
+node* findNodeByKey(list* l, size_t keyOffset, size_t keyLength, const char* key);
+
+/**
+ * @brief Frees the key index of a list
+ * 
+ * Called after a record's key field was changed in place. The next
+ * findNodeByKey() builds a new index.
+ * 
+ * @param l Pointer to the list
+ */
+void dropListKeyIndex(list* l);
+
 /**
  * @brief Removes a node containing specific data from the list
  * 
@@ -106,11 +356,28 @@ void removeNode(list* l, const void* data, void (*freeData)(void* data));
  */
 void* getNodeData(const list* l, int index);
 
+/**
+ * @brief Retrieves the node at a specific index
+ * 
+ * Returns the node itself so callers can continue walking the list from
+ * that position, e.g. to display one page of a table. The lookup is O(1)
+ * for DYNAMIC_ARRAY lists, skips whole blocks for UNROLLED lists and walks
+ * from the head for linked lists.
+ * 
+ * @param l Pointer to the list to search
+ * @param index 0-based index of the node to retrieve
+ * @return Pointer to the node, or NULL if the index is out of bounds
+ */
+node* getNode(const list* l, int index);
+
 /**
  * @brief Removes all nodes from the list without destroying the list structure
  * 
- * Clears all nodes from the list and frees their memory using the provided
- * function. The list structure itself remains valid and can be reused.
+ * Clears all nodes from the list and frees their data using the provided
+ * function. Node memory is returned by releasing the pool's slabs in one
+ * pass. Record blocks adopted with adoptDataBlock() are freed as a whole
+ * instead of record by record. The list structure itself remains valid
+ * and can be reused.
  * 
  * @param l Pointer to the list to clear
  * @param freeData Function pointer to properly free each node's data
@@ -130,6 +397,155 @@ void printList(const list* l, void (*printFunc)(const void* data));
 
 /** @} */ // End of Core List Operations
 
+/**
+ * @name Bulk Loading Functions
+ * @brief Functions for filling a list from a large batch of records
+ * @{
+ */
+
+/**
+ * @brief Appends many items to the end of the list in a single pass
+ * 
+ * All nodes are taken from one allocation: a single slab of exactly n
+ * nodes for linked lists, or one growth of the slot buffer for
+ * DYNAMIC_ARRAY lists. UNROLLED lists fill their blocks in order. The
+ * items are then linked in order without any further allocation.
+ * 
+ * @param l Pointer to the list to append to
+ * @param items Array of data pointers to store, in list order
+ * @param n Number of items in the array
+ * @return 0 on success, -1 on error (the list is left unchanged)
+ */
+int addNodesBulk(list* l, void** items, size_t n);
+
+/**
+ * @brief Transfers ownership of a block of record memory to the list
+ * 
+ * The block is freed together with the list. Removing or clearing a node
+ * whose data lies inside an owned block does not call freeData on it.
+ * 
+ * @param l Pointer to the list taking ownership
+ * @param memory Block allocated with malloc()
+ * @param size Size of the block in bytes
+ * @return 0 on success, -1 on error
+ */
+int adoptDataBlock(list* l, void* memory, size_t size);
+
+/**
+ * @brief Transfers ownership of record memory with its own release function
+ * 
+ * Like adoptDataBlock(), but the block is released by calling
+ * release(memory, size) instead of free(), e.g. to unmap a mapped file.
+ * 
+ * @param l Pointer to the list taking ownership
+ * @param memory Start of the block
+ * @param size Size of the block in bytes
+ * @param release Function that releases the block
+ * @return 0 on success, -1 on error
+ */
+int adoptExternalDataBlock(list* l, void* memory, size_t size, void (*release)(void* memory, size_t size));
+
+/**
+ * @brief Checks whether a data pointer lies inside a block owned by the list
+ * 
+ * @param l Pointer to the list
+ * @param data Data pointer to check
+ * @return true if the data belongs to one of the list's owned blocks
+ */
+bool isOwnedData(const list* l, const void* data);
+
+/** @} */ // End of Bulk Loading Functions
+
+/**
+ * @name Sorting Functions
+ * @brief Comparator-driven sorting for every list type
+ * @{
+ */
+
+/**
+ * @brief Sorts a list with a comparator
+ * 
+ * Copies the data pointers into a contiguous array, sorts the array and
+ * puts the list into the new order in one pass. Linked lists (including
+ * the circular ones) are relinked so every node stays with its data and
+ * node handles remain valid. DYNAMIC_ARRAY and UNROLLED lists keep their
+ * storage order and receive the data pointers in sorted order instead.
+ * 
+ * The unstable sort is an introsort (median-of-three quicksort that falls
+ * back to heap sort) and the stable sort is a top-down merge sort; both
+ * finish short ranges with insertion sort.
+ * 
+ * @param l Pointer to the list to sort
+ * @param compare Comparator with the same contract as the model compare functions
+ * @param stable true to keep nodes that compare equal in their current order
+ * @return 0 on success, -1 on invalid arguments or allocation failure
+ */
+int sortList(list* l, int (*compare)(const void*, const void*), bool stable);
+
+/**
+ * @brief Sorts a list using several threads
+ * 
+ * Gathers the data pointers like sortList(), splits the array into one
+ * contiguous run per thread and sorts the runs concurrently. The sorted
+ * runs are then cut at common splitters chosen from a sample of every
+ * run, and each thread k-way merges one output partition. Ties are
+ * resolved by run order, so a stable sort stays stable. Lists too small
+ * to give every thread listParallelSortMinRun items fall back to
+ * sortList().
+ * 
+ * @param l Pointer to the list to sort
+ * @param compare Comparator with the same contract as the model compare functions
+ * @param stable true to keep nodes that compare equal in their current order
+ * @param threadCount Number of threads to use (at most listSortMaxThreads)
+ * @return 0 on success, -1 on invalid arguments or allocation failure
+ */
+int sortListParallel(list* l, int (*compare)(const void*, const void*), bool stable, int threadCount);
+
+/**
+ * @brief Sorts a list by key fields with an LSD radix sort
+ * 
+ * Every record's key fields are packed into one fixed-width byte string
+ * that compares like the fields themselves: string keys keep their bytes
+ * (anything after the terminator counts as 0), int and float keys are
+ * mapped to order-preserving unsigned integers, and descending keys are
+ * inverted.
+ * The packed keys are then sorted one byte at a time from the last byte
+ * to the first, without calling a comparator. Byte positions where every
+ * key holds the same value are skipped.
+ * 
+ * Earlier keys take precedence and records with equal keys keep their
+ * order, so the result matches a stable sortList() with a comparator
+ * that compares the same fields in the same order. The list is put into
+ * its new order the same way as sortList().
+ * 
+ * @param l Pointer to the list to sort
+ * @param keys Key fields, most significant first
+ * @param keyCount Number of key fields (packed size at most listSortMaxKeyBytes)
+ * @return 0 on success, -1 on invalid arguments or allocation failure
+ */
+int sortListByKeys(list* l, const SortKey* keys, int keyCount);
+
+/**
+ * @brief Finds the k first elements of a list in comparator order
+ * 
+ * Scans the list once and keeps the best k elements seen so far in a
+ * bounded heap whose root is the weakest of them, so the list is never
+ * sorted or modified and the cost is O(n log k). Elements that compare
+ * equal are ranked by list position, which makes the result the same as
+ * the first k elements after a stable sort.
+ * 
+ * @param l Pointer to the list to scan
+ * @param compare Comparator; elements that sort first are the top ones
+ * @param filter Predicate an element must satisfy to be ranked (NULL to rank every element)
+ * @param k Maximum number of elements to return
+ * @param out Array with room for k data pointers, filled best first
+ * @return Number of elements written to out, or -1 on invalid arguments or allocation failure
+ */
+int selectTopItems(const list* l, int (*compare)(const void*, const void*), bool (*filter)(const void* data),
+                   int k, void** out);
+
+/** @} */ // End of Sorting Functions
+
 /**
  * @name List Management Functions
  * @brief Functions for creating and destroying lists
@@ -216,6 +632,281 @@ void linkNodeSinglyCircular(list** l, node* newNode);
  */
 void linkNodeDoublyCircular(list** l, node* newNode);
 
+/**
+ * @brief Checks whether a list type links its last node back to the first
+ * 
+ * DYNAMIC_ARRAY counts as circular since its nodes are linked as a
+ * doubly circular list.
+ * 
+ * @param type List type to check
+ * @return true if the tail's next pointer refers to the head
+ */
+bool isCircularListType(ListType type);
+
+/**
+ * @brief Returns the next free slot of a DYNAMIC_ARRAY list
+ * 
+ * Grows the slot buffer geometrically when it is full. If the buffer
+ * moves, every node is relinked so the list stays consistent.
+ * 
+ * @param l Pointer to the array-backed list
+ * @return Pointer to the slot at index l->size, or NULL on allocation failure
+ */
+node* acquireArraySlot(list* l);
+
+/**
+ * @brief Makes sure a DYNAMIC_ARRAY list can hold a number of extra slots
+ * 
+ * Grows the slot buffer at most once. Relinks the existing slots if the
+ * buffer moves.
+ * 
+ * @param l Pointer to the array-backed list
+ * @param extra Number of slots that will be appended
+ * @return 0 on success, -1 on allocation failure
+ */
+int reserveArraySlots(list* l, int extra);
+
+/**
+ * @brief Relinks the slots of a DYNAMIC_ARRAY list starting at an index
+ * 
+ * Rebuilds the prev/next pointers of every slot from the given index to
+ * the end of the buffer and refreshes the head and tail pointers. Used
+ * after the buffer is reallocated or slots are shifted.
+ * 
+ * @param l Pointer to the array-backed list
+ * @param from First slot index whose links must be rebuilt
+ */
+void relinkNodeArray(list* l, int from);
+
+/**
+ * @brief Returns the next free node at the end of an UNROLLED list
+ * 
+ * Uses the free space of the last block or appends a new block when the
+ * last one is full.
+ * 
+ * @param l Pointer to the unrolled list
+ * @return Pointer to an uninitialized node, or NULL on allocation failure
+ */
+node* acquireUnrolledNode(list* l);
+
+/**
+ * @brief Finds the block of an UNROLLED list that holds a node
+ * 
+ * @param l Pointer to the unrolled list
+ * @param n Node to look up
+ * @return The owning block, or NULL if the node is not part of the list
+ */
+UnrolledBlock* findUnrolledBlock(const list* l, const node* n);
+
+/**
+ * @brief Relinks the nodes of one block of an UNROLLED list
+ * 
+ * Rebuilds the links inside the block and to the neighbouring blocks
+ * (wrapping around at both ends) and refreshes the head and tail pointers.
+ * 
+ * @param l Pointer to the unrolled list
+ * @param block Block to relink (must hold at least one node)
+ */
+void relinkUnrolledBlock(list* l, UnrolledBlock* block);
+
+/**
+ * @brief Removes a node from an UNROLLED list
+ * 
+ * Shifts the rest of the block down, frees the block when it becomes
+ * empty and merges a block that drops below half full with its successor
+ * when both fit into one block.
+ * 
+ * @param l Pointer to the unrolled list
+ * @param block Block that holds the node
+ * @param n Node to remove
+ */
+void removeUnrolledNode(list* l, UnrolledBlock* block, node* n);
+
 /** @} */ // End of Internal Linking Functions
 
+/**
+ * @name Internal Key Index Functions
+ * @brief Keep the key index of findNodeByKey() in step with the nodes
+ * 
+ * Called by the list functions that add, remove or move nodes; they do
+ * nothing for lists without a key index.
+ * @{
+ */
+
+/**
+ * @brief Adds a node that was just linked into the list to its key index
+ * 
+ * @param l Pointer to the list
+ * @param n The new node
+ */
+void indexListNode(list* l, node* n);
+
+/**
+ * @brief Removes a node that is about to be unlinked from the key index
+ * 
+ * @param l Pointer to the list
+ * @param n The node, still holding its record
+ */
+void unindexListNode(list* l, node* n);
+
+/**
+ * @brief Counts a DYNAMIC_ARRAY slot removal for the key index
+ * 
+ * Called when a removal shifts the later slots of a DYNAMIC_ARRAY list
+ * down by one. The index keeps slot numbers rather than node addresses,
+ * so growing the buffer needs no call; a lookup looks for a record at
+ * most one slot lower per removal since it last found it.
+ * 
+ * @param l Pointer to the list
+ */
+void shiftListKeySlots(list* l);
+
+/**
+ * @brief Points the key index at the nodes of an UNROLLED block again
+ * 
+ * Called after the nodes of the block were shifted or merged into it.
+ * 
+ * @param l Pointer to the unrolled list
+ * @param block Block whose nodes moved
+ * @param first Index of the first node in the block that moved
+ */
+void reindexUnrolledBlock(list* l, UnrolledBlock* block, int first);
+
+/** @} */ // End of Internal Key Index Functions
+
+/**
+ * @name Internal Node Pool Functions
+ * @brief Slab allocator used by the list functions to manage node memory
+ * 
+ * These functions are called by addNode, removeNode, clearList and
+ * destroyList. User code should never allocate or free nodes directly.
+ * @{
+ */
+
+/**
+ * @brief Initializes an empty node pool
+ * 
+ * No memory is allocated until the first node is requested.
+ * 
+ * @param pool Pointer to the pool to initialize
+ */
+void initNodePool(NodePool* pool);
+
+/**
+ * @brief Takes a node from the pool
+ * 
+ * Reuses a recycled node if one is available, otherwise hands out the
+ * next unused node of the newest slab, allocating a new slab when the
+ * current one is exhausted.
+ * 
+ * @param pool Pointer to the pool to allocate from
+ * @return Pointer to an uninitialized node, or NULL on allocation failure
+ */
+node* acquirePoolNode(NodePool* pool);
+
+/**
+ * @brief Takes a run of adjacent nodes from the pool
+ * 
+ * The run is carved out of the newest slab when it has room, otherwise a
+ * dedicated slab of exactly count nodes is allocated. Used by
+ * addNodesBulk() so a large load costs a single allocation.
+ * 
+ * @param pool Pointer to the pool to allocate from
+ * @param count Number of nodes needed
+ * @return Pointer to the first of count uninitialized nodes, or NULL on allocation failure
+ */
+node* acquirePoolNodes(NodePool* pool, int count);
+
+/**
+ * @brief Returns a node to the pool for later reuse
+ * 
+ * @param pool Pointer to the pool that owns the node
+ * @param n Pointer to the node to recycle
+ */
+void releasePoolNode(NodePool* pool, node* n);
+
+/**
+ * @brief Releases every slab owned by the pool at once
+ * 
+ * All nodes handed out by the pool become invalid. The pool is left
+ * empty and can be used again.
+ * 
+ * @param pool Pointer to the pool to release
+ */
+void freeNodePool(NodePool* pool);
+
+/** @} */ // End of Internal Node Pool Functions
+
+/**
+ * @name Internal Sorting Functions
+ * @brief Building blocks of sortList(), shared with other sort drivers
+ * @{
+ */
+
+/**
+ * @brief Copies a list's data pointers and their nodes into an array
+ * 
+ * @param l Pointer to a non-empty list
+ * @return Newly allocated array of l->size items in list order, or NULL on allocation failure
+ */
+SortItem* gatherSortItems(const list* l);
+
+/**
+ * @brief Sorts an array of items by their data
+ * 
+ * @param items Items to sort
+ * @param count Number of items
+ * @param compare Comparator applied to the items' data
+ * @param stable true for a stable merge sort, false for introsort
+ * @return 0 on success, -1 on allocation failure
+ */
+int sortItems(SortItem* items, int count, int (*compare)(const void*, const void*), bool stable);
+
+/**
+ * @brief Puts a list into the order of a sorted item array
+ * 
+ * @param l Pointer to the list the items were gathered from
+ * @param items Sorted items (exactly l->size of them)
+ */
+void applySortItems(list* l, const SortItem* items);
+
+/**
+ * @brief Radix sorts an array of items by key fields of their data
+ * 
+ * Used by sortListByKeys() and by callers that need a sorted view of a
+ * list without reordering it.
+ * 
+ * @param items Items to sort
+ * @param count Number of items
+ * @param keys Key fields, most significant first
+ * @param keyCount Number of key fields
+ * @return 0 on success, -1 on invalid keys or allocation failure
+ */
+int sortItemsByKeys(SortItem* items, int count, const SortKey* keys, int keyCount);
+
+/**
+ * @brief Returns the size of the packed key built from a set of key fields
+ * 
+ * @param keys Key fields, most significant first
+ * @param keyCount Number of key fields
+ * @return Packed key size in bytes, or -1 if the keys are invalid or exceed listSortMaxKeyBytes
+ */
+int packedSortKeySize(const SortKey* keys, int keyCount);
+
+/**
+ * @brief Packs the key fields of one record into a byte string
+ * 
+ * Two packed keys compare with memcmp() exactly like the records compare
+ * on the key fields, which lets callers outside the list (such as file
+ * merges) order records without a comparator.
+ * 
+ * @param record Record to read the key fields from
+ * @param keys Valid key fields, most significant first
+ * @param keyCount Number of key fields
+ * @param out Destination with room for packedSortKeySize() bytes
+ */
+void packSortKey(const void* record, const SortKey* keys, int keyCount, unsigned char* out);
+
+/** @} */ // End of Internal Sorting Functions
+
 #endif // LIST_H
\ No newline at end of file
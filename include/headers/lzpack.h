@@ -0,0 +1,79 @@
+/**
+ * @file lzpack.h
+ * @brief Fast LZ Block Compression
+ *
+ * A small LZ77 codec for compressing data file blocks without an external
+ * library. Data is encoded as a sequence of literal runs and back
+ * references of at least lzpackMinMatch bytes up to lzpackMaxOffset bytes
+ * back. Long runs of the same byte, such as the zero padding of fixed-size
+ * name fields, become a single reference to the byte before. Blocks are
+ * compressed independently, so any block can be decompressed on its own.
+ *
+ * Sequence layout:
+ * - Token byte: literal count in the high 4 bits, match length minus
+ *   lzpackMinMatch in the low 4 bits (15 means more length bytes follow)
+ * - More literal count bytes (each adds up to 255; 255 means another follows)
+ * - The literals
+ * - Match offset (2 bytes, little-endian), then more match length bytes
+ *
+ * The last sequence of a block has literals only and ends the input.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef LZPACK_H
+#define LZPACK_H
+
+#include <stddef.h>     // For size_t
+
+/**
+ * @name LZ Codec Constants
+ * @brief Limits of the sequence format
+ * @{
+ */
+#define lzpackMinMatch 4                // Shortest back reference in bytes
+#define lzpackMaxOffset 65535           // Farthest back reference in bytes
+#define lzpackHashBits 14               // Log2 of the match finder's table size
+
+/** @} */ // End of LZ Codec Constants
+
+/**
+ * @name LZ Codec Functions
+ * @brief Compressing and decompressing blocks
+ * @{
+ */
+
+/**
+ * @brief Compresses a block
+ *
+ * Greedy single-pass match finding with a hash table of recent 4-byte
+ * sequences; the speed matters more than the last few percent of ratio.
+ *
+ * @param source Data to compress
+ * @param sourceSize Size of the data in bytes
+ * @param destination Buffer for the compressed data
+ * @param capacity Size of the buffer in bytes
+ * @return Size of the compressed data, or 0 if it does not fit in capacity
+ *         (callers store such blocks uncompressed)
+ */
+size_t lzpackCompress(const void* source, size_t sourceSize, void* destination, size_t capacity);
+
+/**
+ * @brief Decompresses a block
+ *
+ * Every length and offset is checked against the buffers, so corrupted
+ * input is rejected instead of reading or writing out of bounds.
+ *
+ * @param source Compressed data
+ * @param sourceSize Size of the compressed data in bytes
+ * @param destination Buffer for the decompressed data
+ * @param size Exact size of the decompressed data in bytes
+ * @return 0 if the input decompressed to exactly size bytes, -1 otherwise
+ */
+int lzpackDecompress(const void* source, size_t sourceSize, void* destination, size_t size);
+
+/** @} */ // End of LZ Codec Functions
+
+#endif // LZPACK_H
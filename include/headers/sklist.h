@@ -0,0 +1,192 @@
+/**
+ * @file sklist.h
+ * @brief Ordered Skip List Container
+ *
+ * This header provides a generic skip list that keeps its elements sorted
+ * by a caller-supplied comparator, such as compareEmployeeByNumber(),
+ * compareEmployeeByName() or compareStudentByGrade(). Insertion, removal
+ * and lookup by position all take O(log n) expected time, so rankings and
+ * sorted views stay available without re-sorting the underlying list.
+ *
+ * The skip list only stores pointers. It never owns the records unless a
+ * freeData function is passed to destroySkipList().
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef SKLIST_H
+#define SKLIST_H
+
+#include <stdio.h>      // For standard I/O operations
+#include <stdlib.h>     // For memory allocation functions
+#include <stdbool.h>    // For boolean data type support
+#include "list.h"       // For writing the sorted order back into a list
+
+/**
+ * @name Skip List Configuration
+ * @brief Sizing constants for the skip list levels
+ *
+ * Each node is promoted to the next level with probability 1/4, so
+ * skipListMaxLevel levels are enough for far more records than the
+ * system will ever hold.
+ * @{
+ */
+#define skipListMaxLevel 24         // Highest level a node can reach
+#define skipListPromoteChance 4     // A node is promoted with probability 1/skipListPromoteChance
+
+/** @} */ // End of Skip List Configuration
+
+/**
+ * @brief Comparator used to order the elements of a skip list
+ *
+ * Same contract as the compare functions of the models: negative if the
+ * first element sorts before the second, 0 if they are equal, positive
+ * otherwise.
+ */
+typedef int (*SkipListCompare)(const void* a, const void* b);
+
+/**
+ * @struct SkipLink
+ * @brief Forward link of a skip node on one level
+ *
+ * The span counts how many level-0 steps the link skips, which lets the
+ * list find the element at a given rank in O(log n).
+ */
+typedef struct SkipLink {
+    struct SkipNode* next;  // Next node on this level (NULL at the end)
+    int span;               // Number of elements skipped by this link
+} SkipLink;
+
+/**
+ * @struct SkipNode
+ * @brief Element of a skip list
+ *
+ * Holds the data pointer and one forward link per level the node
+ * takes part in.
+ */
+typedef struct SkipNode {
+    void* data;             // Pointer to the stored element
+    int level;              // Number of levels (links) of this node
+    SkipLink links[];       // Forward links, one per level (flexible array member)
+} SkipNode;
+
+/**
+ * @struct SkipList
+ * @brief Ordered container of data pointers
+ *
+ * Elements that compare equal are kept in a fixed order (by address) so
+ * that every element has a unique position and can be removed exactly.
+ */
+typedef struct SkipList {
+    SkipNode* header;           // Sentinel node with skipListMaxLevel links
+    int level;                  // Number of levels currently in use
+    int size;                   // Number of elements in the list
+    SkipListCompare compare;    // Ordering of the elements
+    unsigned int seed;          // State of the level generator
+} SkipList;
+
+/**
+ * @name Skip List Management Functions
+ * @brief Functions for creating and destroying skip lists
+ * @{
+ */
+
+/**
+ * @brief Creates an empty skip list ordered by the given comparator
+ *
+ * @param sl Double pointer to store the new skip list
+ * @param compare Comparator that defines the order of the elements
+ * @return 0 on success, -1 on error
+ */
+int createSkipList(SkipList** sl, SkipListCompare compare);
+
+/**
+ * @brief Destroys a skip list and optionally the elements it holds
+ *
+ * Sets the skip list pointer to NULL to prevent dangling pointer issues.
+ *
+ * @param sl Double pointer to the skip list to destroy
+ * @param freeData Function used to free each element (NULL to keep the elements)
+ */
+void destroySkipList(SkipList** sl, void (*freeData)(void* data));
+
+/** @} */ // End of Skip List Management Functions
+
+/**
+ * @name Skip List Operations
+ * @brief Ordered insertion, removal and lookup
+ *
+ * To change the key of an element that is already in the list, remove it
+ * first, modify it, then insert it again.
+ * @{
+ */
+
+/**
+ * @brief Inserts an element at its sorted position
+ *
+ * @param sl Pointer to the skip list
+ * @param data Pointer to the element to insert
+ * @return 0 on success, -1 on error
+ */
+int skipListInsert(SkipList* sl, void* data);
+
+/**
+ * @brief Removes an element from the skip list
+ *
+ * The element is located by its current key and matched by address, so
+ * it must not have been modified since it was inserted.
+ *
+ * @param sl Pointer to the skip list
+ * @param data Pointer to the element to remove
+ * @return 0 if the element was removed, -1 if it was not found
+ */
+int skipListRemove(SkipList* sl, const void* data);
+
+/**
+ * @brief Finds the first element that compares equal to a key
+ *
+ * @param sl Pointer to the skip list
+ * @param key Element-shaped key understood by the comparator
+ * @return Pointer to the matching element, or NULL if none matches
+ */
+void* skipListFind(const SkipList* sl, const void* key);
+
+/**
+ * @brief Returns the element at a 0-based position in sorted order
+ *
+ * @param sl Pointer to the skip list
+ * @param index Position of the element (0 is the first in order)
+ * @return Pointer to the element, or NULL if the index is out of bounds
+ */
+void* skipListGet(const SkipList* sl, int index);
+
+/**
+ * @brief Returns the first node in sorted order
+ *
+ * Continue with node->links[0].next to walk the elements in order.
+ *
+ * @param sl Pointer to the skip list
+ * @return Pointer to the first node, or NULL if the list is empty
+ */
+SkipNode* skipListFirst(const SkipList* sl);
+
+/**
+ * @brief Writes the sorted order into an existing list
+ *
+ * Stores the elements in sorted order into the nodes of the list, walking
+ * the list from its head. Only the data pointers change, so this works for
+ * every list type and costs O(n) without any comparisons. Records move to
+ * other nodes, so node handles no longer point at their records; the key
+ * index of findNodeByKey() is rebuilt on its next lookup.
+ *
+ * @param sl Pointer to the skip list
+ * @param l List holding the same elements (sizes must match)
+ * @return 0 on success, -1 if the sizes differ
+ */
+int skipListApplyOrder(const SkipList* sl, list* l);
+
+/** @} */ // End of Skip List Operations
+
+#endif // SKLIST_H
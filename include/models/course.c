@@ -5,6 +5,7 @@
 #include "course.h"
 #include "../headers/list.h"
 #include "../headers/apctxt.h"
+#include "../headers/datfile.h"
 
 /**
  * @brief Creates a new course catalog
@@ -269,53 +270,48 @@ int saveCatalog(const CourseCatalog* catalog, const char* filename) {
     // Create data directory if it doesn't exist
     appCreateDirectory("data");
     
-    // Construct the full path
+    // Construct the full path; the catalog is written beside it and renamed into place
     char fullPath[256];
+    char savingPath[300];
     snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
+    snprintf(savingPath, sizeof(savingPath), "%s.saving.tmp", fullPath);
     
     // Open the file for writing
-    FILE* file = fopen(fullPath, "wb");
+    FILE* file = fopen(savingPath, "wb");
     if (!file) {
         return -1;
     }
     
-    // Write catalog name
-    fwrite(catalog->catalogName, sizeof(catalog->catalogName), 1, file);
-    
-    // Write number of courses
-    int count = catalog->courseList->size;
-    fwrite(&count, sizeof(int), 1, file);
+    // Reserve the header; the count and checksum are filled in at the end
+    DataFileHeader header;
+    initDataFileHeader(&header, dataFileCourses, sizeof(Course), sizeof(catalog->catalogName));
+    bool ok = writeDataFileHeader(file, &header) == 0 &&
+              fwrite(catalog->catalogName, sizeof(catalog->catalogName), 1, file) == 1;
+    uint32_t checksum = crc32c(0, catalog->catalogName, sizeof(catalog->catalogName));
     
     // Write each course
+    int count = catalog->courseList->size;
     node* current = catalog->courseList->head;
     int saved = 0;
-    
-    if (catalog->courseList->type == SINGLY || catalog->courseList->type == DOUBLY) {
-        // Non-circular list
-        while (current) {
-            Course* course = (Course*)current->data;
-            if (course) {
-                fwrite(course, sizeof(Course), 1, file);
-                saved++;
-            }
-            current = current->next;
-        }
-    } else {
-        // Circular list
-        if (current) {
-            do {
-                Course* course = (Course*)current->data;
-                if (course) {
-                    fwrite(course, sizeof(Course), 1, file);
-                    saved++;
-                }
-                current = current->next;
-            } while (current != catalog->courseList->head);
+    for (int i = 0; i < count && current && ok; i++, current = current->next) {
+        Course* course = (Course*)current->data;
+        if (course) {
+            ok = fwrite(course, sizeof(Course), 1, file) == 1;
+            checksum = crc32c(checksum, course, sizeof(Course));
+            saved++;
         }
     }
     
-    fclose(file);
-    return (saved == count) ? 0 : -1;
+    header.recordCount = (uint32_t)saved;
+    header.checksum = checksum;
+    ok = ok && saved == count && writeDataFileHeader(file, &header) == 0 && syncDataFile(file) == 0;
+    
+    // A failed save leaves the previous catalog file untouched
+    if (fclose(file) != 0 || !ok) {
+        remove(savingPath);
+        return -1;
+    }
+    return replaceDataFile(savingPath, fullPath);
 }
 
 /**
@@ -348,43 +344,53 @@ int loadCatalog(CourseCatalog* catalog, const char* filename) {
         return -1;
     }
     
-    // Read catalog name
-    if (fread(catalog->catalogName, sizeof(catalog->catalogName), 1, file) != 1) {
-        fclose(file);
-        destroyCourseCatalog(catalog);
-        return -1;
-    }
-    
-    // Read number of courses
-    int count;
-    if (fread(&count, sizeof(int), 1, file) != 1) {
+    // Validate the header and read the catalog name before allocating the courses
+    DataFileHeader header;
+    if (readDataFileHeader(file, dataFileCourses, sizeof(Course), catalog->catalogName,
+                           sizeof(catalog->catalogName), &header) != 0) {
         fclose(file);
         destroyCourseCatalog(catalog);
         return -1;
     }
+    uint32_t checksum = crc32c(0, catalog->catalogName, sizeof(catalog->catalogName));
+    catalog->catalogName[sizeof(catalog->catalogName) - 1] = '\0';
     
-    // Read each course
-    for (int i = 0; i < count; i++) {
-        Course* course = (Course*)malloc(sizeof(Course));
-        if (!course) {
-            fclose(file);
-            destroyCourseCatalog(catalog);
-            return -1;
-        }
+    // Read all courses into one block owned by the list and link them in one pass
+    size_t count = header.recordCount;
+    if (count > 0) {
+        Course* courses = (Course*)malloc(count * sizeof(Course));
+        void** items = (void**)malloc(count * sizeof(void*));
         
-        if (fread(course, sizeof(Course), 1, file) != 1) {
-            free(course);
+        DataFileReader reader;
+        bool ok = courses && items && initDataFileReader(&reader, file, &header) == 0;
+        if (ok) {
+            ok = readDataFileRecords(&reader, courses, count) == 0;
+            closeDataFileReader(&reader);
+        }
+        if (!ok ||
+            verifyDataFileChecksum(&header, crc32c(checksum, courses, count * sizeof(Course))) != 0 ||
+            adoptDataBlock(catalog->courseList, courses, count * sizeof(Course)) != 0) {
+            free(courses);
+            free(items);
             fclose(file);
             destroyCourseCatalog(catalog);
             return -1;
         }
         
-        if (addNode(&catalog->courseList, course) != 0) {
-            free(course);
+        for (size_t i = 0; i < count; i++) {
+            items[i] = &courses[i];
+        }
+        int result = addNodesBulk(catalog->courseList, items, count);
+        free(items);
+        if (result != 0) {
             fclose(file);
             destroyCourseCatalog(catalog);
             return -1;
         }
+    } else if (verifyDataFileChecksum(&header, checksum) != 0) {
+        fclose(file);
+        destroyCourseCatalog(catalog);
+        return -1;
     }
     
     catalog->isModified = false;
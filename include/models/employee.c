@@ -1,5 +1,7 @@
 #include "employee.h"
 #include "../headers/list.h"
+#include "../headers/journal.h"
+#include "../headers/delta.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,7 +12,17 @@
  * @return Returns 0 on success, -1 on failure.
  */
 int createEmployeeList(list** employeeList) {
-    if (createList(employeeList, SINGLY) != 0) {
+    return createEmployeeListOfType(employeeList, SINGLY);
+}
+
+/**
+ * @brief Creates a new, empty employee list using a specific list type.
+ * @param employeeList A double pointer to the list structure to be created.
+ * @param listType The list type to use (e.g., DYNAMIC_ARRAY for large lists).
+ * @return Returns 0 on success, -1 on failure.
+ */
+int createEmployeeListOfType(list** employeeList, ListType listType) {
+    if (createList(employeeList, listType) != 0) {
         return -1;
     }
     return 0;
@@ -26,6 +38,7 @@ int createEmployee(Employee* newEmployeeData, list** l) {
     if (addNode(l, newEmployeeData) != 0) {
         return -1;
     }
+    journalRecordAdded(*l, newEmployeeData);
     return 0;
 }
 
@@ -75,9 +88,11 @@ int composeEmployeeName(EmployeeName* name) {
 
     // Format 1: "Last, First" format (most compact)
     if ((lnLen + fnLen + 3) < employeeNameLen) { // +3 for ", " and null
-        snprintf(name->fullName, employeeNameLen, "%.*s, %.*s", 
-                (int)lnLen, name->lastName,
-                (int)fnLen, name->firstName);
+        // Copied directly rather than formatted, since bulk imports compose a name per row
+        memcpy(name->fullName, name->lastName, lnLen);
+        memcpy(name->fullName + lnLen, ", ", 2);
+        memcpy(name->fullName + lnLen + 2, name->firstName, fnLen);
+        name->fullName[lnLen + 2 + fnLen] = '\0';
         return 1;
     }
     
@@ -100,27 +115,25 @@ int composeEmployeeName(EmployeeName* name) {
     return 0;
 }
 
+/**
+ * @brief Finds the node of an employee through the list's key index.
+ * @param employeeList Pointer to the employee list.
+ * @param employeeNumber The employee number to look for.
+ * @return The node if found, NULL otherwise.
+ */
+static node* findEmployeeNode(list* employeeList, const char* employeeNumber) {
+    return findNodeByKey(employeeList, offsetof(Employee, personal.employeeNumber), employeeNumberLen, employeeNumber);
+}
+
 /**
  * @brief Searches for an employee by employee number.
  * @param employeeList Pointer to the employee list.
  * @param employeeNumber The employee number to search for.
  * @return Pointer to the Employee if found, NULL otherwise.
  */
-Employee* searchEmployeeByNumber(const list* employeeList, const char* employeeNumber) {
-    if (!employeeList || !employeeList->head || !employeeNumber) {
-        return NULL;
-    }
-
-    node* current = employeeList->head;
-    do {
-        Employee* emp = (Employee*)current->data;
-        if (emp && strcmp(emp->personal.employeeNumber, employeeNumber) == 0) {
-            return emp;
-        }
-        current = current->next;
-    } while (current != employeeList->head);
-
-    return NULL;
+Employee* searchEmployeeByNumber(list* employeeList, const char* employeeNumber) {
+    node* found = findEmployeeNode(employeeList, employeeNumber);
+    return found ? (Employee*)found->data : NULL;
 }
 
 /**
@@ -185,6 +198,7 @@ int updateEmployeeData(Employee* employee, const Employee* newData) {
     // Copy new data, preserving original payroll calculations
     memcpy(&employee->personal, &newData->personal, sizeof(PersonalInfo));
     memcpy(&employee->employment, &newData->employment, sizeof(EmploymentInfo));
+    markRecordDirty(employee);
     
     return 0;
 }
@@ -197,12 +211,21 @@ int updateEmployeeData(Employee* employee, const Employee* newData) {
  * @return 0 on success, -1 on failure.
  */
 int editEmployeeInList(list* employeeList, const char* employeeNumber, const Employee* newData) {
-    Employee* employee = searchEmployeeByNumber(employeeList, employeeNumber);
-    if (!employee) {
+    node* employeeNode = findEmployeeNode(employeeList, employeeNumber);
+    if (!employeeNode) {
         return -1; // Employee not found
     }
 
-    return updateEmployeeData(employee, newData);
+    Employee* employee = (Employee*)employeeNode->data;
+    Employee before = *employee;
+    if (updateEmployeeData(employee, newData) != 0) {
+        return -1;
+    }
+    if (strcmp(before.personal.employeeNumber, employee->personal.employeeNumber) != 0) {
+        dropListKeyIndex(employeeList); // The index would not find the record under its new number
+    }
+    journalRecordUpdated(employeeList, &before, employee);
+    return 0;
 }
 
 /**
@@ -216,13 +239,16 @@ int removeEmployeeFromList(list* employeeList, const char* employeeNumber) {
         return -1;
     }
 
-    Employee* employee = searchEmployeeByNumber(employeeList, employeeNumber);
-    if (!employee) {
+    node* employeeNode = findEmployeeNode(employeeList, employeeNumber);
+    if (!employeeNode) {
         return -1; // Employee not found
     }
 
-    // Use the list library's removeNode function
-    removeNode(employeeList, employee, freeEmployee);
+    // The list's key index finds the node without a scan, and the handle unlinks it. Later slots
+    // shift and the freed address may be reused, so the list no longer matches its file slot by slot
+    journalRecordRemoved(employeeList, employeeNode->data);
+    untrackDataFile(employeeList);
+    removeNodeByHandle(employeeList, employeeNode, freeEmployee);
     return 0;
 }
 
@@ -453,4 +479,119 @@ int compareEmployeeByName(const void* emp1, const void* emp2) {
     const Employee* e2 = (const Employee*)emp2;
     
     return strcmp(e1->personal.name.fullName, e2->personal.name.fullName);
+}
+
+/**
+ * @brief Compares two employees by net pay (highest first).
+ * @param emp1 Pointer to the first employee.
+ * @param emp2 Pointer to the second employee.
+ * @return Negative if emp1 earns more than emp2, 0 if equal, positive otherwise.
+ */
+int compareEmployeeByNetPay(const void* emp1, const void* emp2) {
+    if (!emp1 || !emp2) {
+        return 0;
+    }
+
+    const Employee* e1 = (const Employee*)emp1;
+    const Employee* e2 = (const Employee*)emp2;
+
+    if (e1->payroll.netPay != e2->payroll.netPay) {
+        return (e1->payroll.netPay > e2->payroll.netPay) ? -1 : 1;
+    }
+    return strcmp(e1->personal.employeeNumber, e2->personal.employeeNumber);
+}
+
+/**
+ * @brief Finds the employees with the highest net pay.
+ * @param employeeList A const pointer to the employee list.
+ * @param k The maximum number of employees to return.
+ * @param topEarners The array that receives the employees, highest net pay first.
+ * @return The number of employees found, or -1 on failure.
+ */
+int findTopEarners(const list* employeeList, int k, Employee** topEarners) {
+    return selectTopItems(employeeList, compareEmployeeByNetPay, NULL, k, (void**)topEarners);
+}
+
+/**
+ * @brief Translates an employee sort specification into sort keys.
+ * @param spec The fields to order by, most significant first.
+ * @param specCount The number of fields.
+ * @param keys The output array of sort keys.
+ * @return Returns 0 on success, -1 on an invalid specification.
+ */
+int compileEmployeeSortKeys(const EmployeeSortSpec* spec, int specCount, SortKey* keys) {
+    if (!spec || !keys || specCount <= 0 || specCount > employeeSortMaxFields) {
+        return -1;
+    }
+
+    for (int i = 0; i < specCount; i++) {
+        SortKey* key = &keys[i];
+        key->descending = spec[i].descending;
+        key->length = 0;
+        switch (spec[i].field) {
+            case EMPLOYEE_SORT_NUMBER:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Employee, personal.employeeNumber);
+                key->length = employeeNumberLen - 1;
+                break;
+            case EMPLOYEE_SORT_LAST_NAME:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Employee, personal.name.lastName);
+                key->length = employeeLastNameLen - 1;
+                break;
+            case EMPLOYEE_SORT_FIRST_NAME:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Employee, personal.name.firstName);
+                key->length = employeeFirstNameLen - 1;
+                break;
+            case EMPLOYEE_SORT_STATUS:
+                key->type = SORT_KEY_INT;
+                key->offset = offsetof(Employee, employment.status);
+                break;
+            case EMPLOYEE_SORT_HOURS_WORKED:
+                key->type = SORT_KEY_INT;
+                key->offset = offsetof(Employee, employment.hoursWorked);
+                break;
+            case EMPLOYEE_SORT_BASIC_RATE:
+                key->type = SORT_KEY_FLOAT;
+                key->offset = offsetof(Employee, employment.basicRate);
+                break;
+            case EMPLOYEE_SORT_NET_PAY:
+                key->type = SORT_KEY_FLOAT;
+                key->offset = offsetof(Employee, payroll.netPay);
+                break;
+            default:
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Sorts an employee list by a multi-key specification.
+ * @param employeeList A pointer to the employee list.
+ * @param spec The fields to order by, most significant first.
+ * @param specCount The number of fields.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int sortEmployeesBySpec(list* employeeList, const EmployeeSortSpec* spec, int specCount) {
+    SortKey keys[employeeSortMaxFields];
+    if (compileEmployeeSortKeys(spec, specCount, keys) != 0) {
+        return -1;
+    }
+    if (sortListByKeys(employeeList, keys, specCount) != 0) {
+        return -1;
+    }
+    journalListReordered(employeeList);
+    return 0;
+}
+
+/**
+ * @brief Sorts an employee list by employee number with a radix sort.
+ * @param employeeList A pointer to the employee list.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int sortEmployeesByNumber(list* employeeList) {
+    EmployeeSortSpec byNumber = { EMPLOYEE_SORT_NUMBER, false };
+    return sortEmployeesBySpec(employeeList, &byNumber, 1);
 }
\ No newline at end of file
@@ -38,6 +38,7 @@ typedef struct AppContext AppContext;
 #define employeeLastNameLen 32      // Last name: 31 characters + null terminator
 #define maxEmployeeCreationCount 5  // Maximum employees that can be created in one batch
 #define maxEmployeeRecords 50       // Maximum total employee records in system
+#define employeeSortMaxFields 8     // Maximum fields in one EmployeeSortSpec array
 
 /** @} */ // End of Employee Data Structure Size Constants
 
@@ -141,6 +142,29 @@ typedef struct {
     PayrollInfo payroll;        // Calculated payroll information
 } Employee;
 
+/**
+ * @enum EmployeeSortField
+ * @brief Employee fields that can be used as sort keys
+ */
+typedef enum {
+    EMPLOYEE_SORT_NUMBER,       // personal.employeeNumber
+    EMPLOYEE_SORT_LAST_NAME,    // personal.name.lastName
+    EMPLOYEE_SORT_FIRST_NAME,   // personal.name.firstName
+    EMPLOYEE_SORT_STATUS,       // employment.status
+    EMPLOYEE_SORT_HOURS_WORKED, // employment.hoursWorked
+    EMPLOYEE_SORT_BASIC_RATE,   // employment.basicRate
+    EMPLOYEE_SORT_NET_PAY       // payroll.netPay
+} EmployeeSortField;
+
+/**
+ * @struct EmployeeSortSpec
+ * @brief One field and direction of a multi-key employee ordering
+ */
+typedef struct {
+    EmployeeSortField field;    // Field to order by
+    bool descending;            // true to put the largest values first
+} EmployeeSortSpec;
+
 /**
  * @name Employee Name Management Functions
  * @brief Functions for handling employee name operations
@@ -232,6 +256,18 @@ void deleteEmployee(Employee** employee);
  */
 int createEmployeeList(list** employeeList);
 
+/**
+ * @brief Creates a new empty employee list of a specific list type
+ * 
+ * Same as createEmployeeList() but lets the caller choose the list type,
+ * e.g. DYNAMIC_ARRAY for large lists that are paged or indexed often.
+ * 
+ * @param employeeList Double pointer to store the new list
+ * @param listType Type of list to create
+ * @return 0 on success, non-zero on error
+ */
+int createEmployeeListOfType(list** employeeList, ListType listType);
+
 /**
  * @brief Memory cleanup function for employee data
  * 
@@ -254,14 +290,16 @@ void freeEmployee(void* employeeData);
 /**
  * @brief Searches for an employee by employee number
  * 
- * Performs a linear search through the employee list to find an employee
- * with the specified employee number (unique identifier).
+ * Finds the employee with the specified employee number (unique
+ * identifier) through the list's key index (see findNodeByKey()), so a
+ * lookup takes O(1) on average. The first lookup builds the index,
+ * which is why the list is not const.
  * 
  * @param employeeList Pointer to the employee list to search
  * @param employeeNumber Employee number to search for
  * @return Pointer to found employee, or NULL if not found
  */
-Employee* searchEmployeeByNumber(const list* employeeList, const char* employeeNumber);
+Employee* searchEmployeeByNumber(list* employeeList, const char* employeeNumber);
 
 /**
  * @brief Searches for an employee by last name
@@ -311,7 +349,8 @@ int updateEmployeeData(Employee* employee, const Employee* newData);
  * @brief Edits an employee record within a list
  * 
  * Finds an employee by their employee number and updates their record
- * with new data. Combines search and update operations in one function.
+ * with new data. Combines search and update operations in one function,
+ * and records the change in the list's journal.
  * 
  * @param employeeList Pointer to the employee list
  * @param employeeNumber Employee number to find and update
@@ -400,6 +439,67 @@ int compareEmployeeByNumber(const void* emp1, const void* emp2);
  */
 int compareEmployeeByName(const void* emp1, const void* emp2);
 
+/**
+ * @brief Comparison function for ranking employees by net pay
+ * 
+ * Orders employees from the highest to the lowest net pay. Employees
+ * with the same net pay are ordered by employee number.
+ * 
+ * @param emp1 Pointer to first employee for comparison
+ * @param emp2 Pointer to second employee for comparison
+ * @return Negative if emp1 earns more than emp2, 0 if equal, positive otherwise
+ */
+int compareEmployeeByNetPay(const void* emp1, const void* emp2);
+
+/**
+ * @brief Finds the top earners by net pay without sorting the list
+ * 
+ * Ranks employees with compareEmployeeByNetPay() in a single O(n log k)
+ * pass through selectTopItems().
+ * 
+ * @param employeeList Pointer to the employee list to scan
+ * @param k Maximum number of employees to return
+ * @param topEarners Array with room for k employee pointers, filled best first
+ * @return Number of employees found, or -1 on error
+ */
+int findTopEarners(const list* employeeList, int k, Employee** topEarners);
+
+/**
+ * @brief Compiles an employee sort specification into list sort keys
+ * 
+ * @param spec Fields to order by, most significant first
+ * @param specCount Number of fields (1 to employeeSortMaxFields)
+ * @param keys Output array with room for specCount keys
+ * @return 0 on success, -1 on an empty, oversized or unknown specification
+ */
+int compileEmployeeSortKeys(const EmployeeSortSpec* spec, int specCount, SortKey* keys);
+
+/**
+ * @brief Sorts an employee list by a multi-key specification
+ * 
+ * Packs the fields of every employee into one normalized key and radix
+ * sorts the list with sortListByKeys(). Employees that are equal on every
+ * field keep their current order.
+ * 
+ * @param employeeList Pointer to the employee list to sort
+ * @param spec Fields to order by, most significant first
+ * @param specCount Number of fields (1 to employeeSortMaxFields)
+ * @return 0 on success, -1 on error
+ */
+int sortEmployeesBySpec(list* employeeList, const EmployeeSortSpec* spec, int specCount);
+
+/**
+ * @brief Sorts an employee list by employee number
+ * 
+ * Radix sorts the fixed-width employee numbers with sortEmployeesBySpec()
+ * instead of comparing them with strcmp(). The order is the same as a
+ * stable sort with compareEmployeeByNumber().
+ * 
+ * @param employeeList Pointer to the employee list to sort
+ * @return 0 on success, -1 on error
+ */
+int sortEmployeesByNumber(list* employeeList);
+
 /** @} */ // End of Utility Functions
 
 #endif // EMPLOYEE_H
\ No newline at end of file
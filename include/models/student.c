@@ -1,9 +1,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include "../models/student.h"
 #include "../headers/apctxt.h"
+#include "../headers/journal.h"
+#include "../headers/delta.h"
 
 // Global program list
 Program g_programs[maxProgramCount];
@@ -16,6 +20,7 @@ int g_programCount = 0;
 int loadProgramsFromConfig(void) {
     char configPath[1024]; // Increased buffer size to prevent truncation
     
+#ifdef _WIN32
     // Get the full path of the executable
     char executablePath[512];
     GetModuleFileName(NULL, executablePath, sizeof(executablePath));
@@ -30,6 +35,10 @@ int loadProgramsFromConfig(void) {
         strncpy(configPath, "config.ini", sizeof(configPath) - 1);
         configPath[sizeof(configPath) - 1] = '\0';
     }
+#else
+    // Elsewhere the configuration is read from the working directory
+    snprintf(configPath, sizeof(configPath), "config.ini");
+#endif
     
     FILE* file = fopen(configPath, "r");
     if (!file) {
@@ -226,15 +235,19 @@ int composeStudentName(StudentName* name) {
 
     // Format 1: "Last, First" format (most compact)
     if ((lnLen + fnLen + 3) < studentNameLen) { // +3 for ", " and null
-        snprintf(name->fullName, studentNameLen, "%.*s, %.*s", 
-                (int)lnLen, name->lastName,
-                (int)fnLen, name->firstName);
+        // Copied directly rather than formatted, since bulk imports compose a name per row
+        size_t currLen = lnLen + 2 + fnLen;
+        memcpy(name->fullName, name->lastName, lnLen);
+        memcpy(name->fullName + lnLen, ", ", 2);
+        memcpy(name->fullName + lnLen + 2, name->firstName, fnLen);
         
         // If middle name exists and there's room, add the initial
-        if (mnLen > 0 && strlen(name->fullName) + 3 < studentNameLen) { // +3 for space, initial, and dot
-            size_t currLen = strlen(name->fullName);
-            snprintf(name->fullName + currLen, studentNameLen - currLen, " %c.", name->middleName[0]);
+        if (mnLen > 0 && currLen + 3 < studentNameLen) { // +3 for space, initial, and dot
+            name->fullName[currLen++] = ' ';
+            name->fullName[currLen++] = name->middleName[0];
+            name->fullName[currLen++] = '.';
         }
+        name->fullName[currLen] = '\0';
         
         return 1;
     }
@@ -287,42 +300,25 @@ void calculateFinalGrade(Student* student) {
     }
 }
 
+/**
+ * @brief Finds the node of a student through the list's key index.
+ * @param studentList Pointer to the student list.
+ * @param studentNumber The student number to look for.
+ * @return The node if found, NULL otherwise.
+ */
+static node* findStudentNode(list* studentList, const char* studentNumber) {
+    return findNodeByKey(studentList, offsetof(Student, personal.studentNumber), studentNumberLen, studentNumber);
+}
+
 /**
  * @brief Searches for a student by student number.
  * @param studentList Pointer to the student list.
  * @param studentNumber The student number to search for.
  * @return Pointer to the student if found, NULL otherwise.
  */
-Student* searchStudentByNumber(const list* studentList, const char* studentNumber) {
-    if (!studentList || !studentNumber || !studentList->head) {
-        return NULL;
-    }
-    
-    node* current = studentList->head;
-    
-    if (studentList->type == SINGLY || studentList->type == DOUBLY) {
-        // Non-circular lists
-        while (current != NULL) {
-            Student* student = (Student*)current->data;
-            if (student && strcmp(student->personal.studentNumber, studentNumber) == 0) {
-                return student;
-            }
-            current = current->next;
-        }
-    } else {
-        // Circular lists
-        if (current != NULL) {
-            do {
-                Student* student = (Student*)current->data;
-                if (student && strcmp(student->personal.studentNumber, studentNumber) == 0) {
-                    return student;
-                }
-                current = current->next;
-            } while (current != studentList->head);
-        }
-    }
-    
-    return NULL;
+Student* searchStudentByNumber(list* studentList, const char* studentNumber) {
+    node* found = findStudentNode(studentList, studentNumber);
+    return found ? (Student*)found->data : NULL;
 }
 
 /**
@@ -579,7 +575,11 @@ int createStudent(Student* student, list** studentList) {
         }
     }
     
-    return addNode(studentList, student);
+    if (addNode(studentList, student) != 0) {
+        return -1;
+    }
+    journalRecordAdded(*studentList, student);
+    return 0;
 }
 
 /**
@@ -588,11 +588,21 @@ int createStudent(Student* student, list** studentList) {
  * @return 0 on success, -1 on failure.
  */
 int createStudentList(list** studentList) {
+    return createStudentListOfType(studentList, SINGLY);
+}
+
+/**
+ * @brief Creates a new student list using a specific list type.
+ * @param studentList Pointer to the student list pointer.
+ * @param listType The list type to use (e.g., DYNAMIC_ARRAY for large lists).
+ * @return 0 on success, -1 on failure.
+ */
+int createStudentListOfType(list** studentList, ListType listType) {
     if (!studentList) {
         return -1;
     }
     
-    return createList(studentList, SINGLY);
+    return createList(studentList, listType);
 }
 
 /**
@@ -611,10 +621,36 @@ int updateStudentData(Student* existingStudent, const Student* newData) {
     
     // Recalculate final grade and remarks
     calculateFinalGrade(existingStudent);
+    markRecordDirty(existingStudent);
     
     return 0;
 }
 
+/**
+ * @brief Edits a student in the list by student number.
+ * @param studentList Pointer to the student list.
+ * @param studentNumber The student number to edit.
+ * @param newData Pointer to the new student data.
+ * @return 0 on success, -1 on failure.
+ */
+int editStudentInList(list* studentList, const char* studentNumber, const Student* newData) {
+    node* studentNode = findStudentNode(studentList, studentNumber);
+    if (!studentNode) {
+        return -1; // Student not found
+    }
+    
+    Student* student = (Student*)studentNode->data;
+    Student before = *student;
+    if (updateStudentData(student, newData) != 0) {
+        return -1;
+    }
+    if (strcmp(before.personal.studentNumber, student->personal.studentNumber) != 0) {
+        dropListKeyIndex(studentList); // The index would not find the record under its new number
+    }
+    journalRecordUpdated(studentList, &before, student);
+    return 0;
+}
+
 /**
  * @brief Removes a student from the list by student number.
  * @param studentList Pointer to the student list.
@@ -626,36 +662,17 @@ int removeStudentFromList(list* studentList, const char* studentNumber) {
         return -1;
     }
     
-    Student* student = searchStudentByNumber(studentList, studentNumber);
-    if (!student) {
+    node* studentNode = findStudentNode(studentList, studentNumber);
+    if (!studentNode) {
         return -1; // Student not found
     }
     
-    // Find and remove the node containing this student
-    node* current = studentList->head;
-    if (studentList->type == SINGLY || studentList->type == DOUBLY) {
-        // Non-circular lists
-        while (current != NULL) {
-            if (current->data == student) {
-                removeNode(studentList, student, freeStudent);
-                return 0;
-            }
-            current = current->next;
-        }
-    } else {
-        // Circular lists
-        if (current != NULL) {
-            do {
-                if (current->data == student) {
-                    removeNode(studentList, student, freeStudent);
-                    return 0;
-                }
-                current = current->next;
-            } while (current != studentList->head);
-        }
-    }
-    
-    return -1; // Student not found in list
+    // The list's key index finds the node without a scan, and the handle unlinks it. Later slots
+    // shift and the freed address may be reused, so the list no longer matches its file slot by slot
+    journalRecordRemoved(studentList, studentNode->data);
+    untrackDataFile(studentList);
+    removeNodeByHandle(studentList, studentNode, freeStudent);
+    return 0;
 }
 
 /**
@@ -666,4 +683,125 @@ void freeStudent(void* student) {
     if (student) {
         free(student);
     }
-} 
\ No newline at end of file
+} 
+
+/**
+ * @brief Compares two students by final grade (highest first).
+ * @param stu1 Pointer to the first student.
+ * @param stu2 Pointer to the second student.
+ * @return Negative if stu1 ranks above stu2, 0 if equal, positive otherwise.
+ */
+int compareStudentByGrade(const void* stu1, const void* stu2) {
+    if (!stu1 || !stu2) {
+        return 0;
+    }
+
+    const Student* s1 = (const Student*)stu1;
+    const Student* s2 = (const Student*)stu2;
+
+    if (s1->academic.finalGrade != s2->academic.finalGrade) {
+        return (s1->academic.finalGrade > s2->academic.finalGrade) ? -1 : 1;
+    }
+    return strcmp(s1->personal.studentNumber, s2->personal.studentNumber);
+}
+
+/**
+ * @brief Translates a student sort specification into sort keys.
+ * @param spec The fields to order by, most significant first.
+ * @param specCount The number of fields.
+ * @param keys The output array of sort keys.
+ * @return Returns 0 on success, -1 on an invalid specification.
+ */
+int compileStudentSortKeys(const StudentSortSpec* spec, int specCount, SortKey* keys) {
+    if (!spec || !keys || specCount <= 0 || specCount > studentSortMaxFields) {
+        return -1;
+    }
+
+    for (int i = 0; i < specCount; i++) {
+        SortKey* key = &keys[i];
+        key->descending = spec[i].descending;
+        key->length = 0;
+        switch (spec[i].field) {
+            case STUDENT_SORT_NUMBER:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Student, personal.studentNumber);
+                key->length = studentNumberLen - 1;
+                break;
+            case STUDENT_SORT_LAST_NAME:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Student, personal.name.lastName);
+                key->length = studentLastNameLen - 1;
+                break;
+            case STUDENT_SORT_FIRST_NAME:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Student, personal.name.firstName);
+                key->length = studentFirstNameLen - 1;
+                break;
+            case STUDENT_SORT_PROGRAM:
+                key->type = SORT_KEY_STRING;
+                key->offset = offsetof(Student, personal.programCode);
+                key->length = programCodeLen - 1;
+                break;
+            case STUDENT_SORT_YEAR_LEVEL:
+                key->type = SORT_KEY_INT;
+                key->offset = offsetof(Student, personal.yearLevel);
+                break;
+            case STUDENT_SORT_UNITS:
+                key->type = SORT_KEY_INT;
+                key->offset = offsetof(Student, academic.unitsEnrolled);
+                break;
+            case STUDENT_SORT_FINAL_GRADE:
+                key->type = SORT_KEY_FLOAT;
+                key->offset = offsetof(Student, academic.finalGrade);
+                break;
+            case STUDENT_SORT_STANDING:
+                key->type = SORT_KEY_INT;
+                key->offset = offsetof(Student, standing);
+                break;
+            default:
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Sorts a student list by a multi-key specification.
+ * @param studentList A pointer to the student list.
+ * @param spec The fields to order by, most significant first.
+ * @param specCount The number of fields.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int sortStudentsBySpec(list* studentList, const StudentSortSpec* spec, int specCount) {
+    SortKey keys[studentSortMaxFields];
+    if (compileStudentSortKeys(spec, specCount, keys) != 0) {
+        return -1;
+    }
+    if (sortListByKeys(studentList, keys, specCount) != 0) {
+        return -1;
+    }
+    journalListReordered(studentList);
+    return 0;
+}
+
+/**
+ * @brief Checks whether a student is on the Dean's List.
+ * @param data Pointer to the student.
+ * @return true if the student's standing is acadDeansLister.
+ */
+static bool isDeansLister(const void* data) {
+    return ((const Student*)data)->standing == acadDeansLister;
+}
+
+/**
+ * @brief Finds the students with the highest final grades.
+ * @param studentList A const pointer to the student list.
+ * @param k The maximum number of students to return.
+ * @param deansListOnly Whether only Dean's Listers are ranked.
+ * @param topStudents The array that receives the students, best first.
+ * @return The number of students found, or -1 on failure.
+ */
+int findTopStudents(const list* studentList, int k, bool deansListOnly, Student** topStudents) {
+    return selectTopItems(studentList, compareStudentByGrade, deansListOnly ? isDeansLister : NULL,
+                          k, (void**)topStudents);
+}
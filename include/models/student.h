@@ -38,6 +38,8 @@
 #define programCodeLen 8            // Program code: "IT", "CS", etc. + null terminator
 #define programNameLen 64           // Program full name + null terminator
 #define maxProgramCount 20          // Maximum number of academic programs supported
+#define studentSortMaxFields 8      // Maximum fields in one StudentSortSpec array
+#define deansListMaxEntries 50      // Students shown in a Dean's List
 
 /** @} */ // End of Student Data Structure Size Constants
 
@@ -186,6 +188,33 @@ typedef struct {
     AcademicStanding standing;      // Current academic standing
 } Student;
 
+/**
+ * @enum StudentSortField
+ * @brief Student fields that can be used as sort keys
+ */
+typedef enum {
+    STUDENT_SORT_NUMBER,        // personal.studentNumber
+    STUDENT_SORT_LAST_NAME,     // personal.name.lastName
+    STUDENT_SORT_FIRST_NAME,    // personal.name.firstName
+    STUDENT_SORT_PROGRAM,       // personal.programCode
+    STUDENT_SORT_YEAR_LEVEL,    // personal.yearLevel
+    STUDENT_SORT_UNITS,         // academic.unitsEnrolled
+    STUDENT_SORT_FINAL_GRADE,   // academic.finalGrade
+    STUDENT_SORT_STANDING       // standing
+} StudentSortField;
+
+/**
+ * @struct StudentSortSpec
+ * @brief One field and direction of a multi-key student ordering
+ * 
+ * An array of specs is read most significant first, e.g. program, then
+ * year level, then final grade descending, then last name.
+ */
+typedef struct {
+    StudentSortField field;     // Field to order by
+    bool descending;            // true to put the largest values first
+} StudentSortSpec;
+
 /**
  * @name Program Management Functions
  * @brief Functions for managing academic programs
@@ -297,14 +326,16 @@ void calculateFinalGrade(Student* student);
 /**
  * @brief Searches for a student by student number
  * 
- * Performs a linear search through the student list to find a student
- * with the specified student number (unique identifier).
+ * Finds the student with the specified student number (unique
+ * identifier) through the list's key index (see findNodeByKey()), so a
+ * lookup takes O(1) on average. The first lookup builds the index,
+ * which is why the list is not const.
  * 
  * @param studentList Pointer to the student list to search
  * @param studentNumber Student number to search for
  * @return Pointer to found student, or NULL if not found
  */
-Student* searchStudentByNumber(const list* studentList, const char* studentNumber);
+Student* searchStudentByNumber(list* studentList, const char* studentNumber);
 
 /**
  * @brief Searches for a student by last name
@@ -378,6 +409,18 @@ int createStudent(Student* student, list** studentList);
  */
 int createStudentList(list** studentList);
 
+/**
+ * @brief Creates a new empty student list of a specific list type
+ * 
+ * Same as createStudentList() but lets the caller choose the list type,
+ * e.g. DYNAMIC_ARRAY for large lists that are paged or indexed often.
+ * 
+ * @param studentList Double pointer to store the new list
+ * @param listType Type of list to create
+ * @return 0 on success, non-zero on error
+ */
+int createStudentListOfType(list** studentList, ListType listType);
+
 /**
  * @brief Updates an existing student record with new data
  * 
@@ -390,6 +433,20 @@ int createStudentList(list** studentList);
  */
 int updateStudentData(Student* existingStudent, const Student* newData);
 
+/**
+ * @brief Edits a student record within a list
+ * 
+ * Finds a student by their student number and updates their record
+ * with new data. Combines search and update operations in one function,
+ * and records the change in the list's journal.
+ * 
+ * @param studentList Pointer to the student list
+ * @param studentNumber Student number to find and update
+ * @param newData Pointer to the new student data
+ * @return 0 on success, non-zero on error
+ */
+int editStudentInList(list* studentList, const char* studentNumber, const Student* newData);
+
 /**
  * @brief Removes a student from the list by student number
  * 
@@ -415,4 +472,68 @@ void freeStudent(void* student);
 
 /** @} */ // End of Student Creation and Management
 
+/**
+ * @name Utility Functions
+ * @brief Helper functions for student data management
+ * @{
+ */
+
+/**
+ * @brief Comparison function for ranking students by final grade
+ * 
+ * Orders students from the highest to the lowest final grade. Students
+ * with the same grade are ordered by student number so that rankings are
+ * stable. Used as the comparator of the grade ranking skip lists.
+ * 
+ * @param stu1 Pointer to first student for comparison
+ * @param stu2 Pointer to second student for comparison
+ * @return Negative if stu1 ranks above stu2, 0 if equal, positive otherwise
+ */
+int compareStudentByGrade(const void* stu1, const void* stu2);
+
+/**
+ * @brief Compiles a student sort specification into list sort keys
+ * 
+ * Translates every {field, direction} pair into the offset, type and
+ * width of the field inside Student, ready for sortListByKeys() or
+ * sortItemsByKeys().
+ * 
+ * @param spec Fields to order by, most significant first
+ * @param specCount Number of fields (1 to studentSortMaxFields)
+ * @param keys Output array with room for specCount keys
+ * @return 0 on success, -1 on an empty, oversized or unknown specification
+ */
+int compileStudentSortKeys(const StudentSortSpec* spec, int specCount, SortKey* keys);
+
+/**
+ * @brief Sorts a student list by a multi-key specification
+ * 
+ * Packs the fields of every student into one normalized key and radix
+ * sorts the list with sortListByKeys(). Students that are equal on every
+ * field keep their current order.
+ * 
+ * @param studentList Pointer to the student list to sort
+ * @param spec Fields to order by, most significant first
+ * @param specCount Number of fields (1 to studentSortMaxFields)
+ * @return 0 on success, -1 on error
+ */
+int sortStudentsBySpec(list* studentList, const StudentSortSpec* spec, int specCount);
+
+/**
+ * @brief Finds the top students by final grade without sorting the list
+ * 
+ * Ranks students like compareStudentByGrade() with selectTopItems(), so
+ * a single O(n log k) pass replaces a full sort. With deansListOnly set,
+ * only students whose standing is acadDeansLister are ranked.
+ * 
+ * @param studentList Pointer to the student list to scan
+ * @param k Maximum number of students to return
+ * @param deansListOnly true to rank only Dean's Listers
+ * @param topStudents Array with room for k student pointers, filled best first
+ * @return Number of students found, or -1 on error
+ */
+int findTopStudents(const list* studentList, int k, bool deansListOnly, Student** topStudents);
+
+/** @} */ // End of Utility Functions
+
 #endif // STUDENT_H 
\ No newline at end of file
@@ -1,5 +1,17 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // For fstatat and dirfd
+#endif
+
 #include "../headers/apctxt.h"
 
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <fnmatch.h>
+#include <sys/stat.h>
+#endif
+
 Config g_config; // Global configuration instance
 
 void setDefaultConfig(void) { // Set default configuration values
@@ -8,6 +20,14 @@ void setDefaultConfig(void) { // Set default configuration values
     g_config.passingGrade = 75.0f;     // Academic settings
     g_config.minGrade = 0.0f;
     g_config.maxGrade = 100.0f;
+    g_config.sortThreads = 1;          // Performance settings
+    g_config.sortMemoryMB = 64;
+    g_config.mappedLoadMB = 64;
+    g_config.journalSaves = 1;
+    g_config.autosaveSeconds = 120;
+    g_config.compressSaves = 0;
+    g_config.loadThreads = 4;
+    g_config.startupSession = 0;
 }
 
 // Save configuration to file
@@ -26,6 +46,15 @@ int saveConfig(const char* config_file) {
     fprintf(file, "passing_grade = %.1f\n", g_config.passingGrade);
     fprintf(file, "min_grade = %.1f\n", g_config.minGrade);
     fprintf(file, "max_grade = %.1f\n\n", g_config.maxGrade);
+    fprintf(file, "[Performance_Settings]\n");
+    fprintf(file, "sort_threads = %d\n", g_config.sortThreads);
+    fprintf(file, "sort_memory_mb = %d\n", g_config.sortMemoryMB);
+    fprintf(file, "mapped_load_mb = %d\n", g_config.mappedLoadMB);
+    fprintf(file, "journal_saves = %d\n", g_config.journalSaves);
+    fprintf(file, "autosave_seconds = %d\n", g_config.autosaveSeconds);
+    fprintf(file, "compress_saves = %d\n", g_config.compressSaves);
+    fprintf(file, "load_threads = %d\n", g_config.loadThreads);
+    fprintf(file, "startup_session = %d\n\n", g_config.startupSession);
     
     // Add Programs section with default program codes
     fprintf(file, "[Programs]\n");
@@ -101,6 +130,24 @@ int loadConfig(const char* config_file) {
             } else if (strcmp(key, "max_grade") == 0) {
                 g_config.maxGrade = (float)atof(value);
             }
+        } else if (strcmp(current_section, "Performance_Settings") == 0) { // Get performance settings
+            if (strcmp(key, "sort_threads") == 0) {
+                g_config.sortThreads = atoi(value);
+            } else if (strcmp(key, "sort_memory_mb") == 0) {
+                g_config.sortMemoryMB = atoi(value);
+            } else if (strcmp(key, "mapped_load_mb") == 0) {
+                g_config.mappedLoadMB = atoi(value);
+            } else if (strcmp(key, "journal_saves") == 0) {
+                g_config.journalSaves = atoi(value);
+            } else if (strcmp(key, "autosave_seconds") == 0) {
+                g_config.autosaveSeconds = atoi(value);
+            } else if (strcmp(key, "compress_saves") == 0) {
+                g_config.compressSaves = atoi(value);
+            } else if (strcmp(key, "load_threads") == 0) {
+                g_config.loadThreads = atoi(value);
+            } else if (strcmp(key, "startup_session") == 0) {
+                g_config.startupSession = atoi(value);
+            }
         }
     }
     fclose(file);
@@ -112,6 +159,18 @@ void printCurrentConfig(void) {
     printf("Regular Hours: %.1f\n", g_config.regularHours);
     printf("Overtime Rate: %.1f\n", g_config.overtimeRate);
     printf("Passing Grade: %.1f\n", g_config.passingGrade);
+    printf("Sort Threads: %d\n", g_config.sortThreads);
+    printf("Sort Memory: %d MB\n", g_config.sortMemoryMB);
+    printf("Mapped Load Threshold: %d MB\n", g_config.mappedLoadMB);
+    printf("Journaled Saves: %s\n", g_config.journalSaves ? "on" : "off");
+    if (g_config.autosaveSeconds > 0) {
+        printf("Autosave Interval: %d seconds\n", g_config.autosaveSeconds);
+    } else {
+        printf("Autosave Interval: off\n");
+    }
+    printf("Compressed Saves: %s\n", g_config.compressSaves ? "on" : "off");
+    printf("Load Threads: %d\n", g_config.loadThreads);
+    printf("Startup Session: %s\n", g_config.startupSession ? "on" : "off");
     printf("============================\n");
 }
 
@@ -127,10 +186,46 @@ float getPassingGrade(void) {
     return g_config.passingGrade;
 }
 
+int getSortThreads(void) {
+    return (g_config.sortThreads > 0) ? g_config.sortThreads : 1;
+}
+
+size_t getSortMemoryLimit(void) {
+    int megabytes = (g_config.sortMemoryMB > 0) ? g_config.sortMemoryMB : 1;
+    return (size_t)megabytes * 1024 * 1024;
+}
+
+size_t getMappedLoadThreshold(void) {
+    if (g_config.mappedLoadMB <= 0) {
+        return SIZE_MAX; // Mapping disabled
+    }
+    return (size_t)g_config.mappedLoadMB * 1024 * 1024;
+}
+
+bool isJournalEnabled(void) {
+    return g_config.journalSaves != 0;
+}
+
+int getAutosaveInterval(void) {
+    return (g_config.autosaveSeconds > 0) ? g_config.autosaveSeconds : 0;
+}
+
+bool isCompressionEnabled(void) {
+    return g_config.compressSaves != 0;
+}
+
+int getLoadThreads(void) {
+    return (g_config.loadThreads > 0) ? g_config.loadThreads : 1;
+}
+
+bool isStartupSessionEnabled(void) {
+    return g_config.startupSession != 0;
+}
+
 // File system utility functions (replacements for system() calls)
 
 /**
- * @brief Creates a directory if it doesn't exist (Windows implementation)
+ * @brief Creates a directory if it doesn't exist
  * @param dirPath The directory path to create
  * @return 0 on success (including if directory already exists), -1 on failure
  */
@@ -139,6 +234,7 @@ int appCreateDirectory(const char* dirPath) {
         return -1;
     }
     
+#ifdef _WIN32
     // CreateDirectory returns non-zero on success, zero on failure
     if (CreateDirectory(dirPath, NULL)) {
         return 0; // Successfully created
@@ -149,43 +245,192 @@ int appCreateDirectory(const char* dirPath) {
     if (error == ERROR_ALREADY_EXISTS) {
         return 0; // Directory already exists, that's fine
     }
+#else
+    if (mkdir(dirPath, 0777) == 0 || errno == EEXIST) {
+        return 0; // Created, or it already exists
+    }
+#endif
     
     return -1; // Other error occurred
 }
 
 /**
- * @brief Lists files in a directory matching a pattern (Windows implementation)
+ * @brief Orders scanned files by name.
+ * @param a The first file.
+ * @param b The second file.
+ * @return Negative, zero or positive like strcmp.
+ */
+static int compareFileInfoByName(const void* a, const void* b) {
+    return strcmp(((const AppFileInfo*)a)->name, ((const AppFileInfo*)b)->name);
+}
+
+/**
+ * @brief Appends a file to a scan result, growing the array as needed.
+ * @param files The array of files.
+ * @param count The number of files in the array.
+ * @param capacity The capacity of the array.
+ * @return The entry to fill, or NULL if memory ran out.
+ */
+static AppFileInfo* addScannedFile(AppFileInfo** files, int* count, int* capacity) {
+    if (*count == *capacity) {
+        int newCapacity = (*capacity > 0) ? *capacity * 2 : 64;
+        AppFileInfo* grown = (AppFileInfo*)realloc(*files, (size_t)newCapacity * sizeof(AppFileInfo));
+        if (!grown) {
+            return NULL;
+        }
+        *files = grown;
+        *capacity = newCapacity;
+    }
+    return &(*files)[(*count)++];
+}
+
+#ifdef _WIN32
+/**
+ * @brief Converts a Windows file time to a time_t.
+ * @param fileTime The file time, in 100 ns intervals since 1601.
+ * @return The time in seconds since 1970.
+ */
+static time_t fileTimeToTime(FILETIME fileTime) {
+    ULARGE_INTEGER ticks;
+    ticks.LowPart = fileTime.dwLowDateTime;
+    ticks.HighPart = fileTime.dwHighDateTime;
+    return (time_t)((ticks.QuadPart - 116444736000000000ULL) / 10000000ULL);
+}
+#endif
+
+/**
+ * @brief Gets the size and modification time of one file without opening it
+ * @param path The path of the file
+ * @param info Receives the file's name (without the directory), size and time
+ * @return 0 on success, -1 if there is no such regular file
+ */
+int appGetFileInfo(const char* path, AppFileInfo* info) {
+    if (!path || !info) {
+        return -1;
+    }
+    
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesEx(path, GetFileExInfoStandard, &data) ||
+        (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        return -1;
+    }
+    info->size = ((long long)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+    info->modified = fileTimeToTime(data.ftLastWriteTime);
+#else
+    struct stat status;
+    if (stat(path, &status) != 0 || !S_ISREG(status.st_mode)) {
+        return -1;
+    }
+    info->size = (long long)status.st_size;
+    info->modified = status.st_mtime;
+#endif
+    
+    const char* name = path;
+    for (const char* c = path; *c; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+    snprintf(info->name, sizeof(info->name), "%s", name);
+    return 0;
+}
+
+/**
+ * @brief Lists the files of a directory that match a pattern, with their sizes and times
  * @param directory The directory to search in
- * @param pattern The file pattern to match (e.g., "*.dat", "*.cat")
- * @return 1 if files were found, 0 if no files found, -1 on error
+ * @param pattern The file pattern to match (e.g., "*.dat")
+ * @param files Receives the files sorted by name, to be released with free()
+ * @return The number of files found, or -1 on error
  */
-int appListFiles(const char* directory, const char* pattern) {
-    if (!directory || !pattern) {
+int appScanDirectory(const char* directory, const char* pattern, AppFileInfo** files) {
+    if (!directory || !pattern || !files) {
         return -1;
     }
+    *files = NULL;
+    int count = 0;
+    int capacity = 0;
     
-    // Construct the search path
+#ifdef _WIN32
     char searchPath[MAX_PATH];
     snprintf(searchPath, sizeof(searchPath), "%s\\%s", directory, pattern);
     
+    // The find data already carries the size and time, so no file is opened
     WIN32_FIND_DATA findFileData;
     HANDLE hFind = FindFirstFile(searchPath, &findFileData);
-    
     if (hFind == INVALID_HANDLE_VALUE) {
-        // No files found
-        return 0;
+        return 0; // No files found, or no such directory
     }
-    
-    int fileCount = 0;
-    
     do {
-        // Skip directories
-        if (!(findFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-            printf("%s\n", findFileData.cFileName);
-            fileCount++;
+        if (findFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            continue;
         }
+        AppFileInfo* file = addScannedFile(files, &count, &capacity);
+        if (!file) {
+            FindClose(hFind);
+            free(*files);
+            *files = NULL;
+            return -1;
+        }
+        snprintf(file->name, sizeof(file->name), "%s", findFileData.cFileName);
+        file->size = ((long long)findFileData.nFileSizeHigh << 32) | findFileData.nFileSizeLow;
+        
+        file->modified = fileTimeToTime(findFileData.ftLastWriteTime);
     } while (FindNextFile(hFind, &findFileData) != 0);
-    
     FindClose(hFind);
+#else
+    DIR* dir = opendir(directory);
+    if (!dir) {
+        return (errno == ENOENT) ? 0 : -1; // A missing directory holds no files
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (fnmatch(pattern, entry->d_name, 0) != 0) {
+            continue;
+        }
+        
+        // One stat relative to the open directory; the file itself is never opened
+        struct stat info;
+        if (fstatat(dirfd(dir), entry->d_name, &info, 0) != 0 || !S_ISREG(info.st_mode)) {
+            continue;
+        }
+        AppFileInfo* file = addScannedFile(files, &count, &capacity);
+        if (!file) {
+            closedir(dir);
+            free(*files);
+            *files = NULL;
+            return -1;
+        }
+        snprintf(file->name, sizeof(file->name), "%s", entry->d_name);
+        file->size = (long long)info.st_size;
+        file->modified = info.st_mtime;
+    }
+    closedir(dir);
+#endif
+    
+    if (count > 1) {
+        qsort(*files, (size_t)count, sizeof(AppFileInfo), compareFileInfoByName);
+    }
+    return count;
+}
+
+/**
+ * @brief Lists files in a directory matching a pattern
+ * @param directory The directory to search in
+ * @param pattern The file pattern to match (e.g., "*.dat", "*.cat")
+ * @return 1 if files were found, 0 if no files found, -1 on error
+ */
+int appListFiles(const char* directory, const char* pattern) {
+    AppFileInfo* files = NULL;
+    int fileCount = appScanDirectory(directory, pattern, &files);
+    if (fileCount < 0) {
+        return -1;
+    }
+    
+    for (int i = 0; i < fileCount; i++) {
+        printf("%s\n", files[i].name);
+    }
+    
+    free(files);
     return fileCount > 0 ? 1 : 0;
 } 
\ No newline at end of file
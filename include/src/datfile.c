@@ -0,0 +1,1620 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // For fileno, fsync, fseeko and mmap
+#define _FILE_OFFSET_BITS 64      // For a 64-bit off_t on 32-bit systems
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include "../headers/datfile.h"
+#include "../headers/lzpack.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#define crc32cPolynomial 0x82F63B78u   // Reflected Castagnoli polynomial
+#define dataFileMaxBlockBytes (16 * dataFileBlockBytes) // Largest block a reader accepts
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define crc32cHasHardwarePath 1
+
+/**
+ * @brief Computes a CRC32C with the SSE4.2 CRC32 instruction.
+ * @param crc The inverted running checksum.
+ * @param bytes The data.
+ * @param length The number of bytes.
+ * @return The inverted running checksum including the data.
+ */
+__attribute__((target("sse4.2")))
+static uint32_t crc32cHardware(uint32_t crc, const unsigned char* bytes, size_t length) {
+#if defined(__x86_64__)
+    uint64_t wide = crc;
+    while (length >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, bytes, sizeof(chunk));
+        wide = __builtin_ia32_crc32di(wide, chunk);
+        bytes += 8;
+        length -= 8;
+    }
+    crc = (uint32_t)wide;
+#endif
+    while (length >= 4) {
+        uint32_t chunk;
+        memcpy(&chunk, bytes, sizeof(chunk));
+        crc = __builtin_ia32_crc32si(crc, chunk);
+        bytes += 4;
+        length -= 4;
+    }
+    while (length > 0) {
+        crc = __builtin_ia32_crc32qi(crc, *bytes++);
+        length--;
+    }
+    return crc;
+}
+#else
+#define crc32cHasHardwarePath 0
+#endif
+
+/**
+ * @brief Slicing-by-8 lookup tables for the software CRC32C.
+ */
+static uint32_t crc32cTable[8][256];
+static pthread_once_t crc32cTableOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Fills the slicing-by-8 tables, once per process through pthread_once.
+ */
+static void initCrc32cTable(void) {
+    for (uint32_t value = 0; value < 256; value++) {
+        uint32_t crc = value;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1u) ? crc32cPolynomial : 0u);
+        }
+        crc32cTable[0][value] = crc;
+    }
+    for (uint32_t value = 0; value < 256; value++) {
+        for (int slice = 1; slice < 8; slice++) {
+            uint32_t previous = crc32cTable[slice - 1][value];
+            crc32cTable[slice][value] = (previous >> 8) ^ crc32cTable[0][previous & 0xFFu];
+        }
+    }
+}
+
+/**
+ * @brief Computes a CRC32C eight bytes at a time with lookup tables.
+ * @param crc The inverted running checksum.
+ * @param bytes The data.
+ * @param length The number of bytes.
+ * @return The inverted running checksum including the data.
+ */
+static uint32_t crc32cSoftware(uint32_t crc, const unsigned char* bytes, size_t length) {
+    // The autosave and load threads may checksum at the same time as the menus
+    pthread_once(&crc32cTableOnce, initCrc32cTable);
+    while (length >= 8) {
+        uint32_t low;
+        uint32_t high;
+        memcpy(&low, bytes, sizeof(low));
+        memcpy(&high, bytes + 4, sizeof(high));
+        low ^= crc;
+        crc = crc32cTable[7][low & 0xFFu] ^ crc32cTable[6][(low >> 8) & 0xFFu] ^
+              crc32cTable[5][(low >> 16) & 0xFFu] ^ crc32cTable[4][low >> 24] ^
+              crc32cTable[3][high & 0xFFu] ^ crc32cTable[2][(high >> 8) & 0xFFu] ^
+              crc32cTable[1][(high >> 16) & 0xFFu] ^ crc32cTable[0][high >> 24];
+        bytes += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = (crc >> 8) ^ crc32cTable[0][(crc ^ *bytes++) & 0xFFu];
+        length--;
+    }
+    return crc;
+}
+
+/**
+ * @brief Updates a CRC32C checksum, using SSE4.2 when the processor supports it.
+ * @param crc The checksum of the data so far (0 for none).
+ * @param data The data to add.
+ * @param length The number of bytes to add.
+ * @return The checksum including the new data.
+ */
+uint32_t crc32c(uint32_t crc, const void* data, size_t length) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    crc = ~crc;
+#if crc32cHasHardwarePath
+    if (__builtin_cpu_supports("sse4.2")) {
+        return ~crc32cHardware(crc, bytes, length);
+    }
+#endif
+    return ~crc32cSoftware(crc, bytes, length);
+}
+
+/**
+ * @brief Multiplies two polynomials modulo the CRC32C polynomial.
+ * @param a The first polynomial (reflected).
+ * @param b The second polynomial (reflected).
+ * @return The product modulo the polynomial.
+ */
+static uint32_t crc32cMultiply(uint32_t a, uint32_t b) {
+    uint32_t product = 0;
+    for (uint32_t mask = 1u << 31; mask != 0; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = (b & 1u) ? (b >> 1) ^ crc32cPolynomial : b >> 1;
+    }
+    return product;
+}
+
+/**
+ * @brief Advances an unconditioned CRC32C over a run of zero bytes in O(log n).
+ * @param crc The unconditioned checksum.
+ * @param zeroBytes The number of zero bytes.
+ * @return The checksum after the zero bytes.
+ */
+static uint32_t crc32cShift(uint32_t crc, uint64_t zeroBytes) {
+    uint32_t power = 1u << 23; // x^8, one zero byte
+    while (zeroBytes > 0) {
+        if (zeroBytes & 1u) {
+            crc = crc32cMultiply(power, crc);
+        }
+        power = crc32cMultiply(power, power);
+        zeroBytes >>= 1;
+    }
+    return crc;
+}
+
+/**
+ * @brief Updates the CRC32C of a buffer after a range of it was overwritten.
+ * @param crc The checksum of the whole buffer before the change.
+ * @param oldData The previous contents of the range.
+ * @param newData The new contents of the range.
+ * @param length The length of the range in bytes.
+ * @param bytesAfter The number of bytes in the buffer after the range.
+ * @return The checksum of the whole buffer after the change.
+ */
+uint32_t crc32cReplace(uint32_t crc, const void* oldData, const void* newData, size_t length, uint64_t bytesAfter) {
+    const unsigned char* before = (const unsigned char*)oldData;
+    const unsigned char* after = (const unsigned char*)newData;
+    unsigned char difference[256];
+    uint32_t delta = 0;
+
+    // CRCs are linear: the change is the CRC of the XOR of the old and new bytes
+    while (length > 0) {
+        size_t chunk = (length < sizeof(difference)) ? length : sizeof(difference);
+        for (size_t i = 0; i < chunk; i++) {
+            difference[i] = before[i] ^ after[i];
+        }
+#if crc32cHasHardwarePath
+        delta = __builtin_cpu_supports("sse4.2") ? crc32cHardware(delta, difference, chunk)
+                                                 : crc32cSoftware(delta, difference, chunk);
+#else
+        delta = crc32cSoftware(delta, difference, chunk);
+#endif
+        before += chunk;
+        after += chunk;
+        length -= chunk;
+    }
+    return crc ^ crc32cShift(delta, bytesAfter);
+}
+
+/**
+ * @brief Combines the checksums of two pieces of data.
+ * @param first The checksum of the first piece.
+ * @param second The checksum of the second piece.
+ * @param secondLength The length of the second piece in bytes.
+ * @return The checksum of both pieces one after another.
+ */
+uint32_t crc32cCombine(uint32_t first, uint32_t second, uint64_t secondLength) {
+    // The conditioning of the two checksums cancels out, leaving a shift of the first
+    return crc32cShift(first, secondLength) ^ second;
+}
+
+/**
+ * @brief Returns the number of records in a block of about dataFileBlockBytes.
+ * @param recordSize The size of one record in bytes.
+ * @return The records per block, at least 1.
+ */
+static size_t blockRecordsFor(size_t recordSize) {
+    size_t records = (recordSize > 0) ? dataFileBlockBytes / recordSize : 1;
+    return (records > 0) ? records : 1;
+}
+
+/**
+ * @brief Initializes the header of a new data file.
+ * @param header The header to initialize.
+ * @param recordType The record type and options stored in the flags.
+ * @param recordSize The size of one record in bytes.
+ * @param metadataSize The size of the metadata before the records.
+ */
+void initDataFileHeader(DataFileHeader* header, uint32_t recordType, size_t recordSize, size_t metadataSize) {
+    memset(header, 0, sizeof(*header));
+    header->magic = dataFileMagic;
+    header->version = dataFileVersion;
+    header->headerSize = (uint16_t)sizeof(DataFileHeader);
+    header->recordSize = (uint32_t)recordSize;
+    header->flags = recordType & (dataFileTypeMask | dataFileOptionMask);
+    header->metadataSize = (uint32_t)metadataSize;
+    if (header->flags & dataFileCompressed) {
+        header->blockRecords = (uint32_t)blockRecordsFor(recordSize);
+    }
+}
+
+/**
+ * @brief Moves the position of a file, with offsets beyond 2 GB.
+ * @param file The file.
+ * @param offset The offset relative to origin.
+ * @param origin SEEK_SET, SEEK_CUR or SEEK_END.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int seekDataFile(FILE* file, int64_t offset, int origin) {
+    if (!file) {
+        return -1;
+    }
+#ifdef _WIN32
+    return (_fseeki64(file, (__int64)offset, origin) == 0) ? 0 : -1;
+#else
+    return (fseeko(file, (off_t)offset, origin) == 0) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief Returns the position of a file, with offsets beyond 2 GB.
+ * @param file The file.
+ * @return The offset from the start of the file, or -1 on failure.
+ */
+int64_t tellDataFile(FILE* file) {
+    if (!file) {
+        return -1;
+    }
+#ifdef _WIN32
+    return (int64_t)_ftelli64(file);
+#else
+    return (int64_t)ftello(file);
+#endif
+}
+
+/**
+ * @brief Writes a header at the start of a data file.
+ * @param file The file opened for binary writing.
+ * @param header The header to write.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int writeDataFileHeader(FILE* file, const DataFileHeader* header) {
+    if (!file || !header) {
+        return -1;
+    }
+    if (seekDataFile(file, 0, SEEK_SET) != 0 || fwrite(header, sizeof(*header), 1, file) != 1) {
+        return -1;
+    }
+    return seekDataFile(file, 0, SEEK_END);
+}
+
+/**
+ * @brief Returns the size of an open file and rewinds it.
+ * @param file The file.
+ * @return The size in bytes, or -1 on failure.
+ */
+static int64_t getFileSize(FILE* file) {
+    if (seekDataFile(file, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    int64_t size = tellDataFile(file);
+    if (seekDataFile(file, 0, SEEK_SET) != 0) {
+        return -1;
+    }
+    return size;
+}
+
+/**
+ * @brief Returns the number of blocks of a compressed data file.
+ * @param header The header of the file.
+ * @return The number of blocks.
+ */
+static size_t getBlockCount(const DataFileHeader* header) {
+    return ((size_t)header->recordCount + header->blockRecords - 1) / header->blockRecords;
+}
+
+/**
+ * @brief Checks the block index of a compressed data file against the file size.
+ * @param file The file.
+ * @param header The header of the file.
+ * @param dataStart The offset of the first block.
+ * @param fileSize The size of the file.
+ * @return Returns 0 if every block lies in the file in order, -1 otherwise.
+ */
+static int validateBlockIndex(FILE* file, const DataFileHeader* header, uint64_t dataStart, int64_t fileSize) {
+    if (header->blockRecords == 0 || (uint64_t)header->blockRecords * header->recordSize > dataFileMaxBlockBytes) {
+        return -1;
+    }
+    size_t blockCount = getBlockCount(header);
+    uint64_t indexSize = (uint64_t)blockCount * sizeof(uint64_t);
+    if (fileSize < 0 || (uint64_t)fileSize < dataStart + indexSize) {
+        return -1;
+    }
+    uint64_t indexStart = (uint64_t)fileSize - indexSize;
+    if (blockCount == 0) {
+        return (indexStart == dataStart) ? 0 : -1;
+    }
+    if (seekDataFile(file, (int64_t)indexStart, SEEK_SET) != 0) {
+        return -1;
+    }
+
+    // Each block holds its packed size and at least one byte, but never more than its raw records
+    uint64_t offsets[512];
+    uint64_t previous = dataStart;
+    size_t blockBytes = (size_t)header->blockRecords * header->recordSize;
+    for (size_t done = 0; done < blockCount;) {
+        size_t chunk = blockCount - done;
+        if (chunk > sizeof(offsets) / sizeof(offsets[0])) {
+            chunk = sizeof(offsets) / sizeof(offsets[0]);
+        }
+        if (fread(offsets, sizeof(uint64_t), chunk, file) != chunk) {
+            return -1;
+        }
+        for (size_t i = 0; i < chunk; i++, done++) {
+            if (done == 0 ? offsets[i] != dataStart
+                          : offsets[i] < previous + sizeof(uint32_t) + 1 ||
+                            offsets[i] > previous + sizeof(uint32_t) + blockBytes) {
+                return -1;
+            }
+            previous = offsets[i];
+        }
+    }
+    size_t lastBytes = ((size_t)header->recordCount - (blockCount - 1) * header->blockRecords) * header->recordSize;
+    return (indexStart >= previous + sizeof(uint32_t) + 1 && indexStart <= previous + sizeof(uint32_t) + lastBytes)
+           ? 0 : -1;
+}
+
+/**
+ * @brief Returns the size of a key index.
+ * @param entryCount The number of entries.
+ * @param keyLength The size of one key in bytes.
+ * @param fenceStride The number of entries per fence.
+ * @return The size of the entries, fences and footer in bytes.
+ */
+static uint64_t getIndexSize(uint64_t entryCount, uint64_t keyLength, uint64_t fenceStride) {
+    uint64_t fenceCount = (entryCount + fenceStride - 1) / fenceStride;
+    return (entryCount + fenceCount) * (keyLength + sizeof(uint32_t)) + sizeof(DataFileIndexFooter);
+}
+
+/**
+ * @brief Reads and checks the footer of a file's key index.
+ * @param file The file.
+ * @param header The header of the file.
+ * @param fileSize The size of the file.
+ * @param footer Receives the footer.
+ * @return Returns 0 if the footer describes an index that fits the file, -1 otherwise.
+ */
+static int readIndexFooter(FILE* file, const DataFileHeader* header, int64_t fileSize, DataFileIndexFooter* footer) {
+    if (fileSize < (int64_t)sizeof(*footer) ||
+        seekDataFile(file, fileSize - (int64_t)sizeof(*footer), SEEK_SET) != 0 ||
+        fread(footer, sizeof(*footer), 1, file) != 1) {
+        return -1;
+    }
+    if (footer->magic != dataFileIndexMagic || footer->keyLength == 0 ||
+        footer->keyLength > dataFileMaxKeyLength ||
+        (uint64_t)footer->keyOffset + footer->keyLength > header->recordSize ||
+        footer->entryCount != header->recordCount || footer->fenceStride == 0) {
+        return -1;
+    }
+    return (footer->indexSize == getIndexSize(footer->entryCount, footer->keyLength, footer->fenceStride) &&
+            footer->indexSize <= (uint64_t)fileSize) ? 0 : -1;
+}
+
+/**
+ * @brief Returns where the records (or the block index) of a data file end.
+ * @param file The file.
+ * @param header The header of the file.
+ * @return The size of the file without its key index, or -1 on failure.
+ */
+static int64_t getContentEnd(FILE* file, const DataFileHeader* header) {
+    if (seekDataFile(file, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    int64_t fileSize = tellDataFile(file);
+    if (fileSize < 0 || !(header->flags & dataFileIndexed)) {
+        return fileSize;
+    }
+    DataFileIndexFooter footer;
+    if (readIndexFooter(file, header, fileSize, &footer) != 0) {
+        return -1;
+    }
+    return fileSize - (int64_t)footer.indexSize;
+}
+
+/**
+ * @brief Reads and validates the header and metadata of a data file.
+ * @param file The file opened for binary reading.
+ * @param recordType The expected record type.
+ * @param recordSize The expected size of one record.
+ * @param metadata The buffer that receives the metadata. Can be NULL if metadataSize is 0.
+ * @param metadataSize The expected size of the metadata.
+ * @param header The header read from the file.
+ * @return Returns 0 if the file is valid, -1 otherwise.
+ */
+int readDataFileHeader(FILE* file, uint32_t recordType, size_t recordSize,
+                       void* metadata, size_t metadataSize, DataFileHeader* header) {
+    if (!file || !header || (metadataSize > 0 && !metadata)) {
+        return -1;
+    }
+
+    int64_t fileSize = getFileSize(file);
+    if (fileSize < (int64_t)sizeof(int)) {
+        return -1;
+    }
+
+    uint32_t magic;
+    if (fread(&magic, sizeof(magic), 1, file) != 1) {
+        return -1;
+    }
+
+    if (magic != dataFileMagic) {
+        // Legacy layout: metadata, int count, records
+        int count;
+        if (seekDataFile(file, 0, SEEK_SET) != 0 ||
+            (metadataSize > 0 && fread(metadata, metadataSize, 1, file) != 1) ||
+            fread(&count, sizeof(count), 1, file) != 1 || count < 0) {
+            return -1;
+        }
+        if ((uint64_t)fileSize != metadataSize + sizeof(int) + (uint64_t)count * recordSize) {
+            return -1;
+        }
+        initDataFileHeader(header, recordType, recordSize, metadataSize);
+        header->version = 0;
+        header->headerSize = 0;
+        header->recordCount = (uint32_t)count;
+        return 0;
+    }
+
+    if (seekDataFile(file, 0, SEEK_SET) != 0 || fread(header, sizeof(*header), 1, file) != 1) {
+        return -1;
+    }
+    if (header->version != dataFileVersion || header->headerSize != sizeof(DataFileHeader) ||
+        (header->flags & dataFileTypeMask) != recordType || header->recordSize != recordSize ||
+        (header->flags & ~(dataFileTypeMask | dataFileOptionMask)) != 0 ||
+        header->metadataSize != metadataSize || header->recordCount > (uint32_t)INT32_MAX) {
+        return -1;
+    }
+
+    // The key index lies after everything else and is left out of the size checks
+    if (header->flags & dataFileIndexed) {
+        DataFileIndexFooter footer;
+        if (readIndexFooter(file, header, fileSize, &footer) != 0) {
+            return -1;
+        }
+        fileSize -= (int64_t)footer.indexSize;
+    }
+
+    uint64_t dataStart = (uint64_t)header->headerSize + metadataSize;
+    if (header->flags & dataFileCompressed) {
+        if (validateBlockIndex(file, header, dataStart, fileSize) != 0) {
+            return -1;
+        }
+    } else if (header->blockRecords != 0 ||
+               (uint64_t)fileSize != dataStart + (uint64_t)header->recordCount * recordSize) {
+        // The size must match exactly, which catches truncated and padded files
+        return -1;
+    }
+    if (seekDataFile(file, header->headerSize, SEEK_SET) != 0) {
+        return -1;
+    }
+    if (metadataSize > 0 && fread(metadata, metadataSize, 1, file) != 1) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Compares a payload checksum with the one stored in the header.
+ * @param header The header read from the file.
+ * @param payloadChecksum The checksum of the metadata and records as read.
+ * @return Returns 0 if they match or the file is a legacy file, -1 otherwise.
+ */
+int verifyDataFileChecksum(const DataFileHeader* header, uint32_t payloadChecksum) {
+    if (!header) {
+        return -1;
+    }
+    if (header->version == 0) {
+        return 0; // Legacy files carry no checksum
+    }
+    return (header->checksum == payloadChecksum) ? 0 : -1;
+}
+
+/**
+ * @brief Forces the buffered contents of a file to disk.
+ * @param file The file opened for writing.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int syncDataFile(FILE* file) {
+    if (!file || fflush(file) != 0) {
+        return -1;
+    }
+#ifdef _WIN32
+    return (_commit(_fileno(file)) == 0) ? 0 : -1;
+#else
+    return (fsync(fileno(file)) == 0) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief Atomically replaces a file with a completed temporary file.
+ * @param savingPath The path of the complete temporary file.
+ * @param path The path of the file to replace.
+ * @return Returns 0 on success, -1 on failure (path is left as it was).
+ */
+int replaceDataFile(const char* savingPath, const char* path) {
+    if (!savingPath || !path) {
+        return -1;
+    }
+#ifdef _WIN32
+    // rename() refuses to replace an existing file on Windows
+    bool replaced = MoveFileExA(savingPath, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    bool replaced = rename(savingPath, path) == 0;
+#endif
+    if (!replaced) {
+        remove(savingPath); // The old file is untouched, so the copy is not needed
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Opens the temporary file of a save and reserves its header.
+ * @param path The path of the data file.
+ * @param savingPath Receives the path of the temporary file.
+ * @param size The size of the savingPath buffer.
+ * @param header Receives the placeholder header.
+ * @param recordType The record type stored in the header.
+ * @param recordSize The size of one record in bytes.
+ * @return The open file, or NULL on failure.
+ */
+static FILE* beginDataFile(const char* path, char* savingPath, size_t size, DataFileHeader* header,
+                           uint32_t recordType, size_t recordSize) {
+    snprintf(savingPath, size, "%s.saving.tmp", path);
+
+    FILE* file = fopen(savingPath, "wb");
+    if (!file) {
+        return NULL;
+    }
+
+    // A placeholder header first; the count and checksum are known at the end
+    initDataFileHeader(header, recordType, recordSize, 0);
+    if (writeDataFileHeader(file, header) != 0) {
+        fclose(file);
+        remove(savingPath);
+        return NULL;
+    }
+    return file;
+}
+
+/**
+ * @brief Completes the header of a save, syncs it and renames it into place.
+ * @param file The temporary file.
+ * @param ok Whether all records were written.
+ * @param path The path of the data file.
+ * @param savingPath The path of the temporary file.
+ * @param written The header with the final count and checksum.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int finishDataFile(FILE* file, bool ok, const char* path, const char* savingPath,
+                          const DataFileHeader* written) {
+    ok = ok && writeDataFileHeader(file, written) == 0 && syncDataFile(file) == 0;
+    if (fclose(file) != 0 || !ok) {
+        remove(savingPath);
+        return -1;
+    }
+
+    // Replace the old file only once the new one is complete
+    return replaceDataFile(savingPath, path);
+}
+
+/**
+ * @brief Writes records to a data file, plainly or in compressed blocks.
+ */
+typedef struct RecordWriter {
+    FILE* file;                 // File being written
+    size_t recordSize;          // Size of one record in bytes
+    size_t blockBytes;          // Raw size of a full block (0 for plain files)
+    unsigned char* block;       // Records of the block being filled
+    size_t blockFill;           // Bytes in the block
+    unsigned char* packed;      // Compressed block
+    uint64_t* offsets;          // File offset of each block written
+    size_t blockCount;          // Number of blocks written
+    size_t offsetCapacity;      // Allocated entries of offsets
+    uint64_t position;          // Current file offset
+    uint32_t checksum;          // CRC32C of the records written
+    size_t keyOffset;           // Offset of the indexed key field
+    size_t keyLength;           // Size of the indexed key field (0 for no key index)
+    unsigned char* entries;     // Key index entries in file order
+    size_t entryCount;          // Number of entries
+    size_t entryCapacity;       // Allocated entries
+    bool ok;                    // No write has failed
+} RecordWriter;
+
+/**
+ * @brief Prepares a writer for the records after a freshly written header.
+ * @param writer The writer.
+ * @param file The file positioned after the header.
+ * @param header The header of the file.
+ * @param key The key field to index, or NULL for no key index.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int initRecordWriter(RecordWriter* writer, FILE* file, const DataFileHeader* header, const DataFileKey* key) {
+    memset(writer, 0, sizeof(*writer));
+    writer->file = file;
+    writer->recordSize = header->recordSize;
+    writer->position = (uint64_t)header->headerSize + header->metadataSize;
+    writer->ok = true;
+    if (key) {
+        writer->keyOffset = key->offset;
+        writer->keyLength = key->length;
+    }
+    if (header->flags & dataFileCompressed) {
+        writer->blockBytes = (size_t)header->blockRecords * header->recordSize;
+        writer->block = (unsigned char*)malloc(writer->blockBytes);
+        writer->packed = (unsigned char*)malloc(writer->blockBytes);
+        if (!writer->block || !writer->packed) {
+            free(writer->block);
+            free(writer->packed);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Compresses one block and writes it with its packed size.
+ * @param writer The writer.
+ * @param data The raw records of the block.
+ * @param size The raw size of the block in bytes.
+ */
+static void writeBlock(RecordWriter* writer, const unsigned char* data, size_t size) {
+    if (!writer->ok) {
+        return;
+    }
+    if (writer->blockCount == writer->offsetCapacity) {
+        size_t capacity = (writer->offsetCapacity > 0) ? writer->offsetCapacity * 2 : 64;
+        uint64_t* offsets = (uint64_t*)realloc(writer->offsets, capacity * sizeof(uint64_t));
+        if (!offsets) {
+            writer->ok = false;
+            return;
+        }
+        writer->offsets = offsets;
+        writer->offsetCapacity = capacity;
+    }
+    writer->offsets[writer->blockCount++] = writer->position;
+
+    // Blocks that do not shrink are stored as they are, marked by a packed size equal to the raw size
+    size_t packedSize = lzpackCompress(data, size, writer->packed, size - 1);
+    const unsigned char* stored = (packedSize > 0) ? writer->packed : data;
+    uint32_t storedSize = (uint32_t)((packedSize > 0) ? packedSize : size);
+    writer->ok = fwrite(&storedSize, sizeof(storedSize), 1, writer->file) == 1 &&
+                 fwrite(stored, storedSize, 1, writer->file) == 1;
+    writer->position += sizeof(storedSize) + storedSize;
+}
+
+/**
+ * @brief Fills one key index entry: the key zero-padded to keyLength, then the slot.
+ * @param entry The entry to fill.
+ * @param key The key field of the record.
+ * @param keyLength The size of the key field in bytes.
+ * @param slot The slot of the record.
+ */
+static void fillIndexEntry(unsigned char* entry, const char* key, size_t keyLength, uint32_t slot) {
+    // Bytes after the terminator are zeroed, so stored keys compare with memcmp like strcmp
+    size_t length = 0;
+    while (length < keyLength && key[length] != '\0') {
+        length++;
+    }
+    memcpy(entry, key, length);
+    memset(entry + length, 0, keyLength - length);
+    memcpy(entry + keyLength, &slot, sizeof(slot));
+}
+
+/**
+ * @brief Remembers the keys and slots of records for the key index.
+ * @param writer The writer.
+ * @param records The records.
+ * @param count The number of records.
+ */
+static void addIndexEntries(RecordWriter* writer, const unsigned char* records, size_t count) {
+    size_t entrySize = writer->keyLength + sizeof(uint32_t);
+    if (writer->entryCount + count > writer->entryCapacity) {
+        size_t capacity = (writer->entryCapacity > 0) ? writer->entryCapacity * 2 : 1024;
+        while (capacity < writer->entryCount + count) {
+            capacity *= 2;
+        }
+        unsigned char* entries = (unsigned char*)realloc(writer->entries, capacity * entrySize);
+        if (!entries) {
+            writer->ok = false;
+            return;
+        }
+        writer->entries = entries;
+        writer->entryCapacity = capacity;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const char* key = (const char*)records + i * writer->recordSize + writer->keyOffset;
+        unsigned char* entry = writer->entries + writer->entryCount * entrySize;
+        fillIndexEntry(entry, key, writer->keyLength, (uint32_t)writer->entryCount++);
+    }
+}
+
+/**
+ * @brief Sorts key index entries by key, then slot.
+ * @param entries The entries in file order.
+ * @param count The number of entries.
+ * @param keyLength The size of the key field in bytes.
+ * @return The malloc'd sorted items pointing into the entries, or NULL on failure.
+ */
+static SortItem* sortIndexEntries(unsigned char* entries, size_t count, size_t keyLength) {
+    size_t entrySize = keyLength + sizeof(uint32_t);
+    SortItem* items = (SortItem*)malloc((count > 0 ? count : 1) * sizeof(SortItem));
+    if (!items) {
+        return NULL;
+    }
+
+    // Ties keep file order, so the first entry of a key is its earliest record
+    SortKey keys[2] = {
+        { SORT_KEY_STRING, 0, (int)keyLength, false },
+        { SORT_KEY_INT, keyLength, 0, false }
+    };
+    for (size_t i = 0; i < count; i++) {
+        items[i].data = entries + i * entrySize;
+        items[i].owner = NULL;
+    }
+    if (count > 1 && sortItemsByKeys(items, (int)count, keys, 2) != 0) {
+        free(items);
+        return NULL;
+    }
+    return items;
+}
+
+/**
+ * @brief Adds the fences and footer after sorted entries laid out at the start of an index.
+ * @param index The index with its sorted entries in place.
+ * @param count The number of entries.
+ * @param keyOffset The offset of the key field in a record.
+ * @param keyLength The size of the key field in bytes.
+ * @return The size of the index in bytes.
+ */
+static size_t finishKeyIndex(unsigned char* index, size_t count, size_t keyOffset, size_t keyLength) {
+    size_t entrySize = keyLength + sizeof(uint32_t);
+    size_t fenceCount = (count + dataFileFenceStride - 1) / dataFileFenceStride;
+    size_t indexSize = (size_t)getIndexSize(count, keyLength, dataFileFenceStride);
+
+    // Each run of entries is followed later by a fence with its first key and checksum
+    unsigned char* fences = index + count * entrySize;
+    for (size_t first = 0; first < count; first += dataFileFenceStride) {
+        size_t runCount = (count - first < dataFileFenceStride) ? count - first : dataFileFenceStride;
+        unsigned char* run = index + first * entrySize;
+        unsigned char* fence = fences + (first / dataFileFenceStride) * entrySize;
+        uint32_t runChecksum = crc32c(0, run, runCount * entrySize);
+        memcpy(fence, run, keyLength);
+        memcpy(fence + keyLength, &runChecksum, sizeof(runChecksum));
+    }
+
+    DataFileIndexFooter footer;
+    memset(&footer, 0, sizeof(footer));
+    footer.magic = dataFileIndexMagic;
+    footer.keyOffset = (uint32_t)keyOffset;
+    footer.keyLength = (uint32_t)keyLength;
+    footer.entryCount = (uint32_t)count;
+    footer.fenceStride = dataFileFenceStride;
+    footer.indexSize = indexSize;
+    footer.checksum = crc32c(crc32c(0, fences, fenceCount * entrySize), &footer,
+                             offsetof(DataFileIndexFooter, checksum));
+    memcpy(fences + fenceCount * entrySize, &footer, sizeof(footer));
+    return indexSize;
+}
+
+/**
+ * @brief Sorts key index entries and lays out the index with its fences and footer.
+ * @param entries The entries in file order.
+ * @param count The number of entries.
+ * @param keyOffset The offset of the key field in a record.
+ * @param keyLength The size of the key field in bytes.
+ * @param size Receives the size of the index in bytes.
+ * @return The malloc'd index, or NULL on memory allocation failure.
+ */
+static unsigned char* buildKeyIndex(unsigned char* entries, size_t count, size_t keyOffset, size_t keyLength,
+                                    size_t* size) {
+    size_t entrySize = keyLength + sizeof(uint32_t);
+    unsigned char* index = (unsigned char*)malloc((size_t)getIndexSize(count, keyLength, dataFileFenceStride));
+    SortItem* items = index ? sortIndexEntries(entries, count, keyLength) : NULL;
+    if (!items) {
+        free(index);
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        memcpy(index + i * entrySize, items[i].data, entrySize);
+    }
+    free(items);
+    *size = finishKeyIndex(index, count, keyOffset, keyLength);
+    return index;
+}
+
+/**
+ * @brief Sorts the remembered entries and writes the key index with its fences and footer.
+ * @param writer The writer.
+ */
+static void writeKeyIndex(RecordWriter* writer) {
+    size_t size = 0;
+    unsigned char* index = writer->ok ? buildKeyIndex(writer->entries, writer->entryCount, writer->keyOffset,
+                                                      writer->keyLength, &size) : NULL;
+    writer->ok = index != NULL && fwrite(index, size, 1, writer->file) == 1;
+    free(index);
+}
+
+/**
+ * @brief Builds the key index of records that are not written through a writer.
+ * @param records The records in file order.
+ * @param count The number of records.
+ * @param key The key field to index.
+ * @param size Receives the size of the index in bytes.
+ * @return The malloc'd index, or NULL on failure.
+ */
+void* buildDataFileKeyIndex(const void* const* records, size_t count, const DataFileKey* key, size_t* size) {
+    if ((!records && count > 0) || !key || !size || key->length == 0 || key->length > dataFileMaxKeyLength ||
+        count > UINT32_MAX) {
+        return NULL;
+    }
+    size_t entrySize = key->length + sizeof(uint32_t);
+    unsigned char* entries = (unsigned char*)malloc((count > 0 ? count : 1) * entrySize);
+    if (!entries) {
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        fillIndexEntry(entries + i * entrySize, (const char*)records[i] + key->offset, key->length, (uint32_t)i);
+    }
+    unsigned char* index = buildKeyIndex(entries, count, key->offset, key->length, size);
+    free(entries);
+    return index;
+}
+
+/**
+ * @brief Checks an index read back from a file against its footer, fences and run checksums.
+ * @param index The index.
+ * @param indexSize The size of the index in bytes.
+ * @param footer Receives the footer of the index.
+ * @return Returns 0 if the index is intact, -1 otherwise.
+ */
+static int checkKeyIndex(const unsigned char* index, size_t indexSize, DataFileIndexFooter* footer) {
+    if (indexSize < sizeof(*footer)) {
+        return -1;
+    }
+    memcpy(footer, index + indexSize - sizeof(*footer), sizeof(*footer));
+    if (footer->magic != dataFileIndexMagic || footer->keyLength == 0 ||
+        footer->keyLength > dataFileMaxKeyLength || footer->fenceStride == 0 ||
+        footer->indexSize != indexSize ||
+        getIndexSize(footer->entryCount, footer->keyLength, footer->fenceStride) != indexSize) {
+        return -1;
+    }
+    size_t entrySize = footer->keyLength + sizeof(uint32_t);
+    size_t count = footer->entryCount;
+    size_t fenceCount = (count + footer->fenceStride - 1) / footer->fenceStride;
+    const unsigned char* fences = index + count * entrySize;
+    if (crc32c(crc32c(0, fences, fenceCount * entrySize), footer, offsetof(DataFileIndexFooter, checksum)) !=
+        footer->checksum) {
+        return -1;
+    }
+    for (size_t first = 0; first < count; first += footer->fenceStride) {
+        size_t runCount = (count - first < footer->fenceStride) ? count - first : footer->fenceStride;
+        const unsigned char* fence = fences + (first / footer->fenceStride) * entrySize;
+        uint32_t runChecksum;
+        memcpy(&runChecksum, fence + footer->keyLength, sizeof(runChecksum));
+        if (crc32c(0, index + first * entrySize, runCount * entrySize) != runChecksum) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Builds the key index of a file from its old index and the records appended to it.
+ * @param oldIndex The index the file had before the records were appended.
+ * @param oldSize The size of the old index in bytes.
+ * @param records The appended records in file order.
+ * @param count The number of appended records.
+ * @param size Receives the size of the new index in bytes.
+ * @return The malloc'd index, or NULL if the old index is damaged or on failure.
+ */
+void* appendDataFileKeyIndex(const void* oldIndex, size_t oldSize, const void* const* records, size_t count,
+                             size_t* size) {
+    DataFileIndexFooter footer;
+    if (!oldIndex || (!records && count > 0) || !size ||
+        checkKeyIndex((const unsigned char*)oldIndex, oldSize, &footer) != 0 ||
+        (uint64_t)footer.entryCount + count > UINT32_MAX) {
+        return NULL;
+    }
+    size_t keyLength = footer.keyLength;
+    size_t entrySize = keyLength + sizeof(uint32_t);
+    size_t oldCount = footer.entryCount;
+    size_t total = oldCount + count;
+    unsigned char* entries = (unsigned char*)malloc((count > 0 ? count : 1) * entrySize);
+    unsigned char* index = (unsigned char*)malloc((size_t)getIndexSize(total, keyLength, dataFileFenceStride));
+    if (!entries || !index) {
+        free(entries);
+        free(index);
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        fillIndexEntry(entries + i * entrySize, (const char*)records[i] + footer.keyOffset, keyLength,
+                       (uint32_t)(oldCount + i));
+    }
+    SortItem* items = sortIndexEntries(entries, count, keyLength);
+    if (!items) {
+        free(entries);
+        free(index);
+        return NULL;
+    }
+
+    // Only the new entries are sorted; they merge into the old ones, which keep the lower slots on ties
+    const unsigned char* old = (const unsigned char*)oldIndex;
+    size_t i = 0;
+    size_t j = 0;
+    for (size_t k = 0; k < total; k++) {
+        const unsigned char* next;
+        if (j == count || (i < oldCount && memcmp(old + i * entrySize, items[j].data, keyLength) <= 0)) {
+            next = old + (i++) * entrySize;
+        } else {
+            next = (const unsigned char*)items[j++].data;
+        }
+        memcpy(index + k * entrySize, next, entrySize);
+    }
+    free(items);
+    free(entries);
+    *size = finishKeyIndex(index, total, footer.keyOffset, keyLength);
+    return index;
+}
+
+/**
+ * @brief Writes records one after another, filling and compressing blocks as needed.
+ * @param writer The writer.
+ * @param records The records.
+ * @param count The number of records.
+ */
+static void writeRecords(RecordWriter* writer, const void* records, size_t count) {
+    const unsigned char* bytes = (const unsigned char*)records;
+    size_t size = count * writer->recordSize;
+    writer->checksum = crc32c(writer->checksum, bytes, size);
+    if (writer->keyLength > 0) {
+        addIndexEntries(writer, bytes, count);
+    }
+    if (writer->blockBytes == 0) {
+        writer->ok = writer->ok && (size == 0 || fwrite(bytes, size, 1, writer->file) == 1);
+        return;
+    }
+
+    while (size > 0) {
+        if (writer->blockFill == 0 && size >= writer->blockBytes) {
+            writeBlock(writer, bytes, writer->blockBytes); // Whole blocks need no copy
+            bytes += writer->blockBytes;
+            size -= writer->blockBytes;
+            continue;
+        }
+        size_t chunk = writer->blockBytes - writer->blockFill;
+        if (chunk > size) {
+            chunk = size;
+        }
+        memcpy(writer->block + writer->blockFill, bytes, chunk);
+        writer->blockFill += chunk;
+        bytes += chunk;
+        size -= chunk;
+        if (writer->blockFill == writer->blockBytes) {
+            writeBlock(writer, writer->block, writer->blockFill);
+            writer->blockFill = 0;
+        }
+    }
+}
+
+/**
+ * @brief Writes the last partial block, the block index and the key index, and frees the writer.
+ * @param writer The writer.
+ * @return Whether every write succeeded.
+ */
+static bool finishRecordWriter(RecordWriter* writer) {
+    if (writer->blockBytes > 0) {
+        if (writer->blockFill > 0) {
+            writeBlock(writer, writer->block, writer->blockFill);
+        }
+        writer->ok = writer->ok && (writer->blockCount == 0 ||
+                     fwrite(writer->offsets, sizeof(uint64_t), writer->blockCount, writer->file) == writer->blockCount);
+    }
+    if (writer->keyLength > 0 && writer->ok) {
+        writeKeyIndex(writer);
+    }
+    free(writer->block);
+    free(writer->packed);
+    free(writer->offsets);
+    free(writer->entries);
+    return writer->ok;
+}
+
+/**
+ * @brief Checks that a key field can be indexed.
+ * @param key The key field, or NULL for no key index.
+ * @param recordSize The size of one record in bytes.
+ * @return true if there is no key or it lies within the record and is not too long.
+ */
+static bool isIndexableKey(const DataFileKey* key, size_t recordSize) {
+    return !key || (key->length > 0 && key->length <= dataFileMaxKeyLength &&
+                    key->offset <= recordSize && key->length <= recordSize - key->offset);
+}
+
+/**
+ * @brief A data file being written in pieces.
+ */
+struct DataFileWriter {
+    FILE* file;                 // Temporary file being written
+    char path[256];             // Path of the data file
+    char savingPath[300];       // Path of the temporary file
+    DataFileHeader header;      // Header completed when the writer is closed
+    RecordWriter records;       // Writer of the records and their indexes
+    size_t count;               // Records written so far
+};
+
+/**
+ * @brief Starts writing a data file whose records arrive in pieces.
+ * @param path The path of the data file.
+ * @param recordType The record type and options stored in the header.
+ * @param recordSize The size of one record in bytes.
+ * @param key The key field to index. Can be NULL.
+ * @return The writer, or NULL on failure.
+ */
+DataFileWriter* openDataFileWriter(const char* path, uint32_t recordType, size_t recordSize, const DataFileKey* key) {
+    if (!path || recordSize == 0 || !isIndexableKey(key, recordSize)) {
+        return NULL;
+    }
+    DataFileWriter* writer = (DataFileWriter*)malloc(sizeof(DataFileWriter));
+    if (!writer || snprintf(writer->path, sizeof(writer->path), "%s", path) >= (int)sizeof(writer->path)) {
+        free(writer);
+        return NULL;
+    }
+    writer->count = 0;
+    writer->file = beginDataFile(path, writer->savingPath, sizeof(writer->savingPath), &writer->header,
+                                 key ? (recordType | dataFileIndexed) : (recordType & ~dataFileIndexed), recordSize);
+    if (!writer->file) {
+        free(writer);
+        return NULL;
+    }
+    if (initRecordWriter(&writer->records, writer->file, &writer->header, key) != 0) {
+        fclose(writer->file);
+        remove(writer->savingPath);
+        free(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+/**
+ * @brief Writes the next records of a data file.
+ * @param writer The writer.
+ * @param records The records, one after another.
+ * @param count The number of records.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int appendDataFileRecords(DataFileWriter* writer, const void* records, size_t count) {
+    if (!writer || (!records && count > 0) || count > UINT32_MAX - writer->count) {
+        if (writer) {
+            writer->records.ok = false;
+        }
+        return -1;
+    }
+    if (writer->records.ok && count > 0) {
+        writeRecords(&writer->records, records, count);
+        writer->count += count;
+    }
+    return writer->records.ok ? 0 : -1;
+}
+
+/**
+ * @brief Completes a data file and renames it into place, or discards it.
+ * @param writer The writer, freed by this call.
+ * @param keep true to complete the file, false to discard it.
+ * @param header Receives the header that was written. Can be NULL.
+ * @return The number of records written, or -1 on failure or if the file was discarded.
+ */
+int closeDataFileWriter(DataFileWriter* writer, bool keep, DataFileHeader* header) {
+    if (!writer) {
+        return -1;
+    }
+    writer->records.ok = writer->records.ok && keep; // A discarded file needs no key index
+    bool ok = finishRecordWriter(&writer->records);
+    writer->header.recordCount = (uint32_t)writer->count;
+    writer->header.checksum = writer->records.checksum;
+    int result = (finishDataFile(writer->file, ok, writer->path, writer->savingPath, &writer->header) == 0)
+                     ? (int)writer->count : -1;
+    if (result >= 0 && header) {
+        *header = writer->header;
+    }
+    free(writer);
+    return result;
+}
+
+/**
+ * @brief Writes the records of a list as a complete data file.
+ * @param dataList The list of fixed-size records.
+ * @param path The path of the data file.
+ * @param recordType The record type and options stored in the header.
+ * @param recordSize The size of one record in bytes.
+ * @param key The key field to index. Can be NULL.
+ * @param header Receives the header that was written. Can be NULL.
+ * @return The number of records written, or -1 on failure.
+ */
+int writeDataFile(const list* dataList, const char* path, uint32_t recordType, size_t recordSize,
+                  const DataFileKey* key, DataFileHeader* header) {
+    if (!dataList) {
+        return -1;
+    }
+    DataFileWriter* writer = openDataFileWriter(path, recordType, recordSize, key);
+    if (!writer) {
+        return -1;
+    }
+
+    node* current = dataList->head;
+    if (current != NULL) {
+        do {
+            if (current->data != NULL && appendDataFileRecords(writer, current->data, 1) != 0) {
+                break;
+            }
+            current = current->next;
+        } while (current != dataList->head && current != NULL);
+    }
+    return closeDataFileWriter(writer, true, header);
+}
+
+/**
+ * @brief Writes an array of records as a complete data file.
+ * @param records The records, one after another.
+ * @param count The number of records.
+ * @param path The path of the data file.
+ * @param recordType The record type and options stored in the header.
+ * @param recordSize The size of one record in bytes.
+ * @param key The key field to index. Can be NULL.
+ * @return The number of records written, or -1 on failure.
+ */
+int writeDataFileRecords(const void* records, size_t count, const char* path, uint32_t recordType,
+                         size_t recordSize, const DataFileKey* key) {
+    if (!records && count > 0) {
+        return -1;
+    }
+    DataFileWriter* writer = openDataFileWriter(path, recordType, recordSize, key);
+    if (!writer) {
+        return -1;
+    }
+    appendDataFileRecords(writer, records, count);
+    return closeDataFileWriter(writer, true, NULL);
+}
+
+/**
+ * @brief Reads one block frame and decompresses it.
+ * @param file The file positioned at the frame.
+ * @param rawSize The size of the block's records in bytes.
+ * @param destination The buffer for the records.
+ * @param packed A buffer of at least rawSize bytes for the packed data.
+ * @return Returns 0 on success, -1 on failure or corruption.
+ */
+static int readBlockFrame(FILE* file, size_t rawSize, void* destination, unsigned char* packed) {
+    uint32_t packedSize;
+    if (fread(&packedSize, sizeof(packedSize), 1, file) != 1) {
+        return -1;
+    }
+    if (packedSize == rawSize) {
+        return (fread(destination, rawSize, 1, file) == 1) ? 0 : -1;
+    }
+    if (packedSize == 0 || packedSize > rawSize || fread(packed, packedSize, 1, file) != 1) {
+        return -1;
+    }
+    return lzpackDecompress(packed, packedSize, destination, rawSize);
+}
+
+/**
+ * @brief Starts reading the records of a validated data file.
+ * @param reader The reader to initialize.
+ * @param file The file positioned at the first record.
+ * @param header The header of the file.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int initDataFileReader(DataFileReader* reader, FILE* file, const DataFileHeader* header) {
+    if (!reader || !file || !header) {
+        return -1;
+    }
+    memset(reader, 0, sizeof(*reader));
+    reader->file = file;
+    reader->header = *header;
+    reader->recordsLeft = header->recordCount;
+    if ((header->flags & dataFileCompressed) && header->recordCount > 0) {
+        size_t blockBytes = (size_t)header->blockRecords * header->recordSize;
+        reader->block = (unsigned char*)malloc(blockBytes);
+        reader->packed = (unsigned char*)malloc(blockBytes);
+        if (!reader->block || !reader->packed) {
+            closeDataFileReader(reader);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reads the next records of a data file.
+ * @param reader The reader.
+ * @param records The buffer for the records.
+ * @param count The number of records to read.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int readDataFileRecords(DataFileReader* reader, void* records, size_t count) {
+    if (!reader || (count > 0 && !records)) {
+        return -1;
+    }
+    size_t recordSize = reader->header.recordSize;
+    size_t buffered = (reader->blockSize - reader->blockOffset) / recordSize;
+    if (count > reader->recordsLeft + buffered) {
+        return -1;
+    }
+    if (!(reader->header.flags & dataFileCompressed)) {
+        reader->recordsLeft -= count;
+        return (count == 0 || fread(records, recordSize, count, reader->file) == count) ? 0 : -1;
+    }
+
+    unsigned char* out = (unsigned char*)records;
+    size_t size = count * recordSize;
+    while (size > 0) {
+        if (reader->blockOffset < reader->blockSize) {
+            size_t chunk = reader->blockSize - reader->blockOffset;
+            if (chunk > size) {
+                chunk = size;
+            }
+            memcpy(out, reader->block + reader->blockOffset, chunk);
+            reader->blockOffset += chunk;
+            out += chunk;
+            size -= chunk;
+            continue;
+        }
+
+        size_t blockRecords = reader->header.blockRecords;
+        if (blockRecords > reader->recordsLeft) {
+            blockRecords = reader->recordsLeft;
+        }
+        size_t rawSize = blockRecords * recordSize;
+        bool direct = size >= rawSize; // A block the caller wants whole skips the copy
+        if (readBlockFrame(reader->file, rawSize, direct ? out : reader->block, reader->packed) != 0) {
+            return -1;
+        }
+        reader->recordsLeft -= blockRecords;
+        if (direct) {
+            out += rawSize;
+            size -= rawSize;
+        } else {
+            reader->blockOffset = 0;
+            reader->blockSize = rawSize;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Releases the buffers of a reader.
+ * @param reader The reader.
+ */
+void closeDataFileReader(DataFileReader* reader) {
+    if (!reader) {
+        return;
+    }
+    free(reader->block);
+    free(reader->packed);
+    reader->block = NULL;
+    reader->packed = NULL;
+    reader->blockOffset = 0;
+    reader->blockSize = 0;
+}
+
+/**
+ * @brief Returns the number of records per block used by readDataFileBlock().
+ * @param header The header of the file.
+ * @return The records per block.
+ */
+size_t getDataFileBlockRecords(const DataFileHeader* header) {
+    if (!header) {
+        return 1;
+    }
+    return (header->blockRecords > 0) ? header->blockRecords : blockRecordsFor(header->recordSize);
+}
+
+/**
+ * @brief Reads one block of records from anywhere in a data file.
+ * @param file The data file.
+ * @param header The header of the file.
+ * @param blockIndex The index of the block.
+ * @param records The buffer for the records of the block.
+ * @return The number of records read, or -1 on failure.
+ */
+int readDataFileBlock(FILE* file, const DataFileHeader* header, size_t blockIndex, void* records) {
+    if (!file || !header || !records) {
+        return -1;
+    }
+    size_t blockRecords = getDataFileBlockRecords(header);
+    size_t recordSize = header->recordSize;
+    if (blockIndex >= ((size_t)header->recordCount + blockRecords - 1) / blockRecords) {
+        return -1;
+    }
+    size_t first = blockIndex * blockRecords;
+    size_t count = ((size_t)header->recordCount - first < blockRecords) ? header->recordCount - first : blockRecords;
+
+    if (!(header->flags & dataFileCompressed)) {
+        // Legacy files keep their count between the metadata and the records
+        int64_t recordStart = (int64_t)header->headerSize + header->metadataSize +
+                              ((header->version == 0) ? (int64_t)sizeof(int) : 0);
+        if (seekDataFile(file, recordStart + (int64_t)first * (int64_t)recordSize, SEEK_SET) != 0 ||
+            fread(records, recordSize, count, file) != count) {
+            return -1;
+        }
+        return (int)count;
+    }
+
+    // The index entry of the block says where its frame starts
+    uint64_t offset;
+    int64_t contentEnd = getContentEnd(file, header);
+    int64_t entryFromEnd = (int64_t)(getBlockCount(header) - blockIndex) * (int64_t)sizeof(uint64_t);
+    if (contentEnd < entryFromEnd || seekDataFile(file, contentEnd - entryFromEnd, SEEK_SET) != 0 ||
+        fread(&offset, sizeof(offset), 1, file) != 1 || offset > (uint64_t)INT64_MAX ||
+        seekDataFile(file, (int64_t)offset, SEEK_SET) != 0) {
+        return -1;
+    }
+    unsigned char* packed = (unsigned char*)malloc(count * recordSize);
+    int result = (packed && readBlockFrame(file, count * recordSize, records, packed) == 0) ? (int)count : -1;
+    free(packed);
+    return result;
+}
+
+/**
+ * @brief Reads one record by its slot.
+ * @param file The data file.
+ * @param header The header of the file.
+ * @param slot The position of the record in the file.
+ * @param record The buffer for the record.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int readDataFileRecord(FILE* file, const DataFileHeader* header, size_t slot, void* record) {
+    if (!file || !header || !record || slot >= header->recordCount) {
+        return -1;
+    }
+    size_t recordSize = header->recordSize;
+    if (!(header->flags & dataFileCompressed)) {
+        int64_t recordStart = (int64_t)header->headerSize + header->metadataSize +
+                              ((header->version == 0) ? (int64_t)sizeof(int) : 0);
+        return (seekDataFile(file, recordStart + (int64_t)slot * (int64_t)recordSize, SEEK_SET) == 0 &&
+                fread(record, recordSize, 1, file) == 1) ? 0 : -1;
+    }
+
+    // A compressed record is only reachable through its whole block
+    size_t blockRecords = getDataFileBlockRecords(header);
+    unsigned char* block = (unsigned char*)malloc(blockRecords * recordSize);
+    int result = (block && readDataFileBlock(file, header, slot / blockRecords, block) >= 0) ? 0 : -1;
+    if (result == 0) {
+        memcpy(record, block + (slot % blockRecords) * recordSize, recordSize);
+    }
+    free(block);
+    return result;
+}
+
+/**
+ * @brief Finds the slot of the first record with a key through the key index.
+ * @param file The data file.
+ * @param header The header of the file.
+ * @param field The key field the index must have been built over.
+ * @param key The key to find.
+ * @param slot Receives the slot of the first record with the key.
+ * @param duplicated Receives whether more than one record has the key. Can be NULL.
+ * @return Returns 1 if found, 0 if not found, -1 if the file has no valid index or on failure.
+ */
+int findDataFileKey(FILE* file, const DataFileHeader* header, const DataFileKey* field, const char* key,
+                    size_t* slot, bool* duplicated) {
+    if (!file || !header || !field || !key || !slot || !(header->flags & dataFileIndexed)) {
+        return -1;
+    }
+    if (seekDataFile(file, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    int64_t fileSize = tellDataFile(file);
+    DataFileIndexFooter footer;
+    if (readIndexFooter(file, header, fileSize, &footer) != 0 ||
+        footer.keyOffset != field->offset || footer.keyLength != field->length) {
+        return -1;
+    }
+    size_t keyLength = footer.keyLength;
+    size_t entrySize = keyLength + sizeof(uint32_t);
+    size_t count = footer.entryCount;
+    size_t fenceCount = (count + footer.fenceStride - 1) / footer.fenceStride;
+
+    // The key is padded like the stored keys; a longer one cannot be in the field
+    unsigned char target[dataFileMaxKeyLength];
+    size_t length = strlen(key);
+    if (length > keyLength) {
+        return 0;
+    }
+    memcpy(target, key, length);
+    memset(target + length, 0, keyLength - length);
+
+    int64_t indexStart = fileSize - (int64_t)footer.indexSize;
+    unsigned char* fences = (unsigned char*)malloc((fenceCount > 0 ? fenceCount : 1) * entrySize);
+    unsigned char* run = (unsigned char*)malloc((size_t)footer.fenceStride * entrySize);
+    int result = -1;
+    if (!fences || !run || seekDataFile(file, indexStart + (int64_t)count * (int64_t)entrySize, SEEK_SET) != 0 ||
+        (fenceCount > 0 && fread(fences, entrySize, fenceCount, file) != fenceCount) ||
+        crc32c(crc32c(0, fences, fenceCount * entrySize), &footer, offsetof(DataFileIndexFooter, checksum)) !=
+        footer.checksum) {
+        goto cleanup;
+    }
+
+    // The first entry with the key is in the last run starting below it, or starts the next run
+    size_t low = 0;
+    size_t high = fenceCount;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (memcmp(fences + middle * entrySize, target, keyLength) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    result = 0;
+    if (fenceCount == 0) {
+        goto cleanup;
+    }
+    size_t fence = (low > 0) ? low - 1 : 0;
+    for (; fence <= low && fence < fenceCount; fence++) {
+        size_t first = fence * footer.fenceStride;
+        size_t runCount = (count - first < footer.fenceStride) ? count - first : footer.fenceStride;
+        uint32_t runChecksum;
+        memcpy(&runChecksum, fences + fence * entrySize + keyLength, sizeof(runChecksum));
+        if (seekDataFile(file, indexStart + (int64_t)first * (int64_t)entrySize, SEEK_SET) != 0 ||
+            fread(run, entrySize, runCount, file) != runCount || crc32c(0, run, runCount * entrySize) != runChecksum) {
+            result = -1;
+            goto cleanup;
+        }
+
+        size_t position = 0;
+        size_t end = runCount;
+        while (position < end) {
+            size_t middle = position + (end - position) / 2;
+            if (memcmp(run + middle * entrySize, target, keyLength) < 0) {
+                position = middle + 1;
+            } else {
+                end = middle;
+            }
+        }
+        if (position == runCount) {
+            continue; // Every key of this run is smaller
+        }
+        if (memcmp(run + position * entrySize, target, keyLength) == 0) {
+            uint32_t found;
+            memcpy(&found, run + position * entrySize + keyLength, sizeof(found));
+            if (found >= count) {
+                result = -1;
+                goto cleanup;
+            }
+            *slot = found;
+            if (duplicated) {
+                *duplicated = (position + 1 < runCount)
+                              ? memcmp(run + (position + 1) * entrySize, target, keyLength) == 0
+                              : fence + 1 < fenceCount && memcmp(fences + (fence + 1) * entrySize, target, keyLength) == 0;
+            }
+            result = 1;
+        }
+        break;
+    }
+
+cleanup:
+    free(fences);
+    free(run);
+    return result;
+}
+
+/**
+ * @brief Maps the start of a data file into memory copy-on-write.
+ * @param path The path of the file.
+ * @param size The number of bytes to map.
+ * @return The start of the mapping, or NULL on failure.
+ */
+void* mapDataFile(const char* path, size_t size) {
+    if (!path || size == 0) {
+        return NULL;
+    }
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) {
+        return NULL;
+    }
+    // The view keeps the file and the mapping object alive after the handles are closed
+    void* memory = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+    CloseHandle(mapping);
+    return memory;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    return (memory == MAP_FAILED) ? NULL : memory;
+#endif
+}
+
+/**
+ * @brief Moves a mapping into private memory at the same address, so its file can be replaced.
+ * @param memory The start of the mapping.
+ * @param size The size of the mapping.
+ * @return Returns 0 on success, -1 on failure (the mapping is left as it was).
+ */
+int detachDataFileMapping(void* memory, size_t size) {
+    if (!memory || size == 0) {
+        return -1;
+    }
+#ifdef _WIN32
+    MEMORY_BASIC_INFORMATION region;
+    if (VirtualQuery(memory, &region, sizeof(region)) == 0) {
+        return -1;
+    }
+    if (region.Type != MEM_MAPPED) {
+        return 0; // Already detached
+    }
+    void* copy = malloc(size);
+    if (!copy) {
+        return -1;
+    }
+    memcpy(copy, memory, size);
+
+    // Records are used by address, so the private memory must take exactly the view's place
+    UnmapViewOfFile(memory);
+    if (VirtualAlloc(memory, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE) != memory) {
+        // Only another thread allocating this very range in between can get here
+        fprintf(stderr, "Mapped records could not be moved into memory\n");
+        abort();
+    }
+    memcpy(memory, copy, size);
+    free(copy);
+    return 0;
+#else
+    (void)size;
+    return 0; // Mapped files can be replaced; the mapping keeps the old file's pages
+#endif
+}
+
+/**
+ * @brief Releases a mapping created by mapDataFile(), detached or not.
+ * @param memory The start of the mapping.
+ * @param size The size of the mapping.
+ */
+void unmapDataFile(void* memory, size_t size) {
+    if (!memory) {
+        return;
+    }
+#ifdef _WIN32
+    (void)size;
+    MEMORY_BASIC_INFORMATION region;
+    if (VirtualQuery(memory, &region, sizeof(region)) != 0 && region.Type != MEM_MAPPED) {
+        VirtualFree(memory, 0, MEM_RELEASE); // Detached by detachDataFileMapping()
+    } else {
+        UnmapViewOfFile(memory);
+    }
+#else
+    munmap(memory, size);
+#endif
+}
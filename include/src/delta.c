@@ -0,0 +1,655 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // For pread, pwrite and fsync
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "../headers/delta.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define deltaRunRecords 64            // Records written per positioned write
+#define deltaNoSlot SIZE_MAX          // Empty entry of the slot index
+
+/**
+ * @brief Slot tracking state of one list.
+ */
+typedef struct Tracker {
+    const list* dataList;               // Tracked list
+    char path[256];                     // Path of the data file
+    DataFileHeader header;              // Header of the file as last written
+    size_t count;                       // Number of slots in the file
+    const unsigned char* base;          // Record of slot 0 if the first slots are contiguous
+    size_t contiguousCount;             // Slots [0, contiguousCount) are at base + slot * recordSize
+    const void** slots;                 // Records of the slots from contiguousCount on
+    uint64_t* dirty;                    // One bit per slot
+    size_t* index;                      // Hash from records to positions in slots, built on demand
+    size_t indexMask;                   // Number of index entries minus one
+    struct Tracker* next;               // Next tracker in the registry
+} Tracker;
+
+static Tracker* trackers = NULL;
+
+/**
+ * @brief Returns the tracker of a list.
+ * @param dataList The list.
+ * @return The tracker, or NULL if the list is not tracked.
+ */
+static Tracker* findTracker(const list* dataList) {
+    for (Tracker* tracker = trackers; tracker != NULL; tracker = tracker->next) {
+        if (tracker->dataList == dataList) {
+            return tracker;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns the record that occupies a slot.
+ * @param tracker The tracker.
+ * @param slot The slot.
+ * @return The record.
+ */
+static const void* slotRecord(const Tracker* tracker, size_t slot) {
+    if (slot < tracker->contiguousCount) {
+        return tracker->base + slot * tracker->header.recordSize;
+    }
+    return tracker->slots[slot - tracker->contiguousCount];
+}
+
+/**
+ * @brief Hashes a record address into the slot index.
+ * @param record The record.
+ * @param mask The number of index entries minus one.
+ * @return The first index entry to probe.
+ */
+static size_t hashRecord(const void* record, size_t mask) {
+    return (size_t)(((uint64_t)(uintptr_t)record * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+/**
+ * @brief Builds the hash index over the non-contiguous slots.
+ * @param tracker The tracker.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int buildSlotIndex(Tracker* tracker) {
+    size_t slotCount = tracker->count - tracker->contiguousCount;
+    size_t capacity = 16;
+    while (capacity < slotCount * 2) {
+        capacity *= 2;
+    }
+    size_t* index = (size_t*)malloc(capacity * sizeof(size_t));
+    if (!index) {
+        return -1;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        index[i] = deltaNoSlot;
+    }
+    for (size_t i = 0; i < slotCount; i++) {
+        size_t entry = hashRecord(tracker->slots[i], capacity - 1);
+        while (index[entry] != deltaNoSlot) {
+            entry = (entry + 1) & (capacity - 1);
+        }
+        index[entry] = i;
+    }
+    tracker->index = index;
+    tracker->indexMask = capacity - 1;
+    return 0;
+}
+
+/**
+ * @brief Finds the slot of a record.
+ * @param tracker The tracker.
+ * @param record The record.
+ * @return The slot, or deltaNoSlot if the record has none.
+ */
+static size_t findSlot(Tracker* tracker, const void* record) {
+    const unsigned char* bytes = (const unsigned char*)record;
+    size_t recordSize = tracker->header.recordSize;
+    if (tracker->base && bytes >= tracker->base &&
+        bytes < tracker->base + tracker->contiguousCount * recordSize) {
+        size_t offset = (size_t)(bytes - tracker->base);
+        return (offset % recordSize == 0) ? offset / recordSize : deltaNoSlot;
+    }
+    if (tracker->count == tracker->contiguousCount) {
+        return deltaNoSlot;
+    }
+
+    if (!tracker->index && buildSlotIndex(tracker) != 0) {
+        return deltaNoSlot;
+    }
+    for (size_t entry = hashRecord(record, tracker->indexMask); tracker->index[entry] != deltaNoSlot;
+         entry = (entry + 1) & tracker->indexMask) {
+        if (tracker->slots[tracker->index[entry]] == record) {
+            return tracker->contiguousCount + tracker->index[entry];
+        }
+    }
+    return deltaNoSlot;
+}
+
+/**
+ * @brief Returns the first dirty slot at or after a slot.
+ * @param tracker The tracker.
+ * @param from The slot to start at.
+ * @return The dirty slot, or tracker->count if there is none.
+ */
+static size_t nextDirtySlot(const Tracker* tracker, size_t from) {
+    size_t wordCount = (tracker->count + 63) / 64;
+    size_t word = from / 64;
+    if (word >= wordCount) {
+        return tracker->count;
+    }
+    uint64_t bits = tracker->dirty[word] & (~0ull << (from % 64));
+    while (bits == 0) {
+        if (++word >= wordCount) {
+            return tracker->count;
+        }
+        bits = tracker->dirty[word];
+    }
+    return word * 64 + (size_t)__builtin_ctzll(bits);
+}
+
+/**
+ * @brief Tests the dirty bit of a slot.
+ * @param tracker The tracker.
+ * @param slot The slot.
+ * @return true if the slot is dirty.
+ */
+static bool isSlotDirty(const Tracker* tracker, size_t slot) {
+    return (tracker->dirty[slot / 64] >> (slot % 64)) & 1u;
+}
+
+/**
+ * @brief Frees the slot state of a tracker.
+ * @param tracker The tracker.
+ */
+static void clearTracker(Tracker* tracker) {
+    free(tracker->slots);
+    free(tracker->dirty);
+    free(tracker->index);
+    tracker->slots = NULL;
+    tracker->dirty = NULL;
+    tracker->index = NULL;
+}
+
+/**
+ * @brief Opens a data file for positioned reads and writes.
+ * @param path The path of the file.
+ * @return The file descriptor, or -1 on failure.
+ */
+static int openSlotFile(const char* path) {
+#ifdef _WIN32
+    return _open(path, _O_RDWR | _O_BINARY);
+#else
+    return open(path, O_RDWR);
+#endif
+}
+
+/**
+ * @brief Reads bytes at an offset of a file.
+ * @param fd The file descriptor.
+ * @param offset The offset in the file.
+ * @param buffer The buffer to read into.
+ * @param length The number of bytes.
+ * @return Returns 0 on success, -1 on failure or a short read.
+ */
+static int readAt(int fd, uint64_t offset, void* buffer, size_t length) {
+#ifdef _WIN32
+    return (_lseeki64(fd, (__int64)offset, SEEK_SET) >= 0 &&
+            _read(fd, buffer, (unsigned int)length) == (int)length) ? 0 : -1;
+#else
+    return (pread(fd, buffer, length, (off_t)offset) == (ssize_t)length) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief Writes bytes at an offset of a file.
+ * @param fd The file descriptor.
+ * @param offset The offset in the file.
+ * @param buffer The bytes to write.
+ * @param length The number of bytes.
+ * @return Returns 0 on success, -1 on failure or a short write.
+ */
+static int writeAt(int fd, uint64_t offset, const void* buffer, size_t length) {
+#ifdef _WIN32
+    return (_lseeki64(fd, (__int64)offset, SEEK_SET) >= 0 &&
+            _write(fd, buffer, (unsigned int)length) == (int)length) ? 0 : -1;
+#else
+    return (pwrite(fd, buffer, length, (off_t)offset) == (ssize_t)length) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief Forces the written bytes of a file to disk and closes it.
+ * @param fd The file descriptor.
+ * @param sync Whether to sync before closing.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int closeSlotFile(int fd, bool sync) {
+#ifdef _WIN32
+    bool ok = !sync || _commit(fd) == 0;
+    return (_close(fd) == 0 && ok) ? 0 : -1;
+#else
+    bool ok = !sync || fsync(fd) == 0;
+    return (close(fd) == 0 && ok) ? 0 : -1;
+#endif
+}
+
+/**
+ * @brief Reads the footer of a data file's key index.
+ * @param fd The file descriptor.
+ * @param header The header of the file.
+ * @param footer Receives the footer.
+ * @return Returns 0 if the file ends with a footer for its records, -1 otherwise.
+ */
+static int readKeyFooter(int fd, const DataFileHeader* header, DataFileIndexFooter* footer) {
+#ifdef _WIN32
+    __int64 size = _lseeki64(fd, 0, SEEK_END);
+#else
+    off_t size = lseek(fd, 0, SEEK_END);
+#endif
+    if (size < (int64_t)sizeof(*footer) || readAt(fd, (uint64_t)size - sizeof(*footer), footer, sizeof(*footer)) != 0) {
+        return -1;
+    }
+    return (footer->magic == dataFileIndexMagic && footer->keyLength > 0 &&
+            (uint64_t)footer->keyOffset + footer->keyLength <= header->recordSize) ? 0 : -1;
+}
+
+/**
+ * @brief Compares the key fields of two versions of a record like strcmp.
+ * @param oldRecord The record as stored.
+ * @param newRecord The record as it is now.
+ * @param footer The footer of the key index.
+ * @return true if both have the same key.
+ */
+static bool isSameKey(const unsigned char* oldRecord, const unsigned char* newRecord,
+                      const DataFileIndexFooter* footer) {
+    const char* oldKey = (const char*)oldRecord + footer->keyOffset;
+    const char* newKey = (const char*)newRecord + footer->keyOffset;
+    for (size_t i = 0; i < footer->keyLength; i++) {
+        if (oldKey[i] != newKey[i]) {
+            return false;
+        }
+        if (oldKey[i] == '\0') {
+            return true;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that no dirty record of an indexed file changed its key.
+ * @param tracker The tracker.
+ * @param fd The file descriptor.
+ * @param footer The footer of the key index.
+ * @param oldBytes A buffer for deltaRunRecords records.
+ * @return true if every dirty record keeps its key, so the key index stays valid.
+ */
+static bool keepsIndexedKeys(Tracker* tracker, int fd, const DataFileIndexFooter* footer, unsigned char* oldBytes) {
+    size_t recordSize = tracker->header.recordSize;
+    uint64_t recordStart = (uint64_t)tracker->header.headerSize + tracker->header.metadataSize;
+    for (size_t slot = nextDirtySlot(tracker, 0); slot < tracker->count;) {
+        size_t run = 0;
+        while (run < deltaRunRecords && slot + run < tracker->count && isSlotDirty(tracker, slot + run)) {
+            run++;
+        }
+        if (readAt(fd, recordStart + (uint64_t)slot * recordSize, oldBytes, run * recordSize) != 0) {
+            return false;
+        }
+        for (size_t i = 0; i < run; i++) {
+            if (!isSameKey(oldBytes + i * recordSize, (const unsigned char*)slotRecord(tracker, slot + i), footer)) {
+                return false;
+            }
+        }
+        slot = nextDirtySlot(tracker, slot + run);
+    }
+    return true;
+}
+
+/**
+ * @brief Builds a new key index over the tracked slots and the records appended after them.
+ * @param tracker The tracker.
+ * @param added The first appended node.
+ * @param addedCount The number of appended records.
+ * @param footer The footer of the file's current key index, for the key field.
+ * @param size Receives the size of the index in bytes.
+ * @return The malloc'd index, or NULL on failure.
+ */
+static void* buildTrackedKeyIndex(const Tracker* tracker, node* added, size_t addedCount,
+                                  const DataFileIndexFooter* footer, size_t* size) {
+    size_t count = tracker->count + addedCount;
+    const void** records = (const void**)malloc((count > 0 ? count : 1) * sizeof(void*));
+    if (!records) {
+        return NULL;
+    }
+    for (size_t slot = 0; slot < tracker->count; slot++) {
+        records[slot] = slotRecord(tracker, slot);
+    }
+    for (size_t i = 0; i < addedCount; i++, added = added->next) {
+        if (!added->data) {
+            free(records);
+            return NULL;
+        }
+        records[tracker->count + i] = added->data;
+    }
+    DataFileKey key = { footer->keyOffset, footer->keyLength };
+    void* index = buildDataFileKeyIndex(records, count, &key, size);
+    free(records);
+    return index;
+}
+
+/**
+ * @brief Extends the file's key index with records appended after the tracked slots.
+ * @param tracker The tracker.
+ * @param fd The descriptor of the data file.
+ * @param added The first appended node.
+ * @param addedCount The number of appended records.
+ * @param footer The footer of the file's current key index.
+ * @param size Receives the size of the index in bytes.
+ * @return The malloc'd index, or NULL if the old index cannot be read back or on failure.
+ */
+static void* appendTrackedKeyIndex(const Tracker* tracker, int fd, node* added, size_t addedCount,
+                                   const DataFileIndexFooter* footer, size_t* size) {
+    if (footer->entryCount != tracker->count || footer->indexSize > SIZE_MAX) {
+        return NULL;
+    }
+    size_t oldSize = (size_t)footer->indexSize;
+    uint64_t indexStart = (uint64_t)tracker->header.headerSize + tracker->header.metadataSize +
+                          (uint64_t)tracker->count * tracker->header.recordSize;
+    unsigned char* oldIndex = (unsigned char*)malloc(oldSize > 0 ? oldSize : 1);
+    const void** records = (const void**)malloc(addedCount * sizeof(void*));
+    void* index = NULL;
+    if (oldIndex && records && readAt(fd, indexStart, oldIndex, oldSize) == 0) {
+        size_t i = 0;
+        for (; i < addedCount && added->data; i++, added = added->next) {
+            records[i] = added->data;
+        }
+        index = (i == addedCount) ? appendDataFileKeyIndex(oldIndex, oldSize, records, addedCount, size) : NULL;
+    }
+    free(records);
+    free(oldIndex);
+    return index;
+}
+
+/**
+ * @brief Starts tracking a list that matches a data file slot by slot.
+ * @param dataList The list.
+ * @param path The path of the data file.
+ * @param header The header of the data file.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int trackDataFile(const list* dataList, const char* path, const DataFileHeader* header) {
+    untrackDataFile(dataList);
+    if (!dataList || !path || !header || header->version < 1 || (header->flags & dataFileCompressed) ||
+        dataList->size < 0 || (size_t)dataList->size != header->recordCount) {
+        return -1; // Legacy files have no header and compressed records cannot be rewritten in place
+    }
+
+    Tracker* tracker = (Tracker*)calloc(1, sizeof(Tracker));
+    if (!tracker) {
+        return -1;
+    }
+    tracker->dataList = dataList;
+    snprintf(tracker->path, sizeof(tracker->path), "%s", path);
+    tracker->header = *header;
+    tracker->count = header->recordCount;
+    tracker->dirty = (uint64_t*)calloc((tracker->count + 63) / 64 + 1, sizeof(uint64_t));
+    if (!tracker->dirty) {
+        free(tracker);
+        return -1;
+    }
+
+    // Loaded records lie side by side and need no per-record state
+    size_t recordSize = header->recordSize;
+    node* current = dataList->head;
+    size_t slot = 0;
+    for (; slot < tracker->count; slot++, current = current->next) {
+        if (!current->data) {
+            clearTracker(tracker);
+            free(tracker);
+            return -1;
+        }
+        if (slot == 0) {
+            tracker->base = (const unsigned char*)current->data;
+        } else if ((const unsigned char*)current->data != tracker->base + slot * recordSize) {
+            break;
+        }
+    }
+    tracker->contiguousCount = slot;
+
+    if (slot < tracker->count) {
+        tracker->slots = (const void**)malloc((tracker->count - slot) * sizeof(void*));
+        if (!tracker->slots) {
+            clearTracker(tracker);
+            free(tracker);
+            return -1;
+        }
+        for (; slot < tracker->count; slot++, current = current->next) {
+            if (!current->data) {
+                clearTracker(tracker);
+                free(tracker);
+                return -1;
+            }
+            tracker->slots[slot - tracker->contiguousCount] = current->data;
+        }
+    }
+
+    tracker->next = trackers;
+    trackers = tracker;
+    return 0;
+}
+
+/**
+ * @brief Marks a record as changed since the last save.
+ * @param record The changed record.
+ */
+void markRecordDirty(const void* record) {
+    if (!record) {
+        return;
+    }
+    for (Tracker* tracker = trackers; tracker != NULL; tracker = tracker->next) {
+        size_t slot = findSlot(tracker, record);
+        if (slot != deltaNoSlot) {
+            tracker->dirty[slot / 64] |= 1ull << (slot % 64);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Stops tracking a list.
+ * @param dataList The list.
+ */
+void untrackDataFile(const list* dataList) {
+    for (Tracker** link = &trackers; *link != NULL; link = &(*link)->next) {
+        if ((*link)->dataList == dataList) {
+            Tracker* tracker = *link;
+            *link = tracker->next;
+            clearTracker(tracker);
+            free(tracker);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Stops tracking all lists.
+ */
+void untrackAllDataFiles(void) {
+    while (trackers != NULL) {
+        untrackDataFile(trackers->dataList);
+    }
+}
+
+/**
+ * @brief Records the slots appended by a delta save and clears the dirty bits.
+ * @param tracker The tracker.
+ * @param added The first appended node.
+ * @param addedCount The number of appended records.
+ * @param header The header that was written.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int commitTracker(Tracker* tracker, node* added, size_t addedCount, const DataFileHeader* header) {
+    size_t count = tracker->count + addedCount;
+    if (addedCount > 0) {
+        const void** slots = (const void**)realloc(tracker->slots, (count - tracker->contiguousCount) * sizeof(void*));
+        uint64_t* dirty = (uint64_t*)realloc(tracker->dirty, ((count + 63) / 64 + 1) * sizeof(uint64_t));
+        if (slots) {
+            tracker->slots = slots;
+        }
+        if (dirty) {
+            tracker->dirty = dirty;
+        }
+        if (!slots || !dirty) {
+            return -1;
+        }
+        for (size_t slot = tracker->count; slot < count; slot++, added = added->next) {
+            tracker->slots[slot - tracker->contiguousCount] = added->data;
+        }
+        free(tracker->index);
+        tracker->index = NULL;
+    }
+    memset(tracker->dirty, 0, ((count + 63) / 64 + 1) * sizeof(uint64_t));
+    tracker->count = count;
+    tracker->header = *header;
+    return 0;
+}
+
+/**
+ * @brief Saves a tracked list by rewriting only its changed records.
+ * @param dataList The list.
+ * @param path The path of the data file.
+ * @return The number of records in the file, or -1 if a delta save is not possible or failed.
+ */
+int saveDataFileDelta(const list* dataList, const char* path) {
+    Tracker* tracker = findTracker(dataList);
+    if (!tracker || !path || strcmp(tracker->path, path) != 0 ||
+        dataList->size < 0 || (size_t)dataList->size < tracker->count) {
+        return -1;
+    }
+
+    // The list must still hold the file's records in slot order
+    node* current = dataList->head;
+    for (size_t slot = 0; slot < tracker->count; slot++, current = current->next) {
+        if (current->data != slotRecord(tracker, slot)) {
+            return -1; // Records were removed or reordered
+        }
+    }
+    node* added = current;
+    size_t addedCount = (size_t)dataList->size - tracker->count;
+
+    int fd = openSlotFile(path);
+    if (fd < 0) {
+        return -1;
+    }
+
+    // Only patch the file this list was loaded from or last saved to
+    DataFileHeader onDisk;
+    if (readAt(fd, 0, &onDisk, sizeof(onDisk)) != 0 || memcmp(&onDisk, &tracker->header, sizeof(onDisk)) != 0) {
+        closeSlotFile(fd, false);
+        return -1;
+    }
+
+    size_t recordSize = tracker->header.recordSize;
+    unsigned char* newBytes = (unsigned char*)malloc(deltaRunRecords * recordSize);
+    unsigned char* oldBytes = (unsigned char*)malloc(deltaRunRecords * recordSize);
+    uint64_t recordStart = (uint64_t)tracker->header.headerSize + tracker->header.metadataSize;
+    uint64_t payloadSize = (uint64_t)tracker->header.metadataSize + (uint64_t)tracker->count * recordSize;
+    uint32_t checksum = tracker->header.checksum;
+    bool ok = newBytes && oldBytes;
+
+    // Appended records are merged into the key index of an indexed file; a changed key rebuilds it.
+    // That happens before anything is written, so a declined save leaves the file untouched
+    DataFileIndexFooter footer;
+    void* index = NULL;
+    size_t indexSize = 0;
+    if (ok && (tracker->header.flags & dataFileIndexed)) {
+        ok = readKeyFooter(fd, &tracker->header, &footer) == 0;
+        bool keysKept = ok && keepsIndexedKeys(tracker, fd, &footer, oldBytes);
+        if (keysKept && addedCount > 0) {
+            index = appendTrackedKeyIndex(tracker, fd, added, addedCount, &footer, &indexSize);
+        }
+        if (ok && !index && (addedCount > 0 || !keysKept)) {
+            index = buildTrackedKeyIndex(tracker, added, addedCount, &footer, &indexSize); // Keys changed
+            ok = index != NULL;
+        }
+    }
+    if (!ok) {
+        free(newBytes);
+        free(oldBytes);
+        closeSlotFile(fd, false);
+        return -1;
+    }
+
+    // Rewrite runs of adjacent dirty slots, patching the checksum from the old bytes
+    for (size_t slot = nextDirtySlot(tracker, 0); ok && slot < tracker->count;) {
+        size_t run = 0;
+        while (run < deltaRunRecords && slot + run < tracker->count && isSlotDirty(tracker, slot + run)) {
+            memcpy(newBytes + run * recordSize, slotRecord(tracker, slot + run), recordSize);
+            run++;
+        }
+        uint64_t offset = (uint64_t)slot * recordSize;
+        uint64_t bytesAfter = payloadSize - tracker->header.metadataSize - offset - run * recordSize;
+        ok = readAt(fd, recordStart + offset, oldBytes, run * recordSize) == 0;
+        if (ok) {
+            checksum = crc32cReplace(checksum, oldBytes, newBytes, run * recordSize, bytesAfter);
+            ok = writeAt(fd, recordStart + offset, newBytes, run * recordSize) == 0;
+        }
+        slot = nextDirtySlot(tracker, slot + run);
+    }
+
+    // Append the records added since the last save
+    current = added;
+    for (size_t done = 0; ok && done < addedCount;) {
+        size_t run = 0;
+        for (; run < deltaRunRecords && done + run < addedCount; run++, current = current->next) {
+            if (!current->data) {
+                ok = false;
+                break;
+            }
+            memcpy(newBytes + run * recordSize, current->data, recordSize);
+        }
+        if (ok) {
+            uint64_t offset = recordStart + (uint64_t)(tracker->count + done) * recordSize;
+            checksum = crc32c(checksum, newBytes, run * recordSize);
+            ok = writeAt(fd, offset, newBytes, run * recordSize) == 0;
+        }
+        done += run;
+    }
+    free(newBytes);
+    free(oldBytes);
+
+    // Appended records overwrite the start of the old index, and the new one is never shorter
+    if (ok && index) {
+        ok = writeAt(fd, recordStart + (uint64_t)(tracker->count + addedCount) * recordSize, index, indexSize) == 0;
+    }
+    free(index);
+
+    // The header goes last, so an interrupted save fails validation on load
+    DataFileHeader written = tracker->header;
+    written.recordCount = (uint32_t)(tracker->count + addedCount);
+    written.checksum = checksum;
+#ifdef _WIN32
+    ok = ok && _commit(fd) == 0;
+#else
+    ok = ok && fsync(fd) == 0;
+#endif
+    ok = ok && writeAt(fd, 0, &written, sizeof(written)) == 0;
+    if (closeSlotFile(fd, ok) != 0 || !ok) {
+        return -1;
+    }
+
+    if (commitTracker(tracker, added, addedCount, &written) != 0) {
+        untrackDataFile(dataList);
+    }
+    return (int)written.recordCount;
+}
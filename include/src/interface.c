@@ -736,8 +736,8 @@ void updateEmployeeMenuStates(Menu* menu) {
             menu->options[i].isDisabled = !(hasActiveList && hasEmployees);
         }
         // Payroll reports might have special requirements
-        else if (menu->options[i].key == '8') {
-            // Payroll report needs active list with employees
+        else if (menu->options[i].key == '8' || menu->options[i].key == 'K' || menu->options[i].key == 'E') {
+            // Payroll report, top earners and export need active list with employees
             menu->options[i].isDisabled = !hasEmployees;
         }
     }
@@ -770,8 +770,8 @@ void updateStudentMenuStates(Menu* menu) {
         if (menu->options[i].key == '8') {
             menu->options[i].isDisabled = !hasMultipleStudents;
         }
-        // Table view needs at least 1 student
-        if (menu->options[i].key == 'T') {
+        // Table view, top students and export need at least 1 student
+        if (menu->options[i].key == 'T' || menu->options[i].key == 'K' || menu->options[i].key == 'E') {
             menu->options[i].isDisabled = !hasStudents;
         }
     }
@@ -785,7 +785,7 @@ void checkMenuStates(Menu* menu) {
     if (!menu) return;
     
     // Check if this is a main menu (usually has fewer options and different structure)
-    if (menu->optionCount <= 6) {
+    if (menu->optionCount <= 7) {
         // Main menu options are usually always available
         for (int i = 0; i < menu->optionCount; i++) {
             menu->options[i].isDisabled = false;
@@ -1068,17 +1068,16 @@ void displayStudentTable(const list* studentList, PaginationState* pagination) {
     
     // Count actual items on current page first
     int actualItemsOnPage = 0;
-    if (studentList->size > 0 && studentList->head) {
-        node* current = studentList->head;
-        int index = 0;
+    node* pageStart = getNode(studentList, pagination->startIndex);
+    if (pageStart) {
+        node* current = pageStart;
+        int index = pagination->startIndex;
         
         // Count items in current page range
         do {
-            if (index >= pagination->startIndex && index <= pagination->endIndex) {
-                Student* student = (Student*)current->data;
-                if (student) {
-                    actualItemsOnPage++;
-                }
+            Student* student = (Student*)current->data;
+            if (student) {
+                actualItemsOnPage++;
             }
             current = current->next;
             index++;
@@ -1090,22 +1089,22 @@ void displayStudentTable(const list* studentList, PaginationState* pagination) {
     
     // Display student rows
     if (studentList->size > 0 && studentList->head) {
-        node* current = studentList->head;
-        int index = 0;
+        // Jump straight to the first row of the page (O(1) for DYNAMIC_ARRAY lists)
+        node* current = pageStart;
+        int index = pagination->startIndex;
         int displayedRows = 0;
         
-        // Navigate to start position
-        do {
-            if (index >= pagination->startIndex && index <= pagination->endIndex) {
+        if (current) {
+            do {
                 Student* student = (Student*)current->data;
                 if (student) {
                     displayStudentTableRow(student, index + 1, consoleWidth, tableWidth, tblMargin);
                     displayedRows++;
                 }
-            }
-            current = current->next;
-            index++;
-        } while (current != studentList->head && current != NULL && index <= pagination->endIndex);
+                current = current->next;
+                index++;
+            } while (current != studentList->head && current != NULL && index <= pagination->endIndex);
+        }
         
         // Fill remaining rows with empty space if needed
         for (int i = displayedRows; i < pagination->itemsPerPage; i++) {
@@ -1466,17 +1465,16 @@ void displayEmployeeTable(const list* employeeList, PaginationState* pagination)
     
     // Count actual items on current page first
     int actualItemsOnPage = 0;
-    if (employeeList->size > 0 && employeeList->head) {
-        node* current = employeeList->head;
-        int index = 0;
+    node* pageStart = getNode(employeeList, pagination->startIndex);
+    if (pageStart) {
+        node* current = pageStart;
+        int index = pagination->startIndex;
         
         // Count items in current page range
         do {
-            if (index >= pagination->startIndex && index <= pagination->endIndex) {
-                Employee* employee = (Employee*)current->data;
-                if (employee) {
-                    actualItemsOnPage++;
-                }
+            Employee* employee = (Employee*)current->data;
+            if (employee) {
+                actualItemsOnPage++;
             }
             current = current->next;
             index++;
@@ -1488,22 +1486,22 @@ void displayEmployeeTable(const list* employeeList, PaginationState* pagination)
     
     // Display employee rows
     if (employeeList->size > 0 && employeeList->head) {
-        node* current = employeeList->head;
-        int index = 0;
+        // Jump straight to the first row of the page (O(1) for DYNAMIC_ARRAY lists)
+        node* current = pageStart;
+        int index = pagination->startIndex;
         int displayedRows = 0;
         
-        // Navigate to start position
-        do {
-            if (index >= pagination->startIndex && index <= pagination->endIndex) {
+        if (current) {
+            do {
                 Employee* employee = (Employee*)current->data;
                 if (employee) {
                     displayEmployeeTableRow(employee, index + 1, consoleWidth, tableWidth, tblMargin);
                     displayedRows++;
                 }
-            }
-            current = current->next;
-            index++;
-        } while (current != employeeList->head && current != NULL && index <= pagination->endIndex);
+                current = current->next;
+                index++;
+            } while (current != employeeList->head && current != NULL && index <= pagination->endIndex);
+        }
         
         // Fill remaining rows with empty space if needed
         for (int i = displayedRows; i < pagination->itemsPerPage; i++) {
@@ -0,0 +1,940 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "../headers/journal.h"
+
+#define journalNoPosition SIZE_MAX    // End of an index chain
+#define journalMinBuckets 1024        // Smallest replay index
+
+/**
+ * @brief Journal state of one list.
+ */
+typedef struct Journal {
+    const list* dataList;       // Journaled list
+    char basePath[256];         // Path of the base file
+    RecordFormat format;        // Record format of the base file
+    uint32_t baseChecksum;      // Checksum of the current base file
+    uint32_t baseCount;         // Record count of the current base file
+    size_t baseSize;            // Size of the current base file in bytes
+    bool logExists;             // The log file exists and belongs to the base
+    long logEnd;                // Offset past the last committed entry
+    uint32_t nextSequence;      // Sequence number of the next committed entry
+    uint32_t pendingSequence;   // Sequence number of the next buffered entry
+    unsigned char* pending;     // Entries buffered until the next save
+    size_t pendingSize;         // Bytes buffered
+    size_t pendingCapacity;     // Bytes the buffer can hold
+    bool compactOnSave;         // The next save writes a new base
+    struct Journal* next;       // Next journal in the registry
+} Journal;
+
+static Journal* journals = NULL;
+
+/**
+ * @brief Chained hash index from record keys to positions in the replay array.
+ */
+typedef struct {
+    void** items;               // Records being replayed
+    const RecordFormat* format; // Record format
+    size_t* heads;              // First position of every bucket
+    size_t* links;              // Next position in the chain of every position
+    size_t bucketCount;         // Number of buckets (a power of two)
+    size_t linkCapacity;        // Positions the link array can hold
+    size_t size;                // Positions in the index
+} KeyIndex;
+
+/**
+ * @brief Returns the journal of a list.
+ * @param dataList The list.
+ * @return The journal, or NULL if the list is not journaled.
+ */
+static Journal* findJournal(const list* dataList) {
+    for (Journal* journal = journals; journal != NULL; journal = journal->next) {
+        if (journal->dataList == dataList) {
+            return journal;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns the used length of a key field.
+ * @param record The record.
+ * @param format The record format.
+ * @return The key length in bytes, without the terminator.
+ */
+static size_t recordKeyLength(const void* record, const RecordFormat* format) {
+    const char* key = (const char*)record + format->keyOffset;
+    size_t length = 0;
+    while (length < format->keyLength && key[length] != '\0') {
+        length++;
+    }
+    return length;
+}
+
+/**
+ * @brief Hashes a key with FNV-1a.
+ * @param key The key bytes.
+ * @param length The number of bytes.
+ * @return The hash.
+ */
+static size_t hashKey(const unsigned char* key, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ key[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Adds the record at a position to the index.
+ * @param index The index.
+ * @param position The position in the replay array.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int indexInsert(KeyIndex* index, size_t position) {
+    if (position >= index->linkCapacity) {
+        size_t capacity = index->linkCapacity * 2;
+        while (capacity <= position) {
+            capacity *= 2;
+        }
+        size_t* links = (size_t*)realloc(index->links, capacity * sizeof(size_t));
+        if (!links) {
+            return -1;
+        }
+        index->links = links;
+        index->linkCapacity = capacity;
+    }
+
+    const void* record = index->items[position];
+    const unsigned char* key = (const unsigned char*)record + index->format->keyOffset;
+    size_t bucket = hashKey(key, recordKeyLength(record, index->format)) & (index->bucketCount - 1);
+    index->links[position] = index->heads[bucket];
+    index->heads[bucket] = position;
+    index->size++;
+    return 0;
+}
+
+/**
+ * @brief Removes the record at a position from the index.
+ * @param index The index.
+ * @param position The position in the replay array.
+ */
+static void indexRemove(KeyIndex* index, size_t position) {
+    const void* record = index->items[position];
+    const unsigned char* key = (const unsigned char*)record + index->format->keyOffset;
+    size_t* link = &index->heads[hashKey(key, recordKeyLength(record, index->format)) & (index->bucketCount - 1)];
+    while (*link != journalNoPosition) {
+        if (*link == position) {
+            *link = index->links[position];
+            index->size--;
+            return;
+        }
+        link = &index->links[*link];
+    }
+}
+
+/**
+ * @brief Finds the first record in list order with a key.
+ * @param index The index.
+ * @param key The key bytes.
+ * @param length The number of key bytes.
+ * @return The position of the record, or journalNoPosition if there is none.
+ */
+static size_t indexFind(const KeyIndex* index, const unsigned char* key, size_t length) {
+    size_t found = journalNoPosition;
+    size_t position = index->heads[hashKey(key, length) & (index->bucketCount - 1)];
+    while (position != journalNoPosition) {
+        const void* record = index->items[position];
+        if (position < found && recordKeyLength(record, index->format) == length &&
+            memcmp((const unsigned char*)record + index->format->keyOffset, key, length) == 0) {
+            found = position; // Duplicate keys resolve to the earliest record, like a list search
+        }
+        position = index->links[position];
+    }
+    return found;
+}
+
+/**
+ * @brief Builds the index over the base records.
+ * @param index The index to initialize.
+ * @param items The records.
+ * @param count The number of records.
+ * @param format The record format.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int initKeyIndex(KeyIndex* index, void** items, size_t count, const RecordFormat* format) {
+    memset(index, 0, sizeof(*index));
+    index->items = items;
+    index->format = format;
+    index->bucketCount = journalMinBuckets;
+    while (index->bucketCount < count) {
+        index->bucketCount *= 2;
+    }
+    index->linkCapacity = (count > 0) ? count : 1;
+    index->heads = (size_t*)malloc(index->bucketCount * sizeof(size_t));
+    index->links = (size_t*)malloc(index->linkCapacity * sizeof(size_t));
+    if (!index->heads || !index->links) {
+        free(index->heads);
+        free(index->links);
+        return -1;
+    }
+    for (size_t b = 0; b < index->bucketCount; b++) {
+        index->heads[b] = journalNoPosition;
+    }
+    for (size_t i = 0; i < count; i++) {
+        indexInsert(index, i);
+    }
+    return 0;
+}
+
+/**
+ * @brief Checks whether a log header belongs to a base file.
+ * @param header The log header.
+ * @param base The header of the base file.
+ * @param format The record format.
+ * @return true if the log applies to the base, false otherwise.
+ */
+static bool journalMatchesBase(const JournalHeader* header, const DataFileHeader* base, const RecordFormat* format) {
+    return header->magic == journalMagic && header->version == journalVersion &&
+           header->headerSize == sizeof(JournalHeader) && header->recordType == format->recordType &&
+           header->recordSize == format->recordSize && base->version != 0 &&
+           header->baseChecksum == base->checksum && header->baseCount == base->recordCount;
+}
+
+/**
+ * @brief Reads and checks the next log entry.
+ * @param file The log file.
+ * @param expectedSequence The sequence number the entry must have.
+ * @param format The record format.
+ * @param entry Receives the entry header.
+ * @param payload Receives the key followed by the data (keyLength + recordSize bytes).
+ * @return true if a complete, intact entry was read, false at the end of the valid log.
+ */
+static bool readJournalEntry(FILE* file, uint32_t expectedSequence, const RecordFormat* format,
+                             JournalEntry* entry, unsigned char* payload) {
+    if (fread(entry, sizeof(*entry), 1, file) != 1 || entry->sequence != expectedSequence ||
+        entry->keyLength > format->keyLength || entry->length > format->recordSize) {
+        return false;
+    }
+    switch (entry->op) {
+        case JOURNAL_ADD:
+            if (entry->offset != 0 || entry->length != format->recordSize) return false;
+            break;
+        case JOURNAL_UPDATE:
+            if (entry->length == 0 || (size_t)entry->offset + entry->length > format->recordSize) return false;
+            break;
+        case JOURNAL_REMOVE:
+            if (entry->length != 0) return false;
+            break;
+        default:
+            return false;
+    }
+
+    size_t payloadSize = (size_t)entry->keyLength + entry->length;
+    if (payloadSize > 0 && fread(payload, payloadSize, 1, file) != 1) {
+        return false; // Torn write at the end of the log
+    }
+    uint32_t checksum = crc32c(0, (const unsigned char*)entry + sizeof(entry->checksum),
+                               sizeof(*entry) - sizeof(entry->checksum));
+    return crc32c(checksum, payload, payloadSize) == entry->checksum;
+}
+
+/**
+ * @brief Applies the log of a base file to its loaded records.
+ * @param basePath The path of the base data file.
+ * @param base The header of the base file.
+ * @param format The record format.
+ * @param items The base records, replaced by the replayed records.
+ * @param count The number of base records, replaced by the number of replayed records.
+ * @param replay Receives where the log ended.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int replayJournal(const char* basePath, const DataFileHeader* base, const RecordFormat* format,
+                  void*** items, size_t* count, JournalReplay* replay) {
+    if (!basePath || !base || !format || !items || !count || !replay) {
+        return -1;
+    }
+    replay->found = false;
+    replay->validEnd = 0;
+    replay->nextSequence = 1;
+    replay->applied = 0;
+
+    char logPath[300];
+    getJournalPath(basePath, logPath, sizeof(logPath));
+    FILE* file = fopen(logPath, "rb");
+    if (!file) {
+        return 0; // No log: the base is current
+    }
+
+    JournalHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || !journalMatchesBase(&header, base, format)) {
+        fclose(file); // A log of an older base, left behind by an interrupted compaction
+        return 0;
+    }
+    replay->found = true;
+    replay->validEnd = (long)sizeof(header);
+
+    size_t baseCount = *count;
+    size_t used = *count;
+    size_t capacity = *count;
+    void** records = *items;
+    unsigned char* payload = (unsigned char*)malloc(format->keyLength + format->recordSize);
+    KeyIndex index;
+    if (!payload || initKeyIndex(&index, records, used, format) != 0) {
+        free(payload);
+        fclose(file);
+        return -1;
+    }
+
+    int result = 0;
+    JournalEntry entry;
+    while (readJournalEntry(file, replay->nextSequence, format, &entry, payload)) {
+        const unsigned char* key = payload;
+        const unsigned char* data = payload + entry.keyLength;
+
+        if (entry.op == JOURNAL_ADD) {
+            if (used == capacity) {
+                capacity = (capacity < 16) ? 16 : capacity * 2;
+                void** grown = (void**)realloc(records, capacity * sizeof(void*));
+                if (!grown) {
+                    result = -1;
+                    break;
+                }
+                records = grown;
+                index.items = records;
+            }
+            void* record = malloc(format->recordSize);
+            if (!record) {
+                result = -1;
+                break;
+            }
+            memcpy(record, data, format->recordSize);
+            records[used] = record;
+            if (indexInsert(&index, used) != 0) {
+                free(record);
+                result = -1;
+                break;
+            }
+            used++;
+        } else {
+            size_t position = indexFind(&index, key, entry.keyLength);
+            if (position != journalNoPosition) {
+                indexRemove(&index, position);
+                if (entry.op == JOURNAL_UPDATE) {
+                    memcpy((unsigned char*)records[position] + entry.offset, data, entry.length);
+                    indexInsert(&index, position); // The key may have changed
+                } else {
+                    if (position >= baseCount) {
+                        free(records[position]); // Added by the log, so it was malloc'd here
+                    }
+                    records[position] = NULL;
+                }
+            }
+        }
+
+        replay->validEnd = ftell(file);
+        replay->nextSequence++;
+        replay->applied++;
+    }
+    fclose(file);
+    free(payload);
+    free(index.heads);
+    free(index.links);
+
+    *items = records;
+    if (result != 0) {
+        for (size_t i = baseCount; i < used; i++) {
+            free(records[i]); // The caller only knows about the base records
+        }
+        *count = 0;
+        return -1;
+    }
+
+    // Close the gaps left by removed records, keeping list order
+    size_t kept = 0;
+    for (size_t i = 0; i < used; i++) {
+        if (records[i] != NULL) {
+            records[kept++] = records[i];
+        }
+    }
+    *count = kept;
+    return 0;
+}
+
+/**
+ * @brief Checks whether an update may turn a record's key into a given key.
+ * @param entry The update entry.
+ * @param data The updated bytes.
+ * @param format The record format.
+ * @param key The key.
+ * @param length The length of the key.
+ * @return false if the updated bytes rule the key out, true otherwise.
+ */
+static bool mayUpdateToKey(const JournalEntry* entry, const unsigned char* data, const RecordFormat* format,
+                           const char* key, size_t length) {
+    size_t start = (entry->offset > format->keyOffset) ? entry->offset : format->keyOffset;
+    size_t end = (size_t)entry->offset + entry->length;
+    if (end > format->keyOffset + format->keyLength) {
+        end = format->keyOffset + format->keyLength;
+    }
+    for (size_t position = start; position < end; position++) {
+        size_t i = position - format->keyOffset;
+        char c = (char)data[position - entry->offset];
+        if ((i < length && c != key[i]) || (i == length && c != '\0')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Applies the log of a base file to the records with one key.
+ * @param basePath The path of the base data file.
+ * @param base The header of the base file.
+ * @param format The record format.
+ * @param key The key of the records.
+ * @param record The first record with the key, updated by the log.
+ * @param matches The number of records with the key, updated by the log.
+ * @return Returns 0 on success, -1 if the log cannot be replayed for one key or on failure.
+ */
+int replayJournalRecord(const char* basePath, const DataFileHeader* base, const RecordFormat* format,
+                        const char* key, void* record, size_t* matches) {
+    if (!basePath || !base || !format || !key || !record || !matches) {
+        return -1;
+    }
+    char logPath[300];
+    getJournalPath(basePath, logPath, sizeof(logPath));
+    FILE* file = fopen(logPath, "rb");
+    if (!file) {
+        return 0; // No log: the base is current
+    }
+    JournalHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || !journalMatchesBase(&header, base, format)) {
+        fclose(file);
+        return 0;
+    }
+
+    size_t length = strlen(key);
+    unsigned char* payload = (unsigned char*)malloc(format->keyLength + format->recordSize);
+    int result = payload ? 0 : -1;
+    JournalEntry entry;
+    for (uint32_t sequence = 1; result == 0 && readJournalEntry(file, sequence, format, &entry, payload); sequence++) {
+        const unsigned char* data = payload + entry.keyLength;
+        bool sameKey = entry.keyLength == length && memcmp(payload, key, length) == 0;
+        bool touchesKey = entry.op == JOURNAL_UPDATE && entry.offset < format->keyOffset + format->keyLength &&
+                          entry.offset + entry.length > format->keyOffset;
+
+        if (entry.op == JOURNAL_ADD) {
+            if (recordKeyLength(data, format) == length &&
+                memcmp(data + format->keyOffset, key, length) == 0 && (*matches)++ == 0) {
+                memcpy(record, data, format->recordSize); // Later duplicates stay behind the first
+            }
+        } else if (entry.op == JOURNAL_REMOVE) {
+            if (sameKey && *matches > 1) {
+                result = -1; // The next record with the key was never read
+            } else if (sameKey) {
+                *matches = 0;
+            }
+        } else if (sameKey) {
+            if (*matches > 0) {
+                memcpy((unsigned char*)record + entry.offset, data, entry.length);
+                if (recordKeyLength(record, format) != length ||
+                    memcmp((const unsigned char*)record + format->keyOffset, key, length) != 0) {
+                    result = (*matches > 1) ? -1 : 0; // The record left the key
+                    *matches = 0;
+                }
+            }
+        } else if (touchesKey && mayUpdateToKey(&entry, data, format, key, length)) {
+            result = -1; // Another record may have taken the key
+        }
+    }
+    fclose(file);
+    free(payload);
+    return result;
+}
+
+/**
+ * @brief Sorts zero-padded keys and drops repeated ones.
+ * @param keys The keys, replaced by the sorted distinct keys.
+ * @param count The number of keys, replaced by the number of distinct keys.
+ * @param keyLength The size of one key in bytes.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int sortDistinctKeys(unsigned char** keys, size_t* count, size_t keyLength) {
+    if (*count < 2) {
+        return 0;
+    }
+    SortItem* items = (SortItem*)malloc(*count * sizeof(SortItem));
+    unsigned char* sorted = (unsigned char*)malloc(*count * keyLength);
+    SortKey sortKey = { SORT_KEY_STRING, 0, (int)keyLength, false };
+    for (size_t i = 0; items && i < *count; i++) {
+        items[i].data = *keys + i * keyLength;
+        items[i].owner = NULL;
+    }
+
+    // Zero padding makes the radix order of the keys their memcmp() order
+    if (!items || !sorted || sortItemsByKeys(items, (int)*count, &sortKey, 1) != 0) {
+        free(items);
+        free(sorted);
+        return -1;
+    }
+    size_t distinct = 0;
+    for (size_t i = 0; i < *count; i++) {
+        if (distinct == 0 || memcmp(sorted + (distinct - 1) * keyLength, items[i].data, keyLength) != 0) {
+            memcpy(sorted + distinct++ * keyLength, items[i].data, keyLength);
+        }
+    }
+    free(items);
+    free(*keys);
+    *keys = sorted;
+    *count = distinct;
+    return 0;
+}
+
+/**
+ * @brief Collects the keys of the records a base file's log updates or removes.
+ * @param basePath The path of the base data file.
+ * @param base The header of the base file.
+ * @param format The record format.
+ * @param keys Receives the sorted, distinct keys, each zero-padded to the key field size.
+ * @param count Receives the number of keys.
+ * @return Returns 1 if the base has a log, 0 if it has none, -1 on failure.
+ */
+int readJournalKeys(const char* basePath, const DataFileHeader* base, const RecordFormat* format,
+                    unsigned char** keys, size_t* count) {
+    if (!basePath || !base || !format || !keys || !count) {
+        return -1;
+    }
+    *keys = NULL;
+    *count = 0;
+    char logPath[300];
+    getJournalPath(basePath, logPath, sizeof(logPath));
+    FILE* file = fopen(logPath, "rb");
+    if (!file) {
+        return 0;
+    }
+    JournalHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || !journalMatchesBase(&header, base, format)) {
+        fclose(file);
+        return 0;
+    }
+
+    size_t keyLength = format->keyLength;
+    size_t capacity = 0;
+    unsigned char* found = NULL;
+    unsigned char* payload = (unsigned char*)malloc(format->keyLength + format->recordSize);
+    int result = payload ? 1 : -1;
+    JournalEntry entry;
+    for (uint32_t sequence = 1; result == 1 && readJournalEntry(file, sequence, format, &entry, payload); sequence++) {
+        if (entry.op == JOURNAL_ADD) {
+            continue; // Added records are not in the base
+        }
+        if (*count == capacity) {
+            capacity = (capacity > 0) ? capacity * 2 : 64;
+            unsigned char* grown = (unsigned char*)realloc(found, capacity * keyLength);
+            if (!grown) {
+                result = -1;
+                break;
+            }
+            found = grown;
+        }
+        unsigned char* key = found + (*count)++ * keyLength;
+        memcpy(key, payload, entry.keyLength);
+        memset(key + entry.keyLength, 0, keyLength - entry.keyLength);
+    }
+    fclose(file);
+    free(payload);
+
+    if (result == 1 && sortDistinctKeys(&found, count, keyLength) != 0) {
+        result = -1;
+    }
+    if (result != 1) {
+        free(found);
+        *count = 0;
+        return -1;
+    }
+    *keys = found;
+    return 1;
+}
+
+/**
+ * @brief Makes the lists journaled to a base file write a new base on their next save.
+ * @param basePath The path of the base data file.
+ */
+void journalBaseReplaced(const char* basePath) {
+    if (!basePath) {
+        return;
+    }
+    for (Journal* journal = journals; journal != NULL; journal = journal->next) {
+        if (strcmp(journal->basePath, basePath) == 0) {
+            journal->logExists = false;
+            journal->compactOnSave = true;
+        }
+    }
+}
+
+/**
+ * @brief Returns the path of the log that belongs to a base file.
+ * @param basePath The path of the base data file.
+ * @param logPath The buffer for the log path.
+ * @param size The size of the buffer.
+ */
+void getJournalPath(const char* basePath, char* logPath, size_t size) {
+    snprintf(logPath, size, "%s.jnl", basePath);
+}
+
+/**
+ * @brief Makes a journal refer to a newly written base file with an empty log.
+ * @param journal The journal.
+ * @param base The header of the base file.
+ */
+static void resetJournal(Journal* journal, const DataFileHeader* base) {
+    journal->baseChecksum = base->checksum;
+    journal->baseCount = base->recordCount;
+    journal->baseSize = (size_t)base->headerSize + base->metadataSize + (size_t)base->recordCount * base->recordSize;
+    journal->logExists = false;
+    journal->logEnd = 0;
+    journal->nextSequence = 1;
+    journal->pendingSequence = 1;
+    journal->pendingSize = 0;
+
+    // A legacy base has no checksum to tie a log to, so it is rewritten first
+    journal->compactOnSave = (base->version == 0);
+}
+
+/**
+ * @brief Starts journaling a list that was loaded from or saved to a base file.
+ * @param dataList The list.
+ * @param basePath The path of the base data file.
+ * @param format The record format.
+ * @param base The header of the base file.
+ * @param replay The result of replayJournal(), or NULL if the base has no log.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int attachJournal(list* dataList, const char* basePath, const RecordFormat* format,
+                  const DataFileHeader* base, const JournalReplay* replay) {
+    if (!dataList || !basePath || !format || !base || strlen(basePath) >= sizeof(((Journal*)0)->basePath)) {
+        return -1;
+    }
+    detachJournal(dataList);
+
+    Journal* journal = (Journal*)calloc(1, sizeof(Journal));
+    if (!journal) {
+        return -1;
+    }
+    journal->dataList = dataList;
+    strcpy(journal->basePath, basePath);
+    journal->format = *format;
+    resetJournal(journal, base);
+    if (replay && replay->found) {
+        journal->logExists = true;
+        journal->logEnd = replay->validEnd;
+        journal->nextSequence = replay->nextSequence;
+        journal->pendingSequence = replay->nextSequence;
+    }
+
+    journal->next = journals;
+    journals = journal;
+    return 0;
+}
+
+/**
+ * @brief Stops journaling a list and discards its uncommitted changes.
+ * @param dataList The list.
+ */
+void detachJournal(const list* dataList) {
+    for (Journal** link = &journals; *link != NULL; link = &(*link)->next) {
+        if ((*link)->dataList == dataList) {
+            Journal* journal = *link;
+            *link = journal->next;
+            free(journal->pending);
+            free(journal);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Stops journaling all lists.
+ */
+void detachAllJournals(void) {
+    while (journals != NULL) {
+        detachJournal(journals->dataList);
+    }
+}
+
+/**
+ * @brief Writes a list as a base file in the format's options.
+ * @param dataList The list.
+ * @param basePath The path of the base data file.
+ * @param format The record format.
+ * @param header Receives the header that was written.
+ * @return The number of records written, or -1 on failure.
+ */
+static int writeBaseFile(const list* dataList, const char* basePath, const RecordFormat* format,
+                         DataFileHeader* header) {
+    DataFileKey key = { format->keyOffset, format->keyLength };
+    return writeDataFile(dataList, basePath, format->recordType | format->fileOptions, format->recordSize,
+                         (format->fileOptions & dataFileIndexed) ? &key : NULL, header);
+}
+
+/**
+ * @brief Writes a journal's base file from scratch and removes its log.
+ * @param journal The journal.
+ * @return The number of records written, or -1 on failure.
+ */
+static int compactLog(Journal* journal) {
+    DataFileHeader header;
+    int written = writeBaseFile(journal->dataList, journal->basePath, &journal->format, &header);
+    if (written < 0) {
+        return -1;
+    }
+
+    // The new base no longer matches the old log, so it would be ignored anyway
+    char logPath[300];
+    getJournalPath(journal->basePath, logPath, sizeof(logPath));
+    remove(logPath);
+    resetJournal(journal, &header);
+    return written;
+}
+
+/**
+ * @brief Writes a list's base file from scratch and empties its log.
+ * @param dataList A journaled list.
+ * @return The number of records written, or -1 on failure.
+ */
+int compactJournal(list* dataList) {
+    Journal* journal = findJournal(dataList);
+    return journal ? compactLog(journal) : -1;
+}
+
+/**
+ * @brief Appends the buffered entries of a journal to its log with one write and one sync.
+ * @param journal The journal.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int commitLog(Journal* journal) {
+    size_t logSize = (size_t)journal->logEnd + journal->pendingSize;
+    bool tooLarge = logSize > journalCompactMinBytes && logSize * journalCompactRatio > journal->baseSize;
+    if (journal->compactOnSave || tooLarge) {
+        return (compactLog(journal) >= 0) ? 0 : -1;
+    }
+    if (journal->pendingSize == 0) {
+        return 0;
+    }
+
+    char logPath[300];
+    getJournalPath(journal->basePath, logPath, sizeof(logPath));
+    FILE* file = NULL;
+    if (journal->logExists) {
+        file = fopen(logPath, "r+b");
+        if (!file) {
+            // The log disappeared, so its committed entries cannot be trusted to follow
+            return (compactLog(journal) >= 0) ? 0 : -1;
+        }
+        if (fseek(file, journal->logEnd, SEEK_SET) != 0) {
+            fclose(file);
+            return -1;
+        }
+    } else {
+        file = fopen(logPath, "wb");
+        if (!file) {
+            return -1;
+        }
+        JournalHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = journalMagic;
+        header.version = journalVersion;
+        header.headerSize = (uint16_t)sizeof(header);
+        header.recordType = journal->format.recordType;
+        header.recordSize = (uint32_t)journal->format.recordSize;
+        header.baseChecksum = journal->baseChecksum;
+        header.baseCount = journal->baseCount;
+        if (fwrite(&header, sizeof(header), 1, file) != 1) {
+            fclose(file);
+            return -1;
+        }
+        journal->logEnd = (long)sizeof(header);
+    }
+
+    // A torn write leaves entries that fail their checksum; replay stops before them
+    bool ok = fwrite(journal->pending, journal->pendingSize, 1, file) == 1 && syncDataFile(file) == 0;
+    if (fclose(file) != 0 || !ok) {
+        return -1;
+    }
+    journal->logExists = true;
+    journal->logEnd += (long)journal->pendingSize;
+    journal->nextSequence = journal->pendingSequence;
+    journal->pendingSize = 0;
+    return 0;
+}
+
+/**
+ * @brief Saves a list as a journaled file.
+ * @param dataList The list.
+ * @param basePath The path of the base data file.
+ * @param format The record format.
+ * @return The number of records in the saved list, or -1 on failure.
+ */
+int saveJournaledList(list* dataList, const char* basePath, const RecordFormat* format) {
+    if (!dataList || !basePath || !format) {
+        return -1;
+    }
+
+    Journal* journal = findJournal(dataList);
+    if (journal && strcmp(journal->basePath, basePath) == 0 &&
+        journal->format.recordType == format->recordType) {
+        if (journal->format.fileOptions != format->fileOptions) {
+            // The base is rewritten in the newly configured format
+            journal->format.fileOptions = format->fileOptions;
+            journal->compactOnSave = true;
+        }
+        return (commitLog(journal) == 0) ? dataList->size : -1;
+    }
+
+    // A new file: write the whole list as its base and journal it from now on
+    DataFileHeader header;
+    int written = writeBaseFile(dataList, basePath, format, &header);
+    if (written < 0) {
+        return -1;
+    }
+    char logPath[300];
+    getJournalPath(basePath, logPath, sizeof(logPath));
+    remove(logPath);
+
+    // Other lists journaled to this file must not append to a log of the replaced base
+    journalBaseReplaced(basePath);
+    attachJournal(dataList, basePath, format, &header, NULL);
+    return written;
+}
+
+/**
+ * @brief Buffers a log entry for the next save.
+ * @param journal The journal.
+ * @param op The kind of change.
+ * @param key The key of the record, or NULL.
+ * @param keyLength The number of key bytes.
+ * @param offset The offset of the data in the record.
+ * @param data The data bytes, or NULL.
+ * @param length The number of data bytes.
+ */
+static void appendEntry(Journal* journal, JournalOp op, const void* key, size_t keyLength,
+                        size_t offset, const void* data, size_t length) {
+    size_t entrySize = sizeof(JournalEntry) + keyLength + length;
+    if (journal->pendingSize + entrySize > journal->pendingCapacity) {
+        size_t capacity = (journal->pendingCapacity > 0) ? journal->pendingCapacity * 2 : 4096;
+        while (capacity < journal->pendingSize + entrySize) {
+            capacity *= 2;
+        }
+        unsigned char* grown = (unsigned char*)realloc(journal->pending, capacity);
+        if (!grown) {
+            // The change cannot be logged, so the next save writes the whole list
+            journal->compactOnSave = true;
+            return;
+        }
+        journal->pending = grown;
+        journal->pendingCapacity = capacity;
+    }
+
+    unsigned char* out = journal->pending + journal->pendingSize;
+    JournalEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.sequence = journal->pendingSequence;
+    entry.op = (uint8_t)op;
+    entry.keyLength = (uint16_t)keyLength;
+    entry.offset = (uint32_t)offset;
+    entry.length = (uint32_t)length;
+    if (keyLength > 0) {
+        memcpy(out + sizeof(entry), key, keyLength);
+    }
+    if (length > 0) {
+        memcpy(out + sizeof(entry) + keyLength, data, length);
+    }
+
+    uint32_t checksum = crc32c(0, (const unsigned char*)&entry + sizeof(entry.checksum),
+                               sizeof(entry) - sizeof(entry.checksum));
+    entry.checksum = crc32c(checksum, out + sizeof(entry), keyLength + length);
+    memcpy(out, &entry, sizeof(entry));
+
+    journal->pendingSize += entrySize;
+    journal->pendingSequence++;
+}
+
+/**
+ * @brief Records that a record was appended to a list.
+ * @param dataList The list.
+ * @param record The new record.
+ */
+void journalRecordAdded(const list* dataList, const void* record) {
+    Journal* journal = findJournal(dataList);
+    if (journal && record && !journal->compactOnSave) {
+        appendEntry(journal, JOURNAL_ADD, NULL, 0, 0, record, journal->format.recordSize);
+    }
+}
+
+/**
+ * @brief Records that a record of a list changed.
+ * @param dataList The list.
+ * @param before A copy of the record before the change.
+ * @param after The record after the change.
+ */
+void journalRecordUpdated(const list* dataList, const void* before, const void* after) {
+    Journal* journal = findJournal(dataList);
+    if (!journal || !before || !after || journal->compactOnSave) {
+        return;
+    }
+
+    // Log only the span between the first and the last changed byte
+    const unsigned char* old = (const unsigned char*)before;
+    const unsigned char* now = (const unsigned char*)after;
+    size_t first = 0;
+    size_t last = journal->format.recordSize;
+    while (first < last && old[first] == now[first]) {
+        first++;
+    }
+    if (first == last) {
+        return; // Nothing changed
+    }
+    while (old[last - 1] == now[last - 1]) {
+        last--;
+    }
+
+    appendEntry(journal, JOURNAL_UPDATE, old + journal->format.keyOffset, recordKeyLength(before, &journal->format),
+                first, now + first, last - first);
+}
+
+/**
+ * @brief Records that a record is about to be removed from a list.
+ * @param dataList The list.
+ * @param record The record being removed.
+ */
+void journalRecordRemoved(const list* dataList, const void* record) {
+    Journal* journal = findJournal(dataList);
+    if (journal && record && !journal->compactOnSave) {
+        appendEntry(journal, JOURNAL_REMOVE, (const unsigned char*)record + journal->format.keyOffset,
+                    recordKeyLength(record, &journal->format), 0, NULL, 0);
+    }
+}
+
+/**
+ * @brief Makes the next save of a journaled list write a new base file.
+ * @param dataList The list.
+ */
+void journalForceCompaction(const list* dataList) {
+    Journal* journal = findJournal(dataList);
+    if (journal) {
+        journal->compactOnSave = true;
+        journal->pendingSize = 0; // The new base will contain these changes
+        journal->pendingSequence = journal->nextSequence;
+    }
+}
+
+/**
+ * @brief Records that a list was reordered.
+ * @param dataList The list.
+ */
+void journalListReordered(const list* dataList) {
+    journalForceCompaction(dataList); // The log does not hold record order
+}
@@ -0,0 +1,422 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "../headers/list.h"
+
+#define listKeyNoEntry SIZE_MAX     // End of a bucket chain
+
+/**
+ * @brief One record of a key index.
+ */
+typedef struct {
+    const void* record;         // Record the entry stands for
+    node* handle;               // Node that held the record when last checked (linked and UNROLLED lists)
+    size_t slot;                // Slot that held the record when last checked (DYNAMIC_ARRAY only)
+    unsigned int generation;    // Slot removals the index had seen when the slot was checked
+    size_t next;                // Next entry in the same bucket
+} ListKeyEntry;
+
+/**
+ * @brief Chained hash index from the key field of every record of a list to its node.
+ */
+struct ListKeyIndex {
+    size_t keyOffset;           // Offset of the key field in a record
+    size_t keyLength;           // Size of the key field in bytes
+    unsigned int generation;    // Slots removed from a DYNAMIC_ARRAY list so far
+    ListKeyEntry* entries;      // Entries in no particular order
+    unsigned char* keys;        // Key of every entry, zero-padded to keyLength
+    size_t count;               // Entries in use
+    size_t capacity;            // Entries the arrays can hold
+    size_t* heads;              // First entry of every bucket
+    size_t bucketCount;         // Number of buckets (a power of two)
+};
+
+/**
+ * @brief Hashes a padded key with FNV-1a.
+ * @param key The key bytes.
+ * @param length The number of bytes.
+ * @return The hash.
+ */
+static size_t hashListKey(const unsigned char* key, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length && key[i] != '\0'; i++) {
+        hash = (hash ^ key[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Copies a key field zero-padded to the key length.
+ * @param out The buffer of keyLength bytes.
+ * @param key The key; at most keyLength bytes are read.
+ * @param keyLength The size of the key field in bytes.
+ */
+static void padListKey(unsigned char* out, const char* key, size_t keyLength) {
+    // Bytes after the terminator are zeroed, so padded keys compare with memcmp like strcmp
+    size_t length = 0;
+    while (length < keyLength && key[length] != '\0') {
+        length++;
+    }
+    memcpy(out, key, length);
+    memset(out + length, 0, keyLength - length);
+}
+
+/**
+ * @brief Returns the padded key stored for an entry.
+ * @param index The index.
+ * @param entry The entry.
+ * @return The key bytes.
+ */
+static unsigned char* entryKey(const ListKeyIndex* index, size_t entry) {
+    return index->keys + entry * index->keyLength;
+}
+
+/**
+ * @brief Spreads the entries over the buckets again after the bucket array changed.
+ * @param index The index.
+ */
+static void rehashListKeys(ListKeyIndex* index) {
+    for (size_t i = 0; i < index->bucketCount; i++) {
+        index->heads[i] = listKeyNoEntry;
+    }
+    for (size_t entry = 0; entry < index->count; entry++) {
+        size_t bucket = hashListKey(entryKey(index, entry), index->keyLength) & (index->bucketCount - 1);
+        index->entries[entry].next = index->heads[bucket];
+        index->heads[bucket] = entry;
+    }
+}
+
+/**
+ * @brief Makes room for one more entry, doubling the arrays and the buckets when full.
+ * @param index The index.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int growListKeys(ListKeyIndex* index) {
+    if (index->count < index->capacity) {
+        return 0;
+    }
+    size_t capacity = (index->capacity > 0) ? index->capacity * 2 : 64;
+    ListKeyEntry* entries = (ListKeyEntry*)realloc(index->entries, capacity * sizeof(ListKeyEntry));
+    if (!entries) {
+        return -1;
+    }
+    index->entries = entries;
+    unsigned char* keys = (unsigned char*)realloc(index->keys, capacity * index->keyLength);
+    if (!keys) {
+        return -1;
+    }
+    index->keys = keys;
+    size_t* heads = (size_t*)realloc(index->heads, capacity * sizeof(size_t));
+    if (!heads) {
+        return -1;
+    }
+    index->heads = heads;
+    index->capacity = capacity;
+    index->bucketCount = capacity; // At most one entry per bucket on average
+    rehashListKeys(index);
+    return 0;
+}
+
+/**
+ * @brief Finds the entry of a record.
+ * @param index The index.
+ * @param record The record, which must still hold the key it was indexed with.
+ * @return The entry, or listKeyNoEntry if the record is not indexed under its key.
+ */
+static size_t findRecordEntry(const ListKeyIndex* index, const void* record) {
+    unsigned char key[listSortMaxKeyBytes];
+    padListKey(key, (const char*)record + index->keyOffset, index->keyLength);
+    size_t entry = index->heads[hashListKey(key, index->keyLength) & (index->bucketCount - 1)];
+    while (entry != listKeyNoEntry && index->entries[entry].record != record) {
+        entry = index->entries[entry].next;
+    }
+    return entry;
+}
+
+/**
+ * @brief Adds a record held by a node to the index.
+ * @param l A pointer to the list structure.
+ * @param index The index.
+ * @param n The node.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int insertListKey(const list* l, ListKeyIndex* index, node* n) {
+    if (growListKeys(index) != 0) {
+        return -1;
+    }
+    size_t entry = index->count++;
+    unsigned char* key = entryKey(index, entry);
+    padListKey(key, (const char*)n->data + index->keyOffset, index->keyLength);
+    size_t bucket = hashListKey(key, index->keyLength) & (index->bucketCount - 1);
+    index->entries[entry].record = n->data;
+    index->entries[entry].handle = n;
+    index->entries[entry].slot = (l->type == DYNAMIC_ARRAY) ? (size_t)(n - l->slots) : 0;
+    index->entries[entry].generation = index->generation;
+    index->entries[entry].next = index->heads[bucket];
+    index->heads[bucket] = entry;
+    return 0;
+}
+
+/**
+ * @brief Unlinks an entry from its bucket.
+ * @param index The index.
+ * @param entry The entry.
+ */
+static void unlinkListKey(ListKeyIndex* index, size_t entry) {
+    size_t* link = &index->heads[hashListKey(entryKey(index, entry), index->keyLength) & (index->bucketCount - 1)];
+    while (*link != entry) {
+        link = &index->entries[*link].next;
+    }
+    *link = index->entries[entry].next;
+}
+
+/**
+ * @brief Removes an entry, moving the last entry into its place.
+ * @param index The index.
+ * @param entry The entry.
+ */
+static void removeListKey(ListKeyIndex* index, size_t entry) {
+    unlinkListKey(index, entry);
+    size_t last = --index->count;
+    if (entry == last) {
+        return;
+    }
+    unlinkListKey(index, last);
+    index->entries[entry] = index->entries[last];
+    memcpy(entryKey(index, entry), entryKey(index, last), index->keyLength);
+    size_t bucket = hashListKey(entryKey(index, entry), index->keyLength) & (index->bucketCount - 1);
+    index->entries[entry].next = index->heads[bucket];
+    index->heads[bucket] = entry;
+}
+
+/**
+ * @brief Builds the key index of a list from scratch.
+ * @param l A pointer to the list structure.
+ * @param keyOffset The offset of the key field in a record.
+ * @param keyLength The size of the key field in bytes.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int buildListKeyIndex(list* l, size_t keyOffset, size_t keyLength) {
+    dropListKeyIndex(l);
+    ListKeyIndex* index = (ListKeyIndex*)calloc(1, sizeof(ListKeyIndex));
+    if (!index) {
+        return -1;
+    }
+    index->keyOffset = keyOffset;
+    index->keyLength = keyLength;
+    l->keyIndex = index;
+    if (growListKeys(index) != 0) {
+        dropListKeyIndex(l); // Allocates the buckets even for a list of NULL records
+        return -1;
+    }
+
+    node* current = l->head;
+    for (int i = 0; i < l->size; i++, current = current->next) {
+        if (current->data != NULL && insertListKey(l, index, current) != 0) {
+            dropListKeyIndex(l);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Scans the list for the first node whose record has a key.
+ * @param l A const pointer to the list structure.
+ * @param keyOffset The offset of the key field in a record.
+ * @param keyLength The size of the key field in bytes.
+ * @param key The padded key.
+ * @return The node, or NULL if no record has the key.
+ */
+static node* scanListKey(const list* l, size_t keyOffset, size_t keyLength, const unsigned char* key) {
+    unsigned char stored[listSortMaxKeyBytes];
+    node* current = l->head;
+    for (int i = 0; i < l->size; i++, current = current->next) {
+        if (current->data != NULL) {
+            padListKey(stored, (const char*)current->data + keyOffset, keyLength);
+            if (memcmp(stored, key, keyLength) == 0) {
+                return current;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Finds the node that holds the record of an entry and checks its key.
+ * @param l A pointer to the list structure.
+ * @param entry The entry.
+ * @param key The padded key the entry was found under.
+ * @return The node, or NULL if the entry no longer matches the list.
+ */
+static node* resolveListKey(list* l, size_t entry, const unsigned char* key) {
+    ListKeyIndex* index = l->keyIndex;
+    ListKeyEntry* found = &index->entries[entry];
+    node* n = NULL;
+    if (l->type == DYNAMIC_ARRAY) {
+        // Appends and buffer moves keep slot numbers; each removal since the last check shifted it down by at most one
+        size_t shift = index->generation - found->generation;
+        size_t lowest = (found->slot > shift) ? found->slot - shift : 0;
+        for (size_t slot = found->slot; slot + 1 > lowest; slot--) {
+            if (slot < (size_t)l->size && l->slots[slot].data == found->record) {
+                n = &l->slots[slot];
+                break;
+            }
+        }
+    } else if (found->handle->data == found->record) {
+        n = found->handle; // Nodes of the other types stay put, but a sort may swap their records
+    }
+    if (n == NULL) {
+        return NULL;
+    }
+
+    // Keys edited in place without dropListKeyIndex() are caught here
+    unsigned char stored[listSortMaxKeyBytes];
+    padListKey(stored, (const char*)n->data + index->keyOffset, index->keyLength);
+    if (memcmp(stored, key, index->keyLength) != 0) {
+        return NULL;
+    }
+    found->handle = n;
+    found->slot = (l->type == DYNAMIC_ARRAY) ? (size_t)(n - l->slots) : 0;
+    found->generation = index->generation;
+    return n;
+}
+
+/**
+ * @brief Finds the first node whose record has a key, through the list's key index.
+ * @param l A pointer to the list structure.
+ * @param keyOffset The offset of the key field in a record.
+ * @param keyLength The size of the key field in bytes, including its terminator.
+ * @param key The key to look for.
+ * @return The node, or NULL if no record has the key.
+ */
+node* findNodeByKey(list* l, size_t keyOffset, size_t keyLength, const char* key) {
+    unsigned char target[listSortMaxKeyBytes];
+    if (l == NULL || key == NULL || keyLength == 0 || keyLength > listSortMaxKeyBytes || l->head == NULL ||
+        strlen(key) > keyLength) {
+        return NULL; // A longer key cannot be in the field
+    }
+    padListKey(target, key, keyLength);
+
+    ListKeyIndex* index = l->keyIndex;
+    bool rebuilt = false;
+    if (index == NULL || index->keyOffset != keyOffset || index->keyLength != keyLength) {
+        if (buildListKeyIndex(l, keyOffset, keyLength) != 0) {
+            return scanListKey(l, keyOffset, keyLength, target);
+        }
+        rebuilt = true;
+    }
+
+    for (;;) {
+        index = l->keyIndex;
+        size_t found = listKeyNoEntry;
+        bool duplicated = false;
+        for (size_t entry = index->heads[hashListKey(target, keyLength) & (index->bucketCount - 1)];
+             entry != listKeyNoEntry; entry = index->entries[entry].next) {
+            if (memcmp(entryKey(index, entry), target, keyLength) == 0) {
+                duplicated = (found != listKeyNoEntry);
+                found = entry;
+                if (duplicated) {
+                    break;
+                }
+            }
+        }
+        if (found == listKeyNoEntry) {
+            return NULL;
+        }
+        if (duplicated) {
+            return scanListKey(l, keyOffset, keyLength, target); // The first in list order wins
+        }
+
+        node* n = resolveListKey(l, found, target);
+        if (n != NULL || rebuilt) {
+            return n;
+        }
+
+        // The list was sorted or edited behind the index's back; start over once
+        if (buildListKeyIndex(l, keyOffset, keyLength) != 0) {
+            return scanListKey(l, keyOffset, keyLength, target);
+        }
+        rebuilt = true;
+    }
+}
+
+/**
+ * @brief Frees the key index of a list; the next findNodeByKey() builds a new one.
+ * @param l A pointer to the list structure.
+ */
+void dropListKeyIndex(list* l) {
+    if (l == NULL || l->keyIndex == NULL) {
+        return;
+    }
+    free(l->keyIndex->entries);
+    free(l->keyIndex->keys);
+    free(l->keyIndex->heads);
+    free(l->keyIndex);
+    l->keyIndex = NULL;
+}
+
+/**
+ * @brief Adds a node that was just linked into the list to its key index.
+ * @param l A pointer to the list structure.
+ * @param n The new node.
+ */
+void indexListNode(list* l, node* n) {
+    if (l->keyIndex != NULL && n->data != NULL && insertListKey(l, l->keyIndex, n) != 0) {
+        dropListKeyIndex(l);
+    }
+}
+
+/**
+ * @brief Removes a node that is about to be unlinked from the list's key index.
+ * @param l A pointer to the list structure.
+ * @param n The node.
+ */
+void unindexListNode(list* l, node* n) {
+    if (l->keyIndex == NULL || n->data == NULL) {
+        return;
+    }
+    size_t entry = findRecordEntry(l->keyIndex, n->data);
+    if (entry == listKeyNoEntry) {
+        dropListKeyIndex(l); // Its key was changed in place; the entry cannot be found any more
+        return;
+    }
+    removeListKey(l->keyIndex, entry);
+}
+
+/**
+ * @brief Counts a DYNAMIC_ARRAY slot removal that shifts the later slots down.
+ * @param l A pointer to the list structure.
+ */
+void shiftListKeySlots(list* l) {
+    if (l->keyIndex != NULL) {
+        l->keyIndex->generation++;
+    }
+}
+
+/**
+ * @brief Points the key index at the nodes of an unrolled block after they were shifted.
+ * @param l A pointer to the list structure.
+ * @param block The block whose nodes moved.
+ * @param first The first node of the block that moved.
+ */
+void reindexUnrolledBlock(list* l, UnrolledBlock* block, int first) {
+    ListKeyIndex* index = l->keyIndex;
+    if (index == NULL) {
+        return;
+    }
+    for (int i = first; i < block->count; i++) {
+        node* n = &block->nodes[i];
+        if (n->data == NULL) {
+            continue;
+        }
+        size_t entry = findRecordEntry(index, n->data);
+        if (entry == listKeyNoEntry) {
+            dropListKeyIndex(l);
+            return;
+        }
+        index->entries[entry].handle = n;
+        index->entries[entry].generation = index->generation;
+    }
+}
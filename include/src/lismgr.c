@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
 #include "../headers/list.h"
 
 /**
@@ -9,7 +12,25 @@
  * @return Returns 0 on success, -1 on memory allocation failure.
  */
 int addNode(list** l, void* data) {
-    node* newNode = (node*)malloc(sizeof(node));
+    return addNodeWithHandle(l, data, NULL);
+}
+
+/**
+ * @brief Adds a new node to the end of the list and reports the node used.
+ * @param l A double pointer to the list structure.
+ * @param data A void pointer to the data to be stored in the new node.
+ * @param handle Receives the node holding the data. Can be NULL.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+int addNodeWithHandle(list** l, void* data, node** handle) {
+    node* newNode;
+    if ((*l)->type == DYNAMIC_ARRAY) {
+        newNode = acquireArraySlot(*l);
+    } else if ((*l)->type == UNROLLED) {
+        newNode = acquireUnrolledNode(*l);
+    } else {
+        newNode = acquirePoolNode(&(*l)->pool);
+    }
     
     if (!newNode) {
         fprintf(stderr, "Memory allocation failed\n");
@@ -32,16 +53,175 @@ int addNode(list** l, void* data) {
             linkNodeSinglyCircular(l, newNode);
             break;
         }
-        case DOUBLY_CIRCULAR: {
+        case DOUBLY_CIRCULAR:
+        case DYNAMIC_ARRAY:
+        case UNROLLED: {
+            // Array slots and unrolled blocks are linked exactly like a doubly circular list
             linkNodeDoublyCircular(l, newNode);
             break;
         }
     }
 
     (*l)->size++;
+    indexListNode(*l, newNode);
+    if (handle != NULL) {
+        *handle = newNode;
+    }
     return 0;
 }
 
+/**
+ * @brief Appends an array of items to the end of the list using a single node allocation.
+ * @param l A pointer to the list structure.
+ * @param items The data pointers to store, in list order.
+ * @param n The number of items.
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int addNodesBulk(list* l, void** items, size_t n) {
+    if (l == NULL || (items == NULL && n > 0)) {
+        return -1;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    if (n > (size_t)(INT_MAX - l->size)) {
+        return -1;
+    }
+    int count = (int)n;
+    
+    // Array-backed lists grow once, fill the slots and relink the new range
+    if (l->type == DYNAMIC_ARRAY) {
+        if (reserveArraySlots(l, count) != 0) {
+            fprintf(stderr, "Memory allocation failed\n");
+            return -1;
+        }
+        int first = l->size;
+        for (int i = 0; i < count; i++) {
+            l->slots[first + i].data = items[i];
+        }
+        l->size += count;
+        relinkNodeArray(l, first);
+        for (int i = 0; i < count; i++) {
+            indexListNode(l, &l->slots[first + i]);
+        }
+        return 0;
+    }
+    
+    // Unrolled lists fill their blocks in order; on failure the new tail is taken back
+    if (l->type == UNROLLED) {
+        for (int i = 0; i < count; i++) {
+            if (addNode(&l, items[i]) != 0) {
+                while (i-- > 0) {
+                    removeNodeByHandle(l, l->tail, NULL);
+                }
+                return -1;
+            }
+        }
+        return 0;
+    }
+    
+    node* run = acquirePoolNodes(&l->pool, count);
+    if (!run) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    
+    void (*linkNode)(list** l, node* newNode) = linkNodeDoublyCircular;
+    switch (l->type) {
+        case SINGLY:          linkNode = linkNodeSingly; break;
+        case DOUBLY:          linkNode = linkNodeDoubly; break;
+        case SINGLY_CIRCULAR: linkNode = linkNodeSinglyCircular; break;
+        default:              break;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        run[i].data = items[i];
+        run[i].next = NULL;
+        run[i].prev = NULL;
+        linkNode(&l, &run[i]);
+        indexListNode(l, &run[i]);
+    }
+    l->size += count;
+    return 0;
+}
+
+/**
+ * @brief Hands a malloc'd block of record memory over to the list.
+ * @param l A pointer to the list structure.
+ * @param memory The block to adopt. It is freed together with the list.
+ * @param size The size of the block in bytes.
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int adoptDataBlock(list* l, void* memory, size_t size) {
+    return adoptExternalDataBlock(l, memory, size, NULL);
+}
+
+/**
+ * @brief Hands a block of record memory with its own release function over to the list.
+ * @param l A pointer to the list structure.
+ * @param memory The block to adopt.
+ * @param size The size of the block in bytes.
+ * @param release The function that releases the block, or NULL for free().
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int adoptExternalDataBlock(list* l, void* memory, size_t size, void (*release)(void* memory, size_t size)) {
+    if (l == NULL || memory == NULL) {
+        return -1;
+    }
+    
+    DataBlock* block = (DataBlock*)malloc(sizeof(DataBlock));
+    if (!block) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    block->memory = memory;
+    block->size = size;
+    block->release = release;
+    block->next = l->dataBlocks;
+    l->dataBlocks = block;
+    return 0;
+}
+
+/**
+ * @brief Checks whether a data pointer points into one of the list's owned blocks.
+ * @param l A const pointer to the list structure.
+ * @param data The data pointer to check.
+ * @return true if the data lives in an owned block, false otherwise.
+ */
+bool isOwnedData(const list* l, const void* data) {
+    if (l == NULL || data == NULL) {
+        return false;
+    }
+    
+    uintptr_t address = (uintptr_t)data;
+    for (const DataBlock* block = l->dataBlocks; block != NULL; block = block->next) {
+        uintptr_t start = (uintptr_t)block->memory;
+        if (address >= start && address - start < block->size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Releases every record block owned by the list.
+ * @param l A pointer to the list structure.
+ */
+static void freeDataBlocks(list* l) {
+    DataBlock* block = l->dataBlocks;
+    while (block != NULL) {
+        DataBlock* next = block->next;
+        if (block->release != NULL) {
+            block->release(block->memory, block->size);
+        } else {
+            free(block->memory);
+        }
+        free(block);
+        block = next;
+    }
+    l->dataBlocks = NULL;
+}
+
 /**
  * @brief Removes the first node containing the specified data from the list.
  * @param l A pointer to the list structure.
@@ -53,108 +233,132 @@ void removeNode(list* l, const void* data, void (*freeData)(void* data)) {
         return;
     }
     
-    node* current = l->head;
-    node* prev = NULL;
+    node* target = findNodeByData(l, data);
+    if (target == NULL) {
+        // Node not found
+        return;
+    }
     
-    // Find the node with matching data
-    while (current != NULL && current->data != data) {
-        prev = current;
-        current = current->next;
-        
-        // Handle circular lists to avoid infinite loops
-        if (l->type == SINGLY_CIRCULAR || l->type == DOUBLY_CIRCULAR) {
-            if (current == l->head) {
-                // We've come full circle without finding the data
-                return;
+    removeNodeByHandle(l, target, freeData);
+}
+
+/**
+ * @brief Finds the node that stores the given data pointer.
+ * @param l A const pointer to the list structure.
+ * @param data The data pointer to look for. The comparison is by pointer address.
+ * @return A pointer to the node holding the data, or NULL if it is not in the list.
+ */
+node* findNodeByData(const list* l, const void* data) {
+    if (l == NULL || l->head == NULL || data == NULL) {
+        return NULL;
+    }
+    
+    // Array-backed lists are scanned as a plain contiguous buffer
+    if (l->type == DYNAMIC_ARRAY) {
+        for (int i = 0; i < l->size; i++) {
+            if (l->slots[i].data == data) {
+                return &l->slots[i];
             }
         }
+        return NULL;
     }
     
-    if (current == NULL) {
-        // Node not found
+    // Unrolled lists are scanned block by block
+    if (l->type == UNROLLED) {
+        for (UnrolledBlock* block = l->firstBlock; block != NULL; block = block->next) {
+            for (int i = 0; i < block->count; i++) {
+                if (block->nodes[i].data == data) {
+                    return &block->nodes[i];
+                }
+            }
+        }
+        return NULL;
+    }
+    
+    node* current = l->head;
+    do {
+        if (current->data == data) {
+            return current;
+        }
+        current = current->next;
+    } while (current != NULL && current != l->head); // Stops at NULL or after a full circle
+    
+    return NULL;
+}
+
+/**
+ * @brief Unlinks and recycles a node obtained from addNodeWithHandle or findNodeByData.
+ * @param l A pointer to the list structure that owns the node.
+ * @param handle The node to remove.
+ * @param freeData A function pointer to a function that can free the data stored in the node. Can be NULL if data should not be freed.
+ */
+void removeNodeByHandle(list* l, node* handle, void (*freeData)(void* data)) {
+    if (l == NULL || l->head == NULL || handle == NULL) {
         return;
     }
     
-    // Handle the node removal based on list type
-    switch (l->type) {
-        case SINGLY:
-            if (prev == NULL) {
-                // Head node
-                l->head = current->next;
-                if (l->head == NULL) {
-                    l->tail = NULL;
-                }
-            } else {
-                prev->next = current->next;
-                if (current == l->tail) {
-                    l->tail = prev;
-                }
-            }
-            break;
+    void* removedData = handle->data;
+    
+    if (l->type == DYNAMIC_ARRAY) {
+        // Close the gap with a single move, then relink the shifted slots
+        int index = (int)(handle - l->slots);
+        if (index < 0 || index >= l->size) {
+            return;
+        }
+        unindexListNode(l, handle);
+        if (index < l->size - 1) {
+            shiftListKeySlots(l); // Every later slot shifts down by one
+        }
+        memmove(&l->slots[index], &l->slots[index + 1], (size_t)(l->size - index - 1) * sizeof(node));
+        l->size--;
+        relinkNodeArray(l, index);
+    } else if (l->type == UNROLLED) {
+        UnrolledBlock* block = findUnrolledBlock(l, handle);
+        if (block == NULL) {
+            return;
+        }
+        unindexListNode(l, handle);
+        removeUnrolledNode(l, block, handle);
+        l->size--;
+    } else {
+        unindexListNode(l, handle);
+        if (l->size == 1) {
+            // Last remaining node
+            l->head = NULL;
+            l->tail = NULL;
+        } else if (isCircularListType(l->type)) {
+            // Every node has both neighbours in a circular list
+            handle->prev->next = handle->next;
+            handle->next->prev = handle->prev;
             
-        case DOUBLY:
-            if (prev == NULL) {
-                // Head node
-                l->head = current->next;
-                if (l->head) {
-                    l->head->prev = NULL;
-                } else {
-                    l->tail = NULL;
-                }
-            } else {
-                prev->next = current->next;
-                if (current->next) {
-                    current->next->prev = prev;
-                }
-                if (current == l->tail) {
-                    l->tail = prev;
-                }
+            if (handle == l->head) {
+                l->head = handle->next;
             }
-            break;
-            
-        case SINGLY_CIRCULAR:
-            if (prev == NULL) {
-                // Head node in circular list
-                if (current->next == current) {
-                    // Single node in the list
-                    l->head = NULL;
-                    l->tail = NULL;
-                } else {
-                    l->head = current->next;
-                    l->tail->next = l->head;
-                }
+            if (handle == l->tail) {
+                l->tail = handle->prev;
+            }
+        } else {
+            if (handle->prev != NULL) {
+                handle->prev->next = handle->next;
             } else {
-                prev->next = current->next;
-                if (current == l->tail) {
-                    l->tail = prev;
-                }
+                l->head = handle->next; // Head node
             }
-            break;
             
-        case DOUBLY_CIRCULAR:
-            if (current->next == current) {
-                // Single node in the list
-                l->head = NULL;
-                l->tail = NULL;
+            if (handle->next != NULL) {
+                handle->next->prev = handle->prev;
             } else {
-                current->prev->next = current->next;
-                current->next->prev = current->prev;
-                
-                if (current == l->head) {
-                    l->head = current->next;
-                }
-                if (current == l->tail) {
-                    l->tail = current->prev;
-                }
+                l->tail = handle->prev; // Tail node
             }
-            break;
+        }
+        
+        releasePoolNode(&l->pool, handle);
+        l->size--;
     }
     
-    if (freeData != NULL) {
-        freeData(current->data);
+    // Records inside an owned block are released with the block
+    if (freeData != NULL && !isOwnedData(l, removedData)) {
+        freeData(removedData);
     }
-    free(current);
-    l->size--;
 }
 
 /**
@@ -164,10 +368,36 @@ void removeNode(list* l, const void* data, void (*freeData)(void* data)) {
  * @return A void pointer to the data of the node at the specified index, or NULL if the index is out of bounds.
  */
 void* getNodeData(const list* l, int index) {
+    node* target = getNode(l, index);
+    return target ? target->data : NULL;
+}
+
+/**
+ * @brief Retrieves the node at a specific index in the list.
+ * @param l A const pointer to the list structure.
+ * @param index The zero-based index of the node.
+ * @return A pointer to the node at the specified index, or NULL if the index is out of bounds.
+ */
+node* getNode(const list* l, int index) {
     if (l == NULL || l->head == NULL || index < 0 || index >= l->size) {
         return NULL;
     }
 
+    // Array-backed lists are indexed directly
+    if (l->type == DYNAMIC_ARRAY) {
+        return &l->slots[index];
+    }
+
+    // Unrolled lists skip whole blocks before stepping into one
+    if (l->type == UNROLLED) {
+        UnrolledBlock* block = l->firstBlock;
+        while (index >= block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+        return &block->nodes[index];
+    }
+
     node* current = l->head;
     for (int i = 0; i < index; i++) {
         current = current->next;
@@ -176,36 +406,85 @@ void* getNodeData(const list* l, int index) {
         }
     }
     
-    return current->data;
+    return current;
 }
 
 /**
  * @brief Removes all nodes from the list, optionally freeing the data in each node.
+ * Node memory is released slab by slab through the list's node pool.
  * @param l A pointer to the list structure to be cleared.
  * @param freeData A function pointer to a function that can free the data stored in each node. Can be NULL.
  */
 void clearList(list* l, void (*freeData)(void* data)) {
-    if (l == NULL || l->head == NULL) {
+    if (l == NULL) {
         return;
     }
+    dropListKeyIndex(l);
     
-    node* current = l->head;
-    node* next;
+    // Array-backed lists free their data straight from the slot buffer
+    if (l->type == DYNAMIC_ARRAY) {
+        if (freeData != NULL) {
+            for (int i = 0; i < l->size; i++) {
+                if (!isOwnedData(l, l->slots[i].data)) {
+                    freeData(l->slots[i].data);
+                }
+            }
+        }
+        freeDataBlocks(l);
+        free(l->slots);
+        l->slots = NULL;
+        l->capacity = 0;
+        l->head = NULL;
+        l->tail = NULL;
+        l->size = 0;
+        return;
+    }
+    
+    // Unrolled lists free their data and blocks block by block
+    if (l->type == UNROLLED) {
+        UnrolledBlock* block = l->firstBlock;
+        while (block != NULL) {
+            UnrolledBlock* next = block->next;
+            if (freeData != NULL) {
+                for (int i = 0; i < block->count; i++) {
+                    if (!isOwnedData(l, block->nodes[i].data)) {
+                        freeData(block->nodes[i].data);
+                    }
+                }
+            }
+            free(block);
+            block = next;
+        }
+        freeDataBlocks(l);
+        l->firstBlock = NULL;
+        l->lastBlock = NULL;
+        l->head = NULL;
+        l->tail = NULL;
+        l->size = 0;
+        return;
+    }
     
     // For circular lists, we need to break the circle first
-    if (l->type == SINGLY_CIRCULAR || l->type == DOUBLY_CIRCULAR) {
+    if (l->head != NULL && isCircularListType(l->type)) {
         l->tail->next = NULL;
     }
     
-    while (current != NULL) {
-        next = current->next;
-        if (freeData != NULL) {
-            freeData(current->data);
+    // Free the data only; node memory goes back with the pool's slabs.
+    // The pool is released even for an empty list since removed nodes
+    // stay cached on its free list.
+    if (freeData != NULL) {
+        node* current = l->head;
+        while (current != NULL) {
+            if (!isOwnedData(l, current->data)) {
+                freeData(current->data);
+            }
+            current = current->next;
         }
-        free(current);
-        current = next;
     }
     
+    freeDataBlocks(l);
+    freeNodePool(&l->pool);
+    
     l->head = NULL;
     l->tail = NULL;
     l->size = 0;
@@ -240,7 +519,7 @@ void printList(const list* l, void (*printFunc)(const void* data)) {
         }
         
         // For circular lists, stop when we reach the head again
-        if ((l->type == SINGLY_CIRCULAR || l->type == DOUBLY_CIRCULAR) && current == l->head) {
+        if (isCircularListType(l->type) && current == l->head) {
             break;
         }
     } while (current != NULL);
@@ -262,6 +541,13 @@ int createList(list** l, ListType type) {
     (*l)->tail = NULL;
     (*l)->type = type;
     (*l)->size = 0;
+    initNodePool(&(*l)->pool);
+    (*l)->slots = NULL;
+    (*l)->capacity = 0;
+    (*l)->dataBlocks = NULL;
+    (*l)->firstBlock = NULL;
+    (*l)->lastBlock = NULL;
+    (*l)->keyIndex = NULL;
     return 0;
 }
 
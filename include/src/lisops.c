@@ -1,3 +1,4 @@
+#include <string.h>
 #include "../headers/list.h"
 
 /**
@@ -10,6 +11,7 @@ void linkNodeSingly(list** l, node* newNode) {
         (*l)->head = newNode;
         (*l)->tail = newNode;
     } else {
+        newNode->prev = (*l)->tail; // Kept so removal by handle is O(1)
         (*l)->tail->next = newNode;
         (*l)->tail = newNode;
     }
@@ -41,9 +43,12 @@ void linkNodeSinglyCircular(list** l, node* newNode) {
         (*l)->head = newNode;
         (*l)->tail = newNode;
         newNode->next = newNode; // Point to itself
+        newNode->prev = newNode; // Kept so removal by handle is O(1)
     } else {
         newNode->next = (*l)->head; // Point to head
+        newNode->prev = (*l)->tail; // Back link used only for removal by handle
         (*l)->tail->next = newNode; // Previous tail points to new node
+        (*l)->head->prev = newNode; // Head's back link wraps to the new tail
         (*l)->tail = newNode; // Update tail
     }
 }
@@ -71,4 +76,330 @@ void linkNodeDoublyCircular(list** l, node* newNode) {
         // Move the tail pointer to the new node
         (*l)->tail = newNode;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Initializes an empty node pool.
+ * @param pool A pointer to the pool to initialize.
+ */
+void initNodePool(NodePool* pool) {
+    pool->slabs = NULL;
+    pool->freeList = NULL;
+    pool->nextSlabSize = nodePoolInitialSlab;
+}
+
+/**
+ * @brief Takes a node from the pool, allocating a new slab only when needed.
+ * @param pool A pointer to the pool to allocate from.
+ * @return A pointer to an uninitialized node, or NULL on memory allocation failure.
+ */
+node* acquirePoolNode(NodePool* pool) {
+    // Recycled nodes are reused first
+    if (pool->freeList != NULL) {
+        node* recycled = pool->freeList;
+        pool->freeList = recycled->next;
+        return recycled;
+    }
+
+    // Allocate a new slab when the newest one is exhausted
+    if (pool->slabs == NULL || pool->slabs->used >= pool->slabs->capacity) {
+        int capacity = pool->nextSlabSize;
+        NodeSlab* slab = (NodeSlab*)malloc(sizeof(NodeSlab) + (size_t)capacity * sizeof(node));
+        if (!slab) {
+            return NULL;
+        }
+        slab->capacity = capacity;
+        slab->used = 0;
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+
+        // Grow geometrically so large loads need only a handful of slabs
+        if (pool->nextSlabSize < nodePoolMaxSlab) {
+            pool->nextSlabSize *= 2;
+        }
+    }
+
+    return &pool->slabs->nodes[pool->slabs->used++];
+}
+
+/**
+ * @brief Takes a run of adjacent nodes from the pool for a bulk append.
+ * @param pool A pointer to the pool to allocate from.
+ * @param count The number of nodes needed.
+ * @return A pointer to the first of count uninitialized nodes, or NULL on memory allocation failure.
+ */
+node* acquirePoolNodes(NodePool* pool, int count) {
+    if (count <= 0) {
+        return NULL;
+    }
+
+    // Small runs fit in the remainder of the newest slab
+    if (pool->slabs != NULL && pool->slabs->capacity - pool->slabs->used >= count) {
+        node* run = &pool->slabs->nodes[pool->slabs->used];
+        pool->slabs->used += count;
+        return run;
+    }
+
+    // Otherwise the whole run gets a slab of its own
+    NodeSlab* slab = (NodeSlab*)malloc(sizeof(NodeSlab) + (size_t)count * sizeof(node));
+    if (!slab) {
+        return NULL;
+    }
+    slab->capacity = count;
+    slab->used = count;
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    return slab->nodes;
+}
+
+/**
+ * @brief Returns a node to the pool's free list.
+ * @param pool A pointer to the pool that owns the node.
+ * @param n The node to recycle.
+ */
+void releasePoolNode(NodePool* pool, node* n) {
+    n->data = NULL;
+    n->prev = NULL;
+    n->next = pool->freeList;
+    pool->freeList = n;
+}
+
+/**
+ * @brief Releases every slab owned by the pool in a single pass.
+ * @param pool A pointer to the pool to release.
+ */
+void freeNodePool(NodePool* pool) {
+    NodeSlab* slab = pool->slabs;
+    while (slab != NULL) {
+        NodeSlab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    initNodePool(pool);
+}
+
+/**
+ * @brief Checks whether a list type links its tail back to its head.
+ * @param type The list type to check.
+ * @return true for circular lists (including DYNAMIC_ARRAY and UNROLLED), false otherwise.
+ */
+bool isCircularListType(ListType type) {
+    return type == SINGLY_CIRCULAR || type == DOUBLY_CIRCULAR || type == DYNAMIC_ARRAY || type == UNROLLED;
+}
+
+/**
+ * @brief Relinks the slots of an array-backed list from a given index onwards.
+ * @param l A pointer to the list structure.
+ * @param from The first slot index whose links need to be rebuilt.
+ */
+void relinkNodeArray(list* l, int from) {
+    int count = l->size;
+    if (count == 0) {
+        l->head = NULL;
+        l->tail = NULL;
+        return;
+    }
+
+    node* slots = l->slots;
+    // Start one slot early so the predecessor's next pointer is refreshed too
+    int start = (from > 0) ? from - 1 : 0;
+    for (int i = start; i < count; i++) {
+        slots[i].prev = &slots[(i == 0) ? count - 1 : i - 1];
+        slots[i].next = &slots[(i == count - 1) ? 0 : i + 1];
+    }
+    slots[0].prev = &slots[count - 1]; // Head wraps around to the tail
+
+    l->head = &slots[0];
+    l->tail = &slots[count - 1];
+}
+
+/**
+ * @brief Grows the slot buffer of an array-backed list once so it can take extra slots.
+ * @param l A pointer to the list structure.
+ * @param extra The number of slots that will be appended.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+int reserveArraySlots(list* l, int extra) {
+    if (l->size + extra <= l->capacity) {
+        return 0;
+    }
+
+    int newCapacity = (l->capacity > 0) ? l->capacity : arrayListInitialCapacity;
+    while (newCapacity < l->size + extra) {
+        newCapacity *= 2;
+    }
+
+    node* grown = (node*)realloc(l->slots, (size_t)newCapacity * sizeof(node));
+    if (!grown) {
+        return -1;
+    }
+
+    bool moved = (grown != l->slots);
+    l->slots = grown;
+    l->capacity = newCapacity;
+
+    // Every prev/next pointer refers to the old buffer after a move
+    if (moved) {
+        relinkNodeArray(l, 0);
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns the next free slot of an array-backed list, growing the buffer if needed.
+ * @param l A pointer to the list structure.
+ * @return A pointer to the slot at index l->size, or NULL on memory allocation failure.
+ */
+node* acquireArraySlot(list* l) {
+    if (l->size >= l->capacity) {
+        int newCapacity = (l->capacity > 0) ? l->capacity * 2 : arrayListInitialCapacity;
+        node* grown = (node*)realloc(l->slots, (size_t)newCapacity * sizeof(node));
+        if (!grown) {
+            return NULL;
+        }
+
+        bool moved = (grown != l->slots);
+        l->slots = grown;
+        l->capacity = newCapacity;
+
+        // Every prev/next pointer refers to the old buffer after a move
+        if (moved) {
+            relinkNodeArray(l, 0);
+        }
+    }
+
+    return &l->slots[l->size];
+}
+
+/**
+ * @brief Returns the next free node at the end of an unrolled list, adding a block if needed.
+ * @param l A pointer to the list structure.
+ * @return A pointer to an uninitialized node, or NULL on memory allocation failure.
+ */
+node* acquireUnrolledNode(list* l) {
+    UnrolledBlock* block = l->lastBlock;
+    if (block == NULL || block->count >= unrolledBlockCapacity) {
+        block = (UnrolledBlock*)malloc(sizeof(UnrolledBlock));
+        if (!block) {
+            return NULL;
+        }
+        block->count = 0;
+        block->next = NULL;
+        block->prev = l->lastBlock;
+        if (l->lastBlock != NULL) {
+            l->lastBlock->next = block;
+        } else {
+            l->firstBlock = block;
+        }
+        l->lastBlock = block;
+    }
+
+    return &block->nodes[block->count++];
+}
+
+/**
+ * @brief Finds the block of an unrolled list that contains a node.
+ * @param l A const pointer to the list structure.
+ * @param n The node to look up.
+ * @return A pointer to the owning block, or NULL if the node is not in the list.
+ */
+UnrolledBlock* findUnrolledBlock(const list* l, const node* n) {
+    // Removals near the end are the common case, so try the last block first
+    UnrolledBlock* block = l->lastBlock;
+    if (block != NULL && n >= block->nodes && n < block->nodes + block->count) {
+        return block;
+    }
+
+    for (block = l->firstBlock; block != NULL; block = block->next) {
+        if (n >= block->nodes && n < block->nodes + block->count) {
+            return block;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Rebuilds the links of one block of an unrolled list and its boundaries.
+ * @param l A pointer to the list structure.
+ * @param block The block to relink. Must hold at least one node.
+ */
+void relinkUnrolledBlock(list* l, UnrolledBlock* block) {
+    node* nodes = block->nodes;
+    int count = block->count;
+    for (int i = 1; i < count; i++) {
+        nodes[i].prev = &nodes[i - 1];
+        nodes[i - 1].next = &nodes[i];
+    }
+
+    // The neighbours wrap around at both ends because the node links are circular
+    UnrolledBlock* before = (block->prev != NULL) ? block->prev : l->lastBlock;
+    UnrolledBlock* after = (block->next != NULL) ? block->next : l->firstBlock;
+    node* previousNode = (before == block) ? &nodes[count - 1] : &before->nodes[before->count - 1];
+    node* nextNode = (after == block) ? &nodes[0] : &after->nodes[0];
+
+    nodes[0].prev = previousNode;
+    previousNode->next = &nodes[0];
+    nodes[count - 1].next = nextNode;
+    nextNode->prev = &nodes[count - 1];
+
+    l->head = &l->firstBlock->nodes[0];
+    l->tail = &l->lastBlock->nodes[l->lastBlock->count - 1];
+}
+
+/**
+ * @brief Unlinks a block from the block chain of an unrolled list and frees it.
+ * @param l A pointer to the list structure.
+ * @param block The block to release.
+ */
+static void releaseUnrolledBlock(list* l, UnrolledBlock* block) {
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        l->firstBlock = block->next;
+    }
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    } else {
+        l->lastBlock = block->prev;
+    }
+    free(block);
+}
+
+/**
+ * @brief Removes a node from an unrolled list, compacting its block.
+ * @param l A pointer to the list structure.
+ * @param block The block that holds the node.
+ * @param n The node to remove.
+ */
+void removeUnrolledNode(list* l, UnrolledBlock* block, node* n) {
+    int index = (int)(n - block->nodes);
+    memmove(&block->nodes[index], &block->nodes[index + 1],
+            (size_t)(block->count - index - 1) * sizeof(node));
+    block->count--;
+
+    if (block->count == 0) {
+        UnrolledBlock* neighbour = (block->prev != NULL) ? block->prev : block->next;
+        releaseUnrolledBlock(l, block);
+        if (neighbour == NULL) {
+            l->head = NULL;
+            l->tail = NULL;
+            return;
+        }
+        // Relinking a neighbour also closes the gap on its other side
+        relinkUnrolledBlock(l, neighbour);
+        return;
+    }
+
+    // Keep blocks dense: fold a small successor into a block that is under half full
+    UnrolledBlock* next = block->next;
+    if (next != NULL && block->count < unrolledBlockCapacity / 2 &&
+        block->count + next->count <= unrolledBlockCapacity) {
+        memcpy(&block->nodes[block->count], next->nodes, (size_t)next->count * sizeof(node));
+        block->count += next->count;
+        releaseUnrolledBlock(l, next);
+    }
+
+    relinkUnrolledBlock(l, block);
+    reindexUnrolledBlock(l, block, index);
+}
@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../headers/list.h"
+
+/**
+ * @brief Work description for sorting one run of the item array.
+ */
+typedef struct {
+    SortItem* items;                                // First item of the run
+    int count;                                      // Number of items in the run
+    int (*compare)(const void*, const void*);       // Comparator applied to the data
+    bool stable;                                    // Stable merge sort or introsort
+    int result;                                     // 0 on success, -1 on allocation failure
+} RunSortTask;
+
+/**
+ * @brief Work description for merging one output partition of all runs.
+ */
+typedef struct {
+    const SortItem* sources[listSortMaxThreads];    // Start of this partition inside every run
+    int lengths[listSortMaxThreads];                // Items of every run that fall into this partition
+    int runCount;                                   // Number of runs
+    SortItem* output;                               // Destination of the merged partition
+    int (*compare)(const void*, const void*);       // Comparator applied to the data
+} MergeTask;
+
+/**
+ * @brief Thread entry point that sorts one run.
+ * @param arg A pointer to a RunSortTask.
+ * @return Always NULL; the outcome is stored in the task.
+ */
+static void* sortRunThread(void* arg) {
+    RunSortTask* task = (RunSortTask*)arg;
+    task->result = sortItems(task->items, task->count, task->compare, task->stable);
+    return NULL;
+}
+
+/**
+ * @brief Checks whether the head of one run must be emitted before the head of another.
+ * @param task The merge task that owns the runs.
+ * @param positions The current read position inside every run.
+ * @param a The first run index.
+ * @param b The second run index.
+ * @return true if run a's head comes first. Ties go to the lower run, which keeps the merge stable.
+ */
+static bool runHeadBefore(const MergeTask* task, const int* positions, int a, int b) {
+    int order = task->compare(task->sources[a][positions[a]].data, task->sources[b][positions[b]].data);
+    return order < 0 || (order == 0 && a < b);
+}
+
+/**
+ * @brief Restores the min-heap of run indices below a position.
+ * @param task The merge task that owns the runs.
+ * @param positions The current read position inside every run.
+ * @param heap The heap of run indices.
+ * @param root The position to sift down from.
+ * @param size The number of runs in the heap.
+ */
+static void siftDownRuns(const MergeTask* task, const int* positions, int* heap, int root, int size) {
+    int value = heap[root];
+    while (2 * root + 1 < size) {
+        int child = 2 * root + 1;
+        if (child + 1 < size && runHeadBefore(task, positions, heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!runHeadBefore(task, positions, heap[child], value)) {
+            break;
+        }
+        heap[root] = heap[child];
+        root = child;
+    }
+    heap[root] = value;
+}
+
+/**
+ * @brief Thread entry point that k-way merges one output partition with a heap of run heads.
+ * @param arg A pointer to a MergeTask.
+ * @return Always NULL.
+ */
+static void* mergePartitionThread(void* arg) {
+    MergeTask* task = (MergeTask*)arg;
+    int positions[listSortMaxThreads] = {0};
+    int heap[listSortMaxThreads];
+    int heapSize = 0;
+
+    for (int run = 0; run < task->runCount; run++) {
+        if (task->lengths[run] > 0) {
+            heap[heapSize++] = run;
+        }
+    }
+    for (int i = heapSize / 2 - 1; i >= 0; i--) {
+        siftDownRuns(task, positions, heap, i, heapSize);
+    }
+
+    SortItem* out = task->output;
+    while (heapSize > 0) {
+        int run = heap[0];
+        *out++ = task->sources[run][positions[run]++];
+        if (positions[run] == task->lengths[run]) {
+            heap[0] = heap[--heapSize];
+        }
+        siftDownRuns(task, positions, heap, 0, heapSize);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs one task per thread, using the calling thread for the first task.
+ * @param entry The thread entry point.
+ * @param tasks The task array.
+ * @param taskSize The size of one task in bytes.
+ * @param taskCount The number of tasks.
+ */
+static void runTasksInParallel(void* (*entry)(void*), void* tasks, size_t taskSize, int taskCount) {
+    pthread_t threads[listSortMaxThreads];
+    bool started[listSortMaxThreads] = {false};
+    char* base = (char*)tasks;
+
+    for (int i = 1; i < taskCount; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, entry, base + (size_t)i * taskSize) == 0);
+    }
+    entry(base);
+    for (int i = 1; i < taskCount; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            entry(base + (size_t)i * taskSize); // Thread creation failed; do the work here
+        }
+    }
+}
+
+/**
+ * @brief Finds the first item of a sorted run that does not sort before a key.
+ * @param items The sorted run.
+ * @param count The number of items in the run.
+ * @param key The data to search for.
+ * @param compare The comparator applied to the data.
+ * @return The index of the first item whose data compares greater than or equal to key.
+ */
+static int lowerBoundItems(const SortItem* items, int count, const void* key, int (*compare)(const void*, const void*)) {
+    int low = 0;
+    int high = count;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (compare(items[mid].data, key) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Sorts a list using several threads.
+ * @param l A pointer to the list structure.
+ * @param compare The comparator applied to the data of two nodes.
+ * @param stable Whether nodes that compare equal must keep their order.
+ * @param threadCount The number of threads to use (clamped to 1..listSortMaxThreads).
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int sortListParallel(list* l, int (*compare)(const void*, const void*), bool stable, int threadCount) {
+    if (l == NULL || compare == NULL) {
+        return -1;
+    }
+
+    // Each thread needs a run worth splitting off, otherwise sort in one pass
+    int maxRuns = l->size / listParallelSortMinRun;
+    int runCount = threadCount;
+    if (runCount > listSortMaxThreads) runCount = listSortMaxThreads;
+    if (runCount > maxRuns) runCount = maxRuns;
+    if (runCount <= 1) {
+        return sortList(l, compare, stable);
+    }
+
+    int count = l->size;
+    SortItem* items = gatherSortItems(l);
+    SortItem* merged = (SortItem*)malloc((size_t)count * sizeof(SortItem));
+    int* bounds = (int*)malloc((size_t)runCount * (runCount + 1) * sizeof(int));
+    SortItem* samples = (SortItem*)malloc((size_t)runCount * listParallelSortSamples * sizeof(SortItem));
+    if (!items || !merged || !bounds || !samples) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(items);
+        free(merged);
+        free(bounds);
+        free(samples);
+        return -1;
+    }
+
+    // Phase 1: split the array into contiguous runs and sort them concurrently
+    RunSortTask runTasks[listSortMaxThreads];
+    int runStart[listSortMaxThreads + 1];
+    for (int r = 0; r <= runCount; r++) {
+        runStart[r] = (int)((long long)count * r / runCount);
+    }
+    for (int r = 0; r < runCount; r++) {
+        runTasks[r].items = items + runStart[r];
+        runTasks[r].count = runStart[r + 1] - runStart[r];
+        runTasks[r].compare = compare;
+        runTasks[r].stable = stable;
+        runTasks[r].result = 0;
+    }
+    runTasksInParallel(sortRunThread, runTasks, sizeof(RunSortTask), runCount);
+
+    int result = 0;
+    for (int r = 0; r < runCount; r++) {
+        if (runTasks[r].result != 0) {
+            result = -1;
+        }
+    }
+
+    if (result == 0) {
+        // Phase 2: pick runCount - 1 splitters from an even sample of every sorted run
+        int sampleCount = 0;
+        for (int r = 0; r < runCount; r++) {
+            for (int s = 0; s < listParallelSortSamples; s++) {
+                int offset = (int)((long long)runTasks[r].count * (2 * s + 1) / (2 * listParallelSortSamples));
+                samples[sampleCount++] = runTasks[r].items[offset];
+            }
+        }
+        sortItems(samples, sampleCount, compare, false);
+
+        // Every run is cut at the same splitters, so equal keys land in one partition
+        for (int r = 0; r < runCount; r++) {
+            int* runBounds = bounds + r * (runCount + 1);
+            runBounds[0] = 0;
+            runBounds[runCount] = runTasks[r].count;
+            for (int p = 1; p < runCount; p++) {
+                const void* splitter = samples[p * sampleCount / runCount].data;
+                runBounds[p] = lowerBoundItems(runTasks[r].items, runTasks[r].count, splitter, compare);
+            }
+        }
+
+        // Phase 3: merge every output partition from all runs concurrently
+        MergeTask mergeTasks[listSortMaxThreads];
+        int outputOffset = 0;
+        for (int p = 0; p < runCount; p++) {
+            mergeTasks[p].runCount = runCount;
+            mergeTasks[p].compare = compare;
+            mergeTasks[p].output = merged + outputOffset;
+            for (int r = 0; r < runCount; r++) {
+                int* runBounds = bounds + r * (runCount + 1);
+                mergeTasks[p].sources[r] = runTasks[r].items + runBounds[p];
+                mergeTasks[p].lengths[r] = runBounds[p + 1] - runBounds[p];
+                outputOffset += mergeTasks[p].lengths[r];
+            }
+        }
+        runTasksInParallel(mergePartitionThread, mergeTasks, sizeof(MergeTask), runCount);
+
+        applySortItems(l, merged);
+    } else {
+        fprintf(stderr, "Memory allocation failed\n");
+    }
+
+    free(items);
+    free(merged);
+    free(bounds);
+    free(samples);
+    return result;
+}
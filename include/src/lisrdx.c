@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "../headers/list.h"
+
+/**
+ * @brief Computes the packed size of a set of sort keys.
+ * @param keys The key fields.
+ * @param keyCount The number of key fields.
+ * @return The packed key size in bytes, or -1 if a key is invalid or the keys are too long.
+ */
+int packedSortKeySize(const SortKey* keys, int keyCount) {
+    int total = 0;
+    for (int k = 0; k < keyCount; k++) {
+        if (keys[k].type == SORT_KEY_STRING && keys[k].length > 0) {
+            total += keys[k].length;
+        } else if (keys[k].type == SORT_KEY_FLOAT || keys[k].type == SORT_KEY_INT) {
+            total += (int)sizeof(uint32_t);
+        } else {
+            return -1;
+        }
+        if (total > listSortMaxKeyBytes) {
+            return -1;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Writes a record's key fields as one byte string that compares like the fields.
+ * @param record The record to read the fields from.
+ * @param keys The key fields, most significant first.
+ * @param keyCount The number of key fields.
+ * @param out The destination of the packed key.
+ */
+void packSortKey(const void* record, const SortKey* keys, int keyCount, unsigned char* out) {
+    for (int k = 0; k < keyCount; k++) {
+        const unsigned char* field = (const unsigned char*)record + keys[k].offset;
+        unsigned char invert = keys[k].descending ? 0xFF : 0x00;
+
+        if (keys[k].type == SORT_KEY_STRING) {
+            // Bytes after the terminator are ignored by strcmp, so they pack as 0
+            bool ended = false;
+            for (int i = 0; i < keys[k].length; i++) {
+                unsigned char c = ended ? 0 : field[i];
+                ended = (c == 0);
+                *out++ = c ^ invert;
+            }
+        } else {
+            uint32_t bits;
+            if (keys[k].type == SORT_KEY_INT) {
+                int value;
+                memcpy(&value, field, sizeof(value));
+                bits = (uint32_t)value ^ 0x80000000u; // Negative values below positive ones
+            } else {
+                float value;
+                memcpy(&value, field, sizeof(value));
+                if (value == 0.0f) {
+                    value = 0.0f; // -0.0 and 0.0 compare equal
+                }
+                memcpy(&bits, &value, sizeof(bits));
+
+                // Negative floats order reversed by magnitude; flipping all their bits fixes that,
+                // and setting the sign bit of the others puts them above every negative value
+                bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+            if (keys[k].descending) {
+                bits = ~bits;
+            }
+            *out++ = (unsigned char)(bits >> 24);
+            *out++ = (unsigned char)(bits >> 16);
+            *out++ = (unsigned char)(bits >> 8);
+            *out++ = (unsigned char)bits;
+        }
+    }
+}
+
+/**
+ * @brief Radix sorts an array of items by key fields of their data.
+ * @param items The items to sort.
+ * @param count The number of items.
+ * @param keys The key fields, most significant first.
+ * @param keyCount The number of key fields.
+ * @return Returns 0 on success, -1 on invalid keys or memory allocation failure.
+ */
+int sortItemsByKeys(SortItem* items, int count, const SortKey* keys, int keyCount) {
+    if (items == NULL || keys == NULL || keyCount <= 0) {
+        return -1;
+    }
+    int keyBytes = packedSortKeySize(keys, keyCount);
+    if (keyBytes < 0) {
+        return -1;
+    }
+    if (count <= 1) {
+        return 0;
+    }
+
+    // Each entry is the packed key followed by the item's original position
+    size_t stride = ((size_t)keyBytes + sizeof(uint32_t) + 7) & ~(size_t)7;
+    SortItem* original = (SortItem*)malloc((size_t)count * sizeof(SortItem));
+    unsigned char* entries = (unsigned char*)malloc((size_t)count * stride);
+    unsigned char* scratch = (unsigned char*)malloc((size_t)count * stride);
+    size_t (*histograms)[256] = calloc((size_t)keyBytes, sizeof(*histograms));
+    if (!original || !entries || !scratch || !histograms) {
+        free(original);
+        free(entries);
+        free(scratch);
+        free(histograms);
+        return -1;
+    }
+    memcpy(original, items, (size_t)count * sizeof(SortItem));
+
+    // Pack the keys and count every byte position in the same pass
+    for (int i = 0; i < count; i++) {
+        unsigned char* entry = entries + (size_t)i * stride;
+        uint32_t position = (uint32_t)i;
+        packSortKey(items[i].data, keys, keyCount, entry);
+        memcpy(entry + keyBytes, &position, sizeof(position));
+        for (int b = 0; b < keyBytes; b++) {
+            histograms[b][entry[b]]++;
+        }
+    }
+
+    // Stable counting sort on each byte, least significant first
+    for (int b = keyBytes - 1; b >= 0; b--) {
+        size_t* counts = histograms[b];
+        if (counts[entries[b]] == (size_t)count) {
+            continue; // Every key holds the same byte here
+        }
+
+        size_t offset = 0;
+        for (int value = 0; value < 256; value++) {
+            size_t bucket = counts[value];
+            counts[value] = offset;
+            offset += bucket;
+        }
+        for (int i = 0; i < count; i++) {
+            const unsigned char* entry = entries + (size_t)i * stride;
+            memcpy(scratch + counts[entry[b]]++ * stride, entry, stride);
+        }
+
+        unsigned char* swap = entries;
+        entries = scratch;
+        scratch = swap;
+    }
+
+    for (int i = 0; i < count; i++) {
+        uint32_t position;
+        memcpy(&position, entries + (size_t)i * stride + keyBytes, sizeof(position));
+        items[i] = original[position];
+    }
+
+    free(original);
+    free(entries);
+    free(scratch);
+    free(histograms);
+    return 0;
+}
+
+/**
+ * @brief Sorts a list by key fields with an LSD radix sort over packed keys.
+ * @param l A pointer to the list structure.
+ * @param keys The key fields, most significant first.
+ * @param keyCount The number of key fields.
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int sortListByKeys(list* l, const SortKey* keys, int keyCount) {
+    if (l == NULL || keys == NULL || keyCount <= 0 || packedSortKeySize(keys, keyCount) < 0) {
+        return -1;
+    }
+    if (l->size <= 1) {
+        return 0;
+    }
+
+    SortItem* items = gatherSortItems(l);
+    if (!items || sortItemsByKeys(items, l->size, keys, keyCount) != 0) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(items);
+        return -1;
+    }
+
+    applySortItems(l, items);
+    free(items);
+    return 0;
+}
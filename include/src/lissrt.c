@@ -0,0 +1,405 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../headers/list.h"
+
+/**
+ * @brief Returns the recursion depth after which introsort switches to heap sort.
+ * @param count The number of items being sorted.
+ * @return Twice the base-2 logarithm of count.
+ */
+static int introSortDepthLimit(int count) {
+    int depth = 0;
+    while (count > 1) {
+        count >>= 1;
+        depth++;
+    }
+    return depth * 2;
+}
+
+/**
+ * @brief Sorts a small range of items in place by insertion.
+ * @param items The items to sort.
+ * @param low The first index of the range.
+ * @param high One past the last index of the range.
+ * @param compare The comparator applied to the items' data.
+ */
+static void insertionSortItems(SortItem* items, int low, int high, int (*compare)(const void*, const void*)) {
+    for (int i = low + 1; i < high; i++) {
+        SortItem current = items[i];
+        int j = i - 1;
+        // Strictly greater keeps equal items in their original order
+        while (j >= low && compare(items[j].data, current.data) > 0) {
+            items[j + 1] = items[j];
+            j--;
+        }
+        items[j + 1] = current;
+    }
+}
+
+/**
+ * @brief Restores the max-heap property below a position of a heap.
+ * @param items The first item of the heap.
+ * @param root The position to sift down from.
+ * @param count The number of items in the heap.
+ * @param compare The comparator applied to the items' data.
+ */
+static void siftDownItems(SortItem* items, int root, int count, int (*compare)(const void*, const void*)) {
+    SortItem value = items[root];
+    while (2 * root + 1 < count) {
+        int child = 2 * root + 1;
+        if (child + 1 < count && compare(items[child].data, items[child + 1].data) < 0) {
+            child++;
+        }
+        if (compare(value.data, items[child].data) >= 0) {
+            break;
+        }
+        items[root] = items[child];
+        root = child;
+    }
+    items[root] = value;
+}
+
+/**
+ * @brief Heap sorts a range of items; used by introsort when partitioning degrades.
+ * @param items The items to sort.
+ * @param low The first index of the range.
+ * @param high One past the last index of the range.
+ * @param compare The comparator applied to the items' data.
+ */
+static void heapSortItems(SortItem* items, int low, int high, int (*compare)(const void*, const void*)) {
+    SortItem* heap = items + low;
+    int count = high - low;
+    for (int i = count / 2 - 1; i >= 0; i--) {
+        siftDownItems(heap, i, count, compare);
+    }
+    for (int end = count - 1; end > 0; end--) {
+        SortItem top = heap[0];
+        heap[0] = heap[end];
+        heap[end] = top;
+        siftDownItems(heap, 0, end, compare);
+    }
+}
+
+/**
+ * @brief Introsort: median-of-three quicksort with heap sort and insertion sort fallbacks.
+ * @param items The items to sort.
+ * @param low The first index of the range.
+ * @param high One past the last index of the range.
+ * @param depth The remaining partition depth before switching to heap sort.
+ * @param compare The comparator applied to the items' data.
+ */
+static void introSortItems(SortItem* items, int low, int high, int depth, int (*compare)(const void*, const void*)) {
+    while (high - low > listSortInsertionThreshold) {
+        if (depth-- == 0) {
+            heapSortItems(items, low, high, compare);
+            return;
+        }
+
+        // Order low/mid/last so the median ends up in the middle
+        int mid = low + (high - low) / 2;
+        int last = high - 1;
+        SortItem swap;
+        if (compare(items[mid].data, items[low].data) < 0) { swap = items[mid]; items[mid] = items[low]; items[low] = swap; }
+        if (compare(items[last].data, items[mid].data) < 0) {
+            swap = items[last]; items[last] = items[mid]; items[mid] = swap;
+            if (compare(items[mid].data, items[low].data) < 0) { swap = items[mid]; items[mid] = items[low]; items[low] = swap; }
+        }
+        void* pivot = items[mid].data;
+
+        // Hoare partition; equal keys are split across both sides
+        int i = low;
+        int j = last;
+        while (i <= j) {
+            while (compare(items[i].data, pivot) < 0) i++;
+            while (compare(items[j].data, pivot) > 0) j--;
+            if (i <= j) {
+                swap = items[i]; items[i] = items[j]; items[j] = swap;
+                i++;
+                j--;
+            }
+        }
+
+        // Recurse into the smaller half and loop on the larger one to bound the stack
+        if (j + 1 - low < high - i) {
+            introSortItems(items, low, j + 1, depth, compare);
+            low = i;
+        } else {
+            introSortItems(items, i, high, depth, compare);
+            high = j + 1;
+        }
+    }
+    insertionSortItems(items, low, high, compare);
+}
+
+/**
+ * @brief Stable top-down merge sort of a range of items.
+ * @param items The items to sort.
+ * @param buffer Scratch space at least as large as items.
+ * @param low The first index of the range.
+ * @param high One past the last index of the range.
+ * @param compare The comparator applied to the items' data.
+ */
+static void mergeSortRange(SortItem* items, SortItem* buffer, int low, int high, int (*compare)(const void*, const void*)) {
+    if (high - low <= listSortInsertionThreshold) {
+        insertionSortItems(items, low, high, compare);
+        return;
+    }
+
+    // Depth-first recursion keeps small subranges (and their records) in cache
+    int mid = low + (high - low) / 2;
+    mergeSortRange(items, buffer, low, mid, compare);
+    mergeSortRange(items, buffer, mid, high, compare);
+
+    // Already in order, e.g. for presorted input
+    if (compare(items[mid - 1].data, items[mid].data) <= 0) {
+        return;
+    }
+
+    // Only the left half needs to be moved aside; the merge never overtakes the right half
+    memcpy(&buffer[low], &items[low], (size_t)(mid - low) * sizeof(SortItem));
+    int left = low;
+    int right = mid;
+    int out = low;
+    while (left < mid && right < high) {
+        // Taking from the left on ties keeps the sort stable
+        if (compare(items[right].data, buffer[left].data) < 0) {
+            items[out++] = items[right++];
+        } else {
+            items[out++] = buffer[left++];
+        }
+    }
+    while (left < mid) {
+        items[out++] = buffer[left++];
+    }
+}
+
+/**
+ * @brief Stable merge sort of an item array.
+ * @param items The items to sort.
+ * @param count The number of items.
+ * @param compare The comparator applied to the items' data.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+static int mergeSortItems(SortItem* items, int count, int (*compare)(const void*, const void*)) {
+    if (count <= listSortInsertionThreshold) {
+        insertionSortItems(items, 0, count, compare);
+        return 0;
+    }
+
+    SortItem* buffer = (SortItem*)malloc((size_t)count * sizeof(SortItem));
+    if (!buffer) {
+        return -1;
+    }
+    mergeSortRange(items, buffer, 0, count, compare);
+    free(buffer);
+    return 0;
+}
+
+/**
+ * @brief Sorts an array of items by their data pointers.
+ * @param items The items to sort.
+ * @param count The number of items.
+ * @param compare The comparator applied to the items' data.
+ * @param stable Whether items that compare equal must keep their order.
+ * @return Returns 0 on success, -1 on memory allocation failure.
+ */
+int sortItems(SortItem* items, int count, int (*compare)(const void*, const void*), bool stable) {
+    if (count <= 1) {
+        return 0;
+    }
+    if (stable) {
+        return mergeSortItems(items, count, compare);
+    }
+    introSortItems(items, 0, count, introSortDepthLimit(count), compare);
+    return 0;
+}
+
+/**
+ * @brief Copies the list's data pointers (and the nodes holding them) into an array in list order.
+ * @param l A const pointer to the list structure.
+ * @return A newly allocated array of l->size items, or NULL on memory allocation failure.
+ */
+SortItem* gatherSortItems(const list* l) {
+    SortItem* items = (SortItem*)malloc((size_t)l->size * sizeof(SortItem));
+    if (!items) {
+        return NULL;
+    }
+
+    node* current = l->head;
+    for (int i = 0; i < l->size; i++) {
+        items[i].data = current->data;
+        items[i].owner = current;
+        current = current->next;
+    }
+    return items;
+}
+
+/**
+ * @brief Puts the list into the order of a sorted item array in a single pass.
+ * @param l A pointer to the list structure.
+ * @param items The sorted items, as returned by gatherSortItems.
+ */
+void applySortItems(list* l, const SortItem* items) {
+    int count = l->size;
+
+    // Array-backed and unrolled lists must keep storage order equal to link
+    // order, so their data moves between the nodes instead
+    if (l->type == DYNAMIC_ARRAY || l->type == UNROLLED) {
+        node* current = l->head;
+        for (int i = 0; i < count; i++) {
+            current->data = items[i].data;
+            current = current->next;
+        }
+        return;
+    }
+
+    // Linked lists keep every node (and handle) with its data and are relinked once
+    for (int i = 0; i < count; i++) {
+        node* current = items[i].owner;
+        current->prev = (i > 0) ? items[i - 1].owner : NULL;
+        current->next = (i < count - 1) ? items[i + 1].owner : NULL;
+    }
+    l->head = items[0].owner;
+    l->tail = items[count - 1].owner;
+
+    if (isCircularListType(l->type)) {
+        l->tail->next = l->head;
+        l->head->prev = l->tail;
+    }
+}
+
+/**
+ * @brief Sorts any list with a comparator by sorting a contiguous array of its data pointers.
+ * @param l A pointer to the list structure.
+ * @param compare The comparator applied to the data of two nodes.
+ * @param stable Whether nodes that compare equal must keep their order.
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int sortList(list* l, int (*compare)(const void*, const void*), bool stable) {
+    if (l == NULL || compare == NULL) {
+        return -1;
+    }
+    if (l->size <= 1) {
+        return 0;
+    }
+
+    SortItem* items = gatherSortItems(l);
+    if (!items) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+
+    if (sortItems(items, l->size, compare, stable) != 0) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(items);
+        return -1;
+    }
+
+    applySortItems(l, items);
+    free(items);
+    return 0;
+}
+
+/**
+ * @brief Element kept by the top-k heap together with its list position.
+ */
+typedef struct {
+    void* data;     // Data pointer of the element
+    int position;   // Position in the list, used to rank equal elements
+} RankedItem;
+
+/**
+ * @brief Checks whether one ranked element comes after another.
+ * @param a The first element.
+ * @param b The second element.
+ * @param compare The comparator applied to the data.
+ * @return true if a ranks below b. Equal data ranks by list position.
+ */
+static bool rankedAfter(const RankedItem* a, const RankedItem* b, int (*compare)(const void*, const void*)) {
+    int order = compare(a->data, b->data);
+    return order > 0 || (order == 0 && a->position > b->position);
+}
+
+/**
+ * @brief Restores the heap below a position so the weakest element stays on top.
+ * @param heap The heap of ranked elements.
+ * @param root The position to sift down from.
+ * @param size The number of elements in the heap.
+ * @param compare The comparator applied to the data.
+ */
+static void siftDownRanked(RankedItem* heap, int root, int size, int (*compare)(const void*, const void*)) {
+    RankedItem value = heap[root];
+    while (2 * root + 1 < size) {
+        int child = 2 * root + 1;
+        if (child + 1 < size && rankedAfter(&heap[child + 1], &heap[child], compare)) {
+            child++;
+        }
+        if (!rankedAfter(&heap[child], &value, compare)) {
+            break;
+        }
+        heap[root] = heap[child];
+        root = child;
+    }
+    heap[root] = value;
+}
+
+/**
+ * @brief Finds the k first elements of a list in comparator order with a bounded heap.
+ * @param l A const pointer to the list structure.
+ * @param compare The comparator; elements that sort first are the top ones.
+ * @param filter A predicate an element must satisfy to be ranked. Can be NULL.
+ * @param k The maximum number of elements to return.
+ * @param out The array that receives up to k data pointers, best first.
+ * @return The number of elements written to out, or -1 on invalid arguments or memory allocation failure.
+ */
+int selectTopItems(const list* l, int (*compare)(const void*, const void*), bool (*filter)(const void* data),
+                   int k, void** out) {
+    if (l == NULL || compare == NULL || out == NULL || k < 0) {
+        return -1;
+    }
+    if (k > l->size) {
+        k = l->size;
+    }
+    if (k == 0) {
+        return 0;
+    }
+
+    RankedItem* heap = (RankedItem*)malloc((size_t)k * sizeof(RankedItem));
+    if (!heap) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+
+    int size = 0;
+    node* current = l->head;
+    for (int i = 0; i < l->size; i++, current = current->next) {
+        if (filter != NULL && !filter(current->data)) {
+            continue;
+        }
+        RankedItem candidate = { current->data, i };
+        if (size < k) {
+            // Sift the new element up while it ranks below its parent
+            int child = size++;
+            while (child > 0 && rankedAfter(&candidate, &heap[(child - 1) / 2], compare)) {
+                heap[child] = heap[(child - 1) / 2];
+                child = (child - 1) / 2;
+            }
+            heap[child] = candidate;
+        } else if (rankedAfter(&heap[0], &candidate, compare)) {
+            // Replaces the weakest element kept so far
+            heap[0] = candidate;
+            siftDownRanked(heap, 0, size, compare);
+        }
+    }
+
+    // Popping the weakest element to the back leaves the best one in front
+    for (int end = size - 1; end >= 0; end--) {
+        out[end] = heap[0].data;
+        heap[0] = heap[end];
+        siftDownRanked(heap, 0, end, compare);
+    }
+
+    free(heap);
+    return size;
+}
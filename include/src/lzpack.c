@@ -0,0 +1,226 @@
+#include <stdint.h>
+#include <string.h>
+#include "../headers/lzpack.h"
+
+/**
+ * @brief Reads four bytes without alignment requirements.
+ * @param bytes The bytes.
+ * @return The bytes as a 32-bit value.
+ */
+static uint32_t readWord(const unsigned char* bytes) {
+    uint32_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Hashes a 4-byte sequence into the match finder's table.
+ * @param sequence The sequence.
+ * @return The table slot.
+ */
+static uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - lzpackHashBits);
+}
+
+/**
+ * @brief Writes the extra bytes of a length that did not fit its token nibble.
+ * @param out The output position.
+ * @param end The end of the output buffer.
+ * @param length The remaining length (the full length minus 15).
+ * @return The new output position, or NULL if the buffer is full.
+ */
+static unsigned char* writeLength(unsigned char* out, const unsigned char* end, size_t length) {
+    while (length >= 255) {
+        if (out >= end) {
+            return NULL;
+        }
+        *out++ = 255;
+        length -= 255;
+    }
+    if (out >= end) {
+        return NULL;
+    }
+    *out++ = (unsigned char)length;
+    return out;
+}
+
+/**
+ * @brief Writes one sequence of literals followed by an optional match.
+ * @param out The output position.
+ * @param end The end of the output buffer.
+ * @param literals The literals.
+ * @param literalCount The number of literals.
+ * @param offset The match offset (unused if matchLength is 0).
+ * @param matchLength The match length, or 0 for the final literal-only sequence.
+ * @return The new output position, or NULL if the buffer is full.
+ */
+static unsigned char* writeSequence(unsigned char* out, const unsigned char* end, const unsigned char* literals,
+                                    size_t literalCount, size_t offset, size_t matchLength) {
+    if (out >= end) {
+        return NULL;
+    }
+    size_t matchCode = (matchLength > 0) ? matchLength - lzpackMinMatch : 0;
+    unsigned char* token = out++;
+    *token = (unsigned char)(((literalCount < 15) ? literalCount : 15) << 4 | ((matchCode < 15) ? matchCode : 15));
+
+    if (literalCount >= 15 && !(out = writeLength(out, end, literalCount - 15))) {
+        return NULL;
+    }
+    if ((size_t)(end - out) < literalCount) {
+        return NULL;
+    }
+    memcpy(out, literals, literalCount);
+    out += literalCount;
+
+    if (matchLength > 0) {
+        if (end - out < 2) {
+            return NULL;
+        }
+        *out++ = (unsigned char)(offset & 0xFFu);
+        *out++ = (unsigned char)(offset >> 8);
+        if (matchCode >= 15 && !(out = writeLength(out, end, matchCode - 15))) {
+            return NULL;
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Compresses a block.
+ * @param source The data to compress.
+ * @param sourceSize The size of the data in bytes.
+ * @param destination The buffer for the compressed data.
+ * @param capacity The size of the buffer in bytes.
+ * @return The size of the compressed data, or 0 if it does not fit.
+ */
+size_t lzpackCompress(const void* source, size_t sourceSize, void* destination, size_t capacity) {
+    const unsigned char* input = (const unsigned char*)source;
+    unsigned char* out = (unsigned char*)destination;
+    const unsigned char* outEnd = out + capacity;
+    uint32_t table[1u << lzpackHashBits]; // Position + 1 of the last sequence with each hash (0 = none)
+    memset(table, 0, sizeof(table));
+
+    size_t position = 0;
+    size_t anchor = 0; // Start of the literals not yet written
+    while (sourceSize >= lzpackMinMatch && position <= sourceSize - lzpackMinMatch) {
+        uint32_t sequence = readWord(input + position);
+        uint32_t slot = hashSequence(sequence);
+        size_t candidate = table[slot];
+        table[slot] = (uint32_t)(position + 1);
+
+        if (candidate == 0 || position - (candidate - 1) > lzpackMaxOffset ||
+            readWord(input + candidate - 1) != sequence) {
+            position++;
+            continue;
+        }
+        candidate--;
+
+        size_t length = lzpackMinMatch;
+        while (position + length < sourceSize && input[candidate + length] == input[position + length]) {
+            length++;
+        }
+        out = writeSequence(out, outEnd, input + anchor, position - anchor, position - candidate, length);
+        if (!out) {
+            return 0;
+        }
+        position += length;
+        anchor = position;
+
+        // Keep the table pointing into the region just matched
+        if (position >= 2 && position - 2 + lzpackMinMatch <= sourceSize) {
+            table[hashSequence(readWord(input + position - 2))] = (uint32_t)(position - 1);
+        }
+    }
+
+    out = writeSequence(out, outEnd, input + anchor, sourceSize - anchor, 0, 0);
+    return out ? (size_t)(out - (unsigned char*)destination) : 0;
+}
+
+/**
+ * @brief Reads the extra bytes of a length that did not fit its token nibble.
+ * @param in The input position, advanced past the length bytes.
+ * @param end The end of the input.
+ * @param length The length so far, increased by the extra bytes.
+ * @return Returns 0 on success, -1 if the input ends early.
+ */
+static int readLength(const unsigned char** in, const unsigned char* end, size_t* length) {
+    unsigned char byte;
+    do {
+        if (*in >= end) {
+            return -1;
+        }
+        byte = *(*in)++;
+        *length += byte;
+    } while (byte == 255);
+    return 0;
+}
+
+/**
+ * @brief Decompresses a block.
+ * @param source The compressed data.
+ * @param sourceSize The size of the compressed data in bytes.
+ * @param destination The buffer for the decompressed data.
+ * @param size The exact size of the decompressed data in bytes.
+ * @return Returns 0 on success, -1 if the input is corrupted or has a different size.
+ */
+int lzpackDecompress(const void* source, size_t sourceSize, void* destination, size_t size) {
+    const unsigned char* in = (const unsigned char*)source;
+    const unsigned char* inEnd = in + sourceSize;
+    unsigned char* start = (unsigned char*)destination;
+    unsigned char* out = start;
+    unsigned char* outEnd = start + size;
+
+    while (in < inEnd) {
+        unsigned char token = *in++;
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && readLength(&in, inEnd, &literalCount) != 0) {
+            return -1;
+        }
+        if ((size_t)(inEnd - in) < literalCount || (size_t)(outEnd - out) < literalCount) {
+            return -1;
+        }
+        if (literalCount <= 16 && inEnd - in >= 16 && outEnd - out >= 16) {
+            memcpy(out, in, 16); // Fixed-size copy of short literal runs; the excess is overwritten later
+        } else {
+            memcpy(out, in, literalCount);
+        }
+        in += literalCount;
+        out += literalCount;
+        if (in == inEnd) {
+            break; // The final sequence has no match
+        }
+
+        if (inEnd - in < 2) {
+            return -1;
+        }
+        size_t offset = (size_t)in[0] | ((size_t)in[1] << 8);
+        in += 2;
+        size_t length = (token & 0x0Fu);
+        if (length == 15 && readLength(&in, inEnd, &length) != 0) {
+            return -1;
+        }
+        length += lzpackMinMatch;
+        if (offset == 0 || offset > (size_t)(out - start) || (size_t)(outEnd - out) < length) {
+            return -1;
+        }
+
+        const unsigned char* match = out - offset;
+        if (offset == 1) {
+            memset(out, *match, length); // A run of one byte, typically zero padding
+        } else if (offset >= 8 && (size_t)(outEnd - out) >= length + 8) {
+            // Short matches dominate; whole words may copy a few bytes past the match,
+            // which the next sequence overwrites
+            for (size_t i = 0; i < length; i += 8) {
+                memcpy(out + i, match + i, 8);
+            }
+        } else if (offset >= length) {
+            memcpy(out, match, length);
+        } else {
+            for (size_t i = 0; i < length; i++) {
+                out[i] = match[i]; // Overlapping copy repeats the pattern
+            }
+        }
+        out += length;
+    }
+    return (out == outEnd) ? 0 : -1;
+}
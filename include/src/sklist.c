@@ -0,0 +1,306 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "../headers/sklist.h"
+
+/**
+ * @brief Orders two elements, breaking comparator ties by address.
+ * @param sl A const pointer to the skip list.
+ * @param a The first element.
+ * @param b The second element.
+ * @return Negative if a sorts before b, 0 only if a and b are the same element, positive otherwise.
+ */
+static int orderElements(const SkipList* sl, const void* a, const void* b) {
+    int result = sl->compare(a, b);
+    if (result != 0) {
+        return result;
+    }
+    uintptr_t left = (uintptr_t)a;
+    uintptr_t right = (uintptr_t)b;
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Picks the level of a new node (each extra level with probability 1/skipListPromoteChance).
+ * @param sl A pointer to the skip list whose generator state is advanced.
+ * @return A level between 1 and skipListMaxLevel.
+ */
+static int randomLevel(SkipList* sl) {
+    int level = 1;
+    while (level < skipListMaxLevel) {
+        // xorshift32
+        unsigned int x = sl->seed;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        sl->seed = x;
+        if (x % skipListPromoteChance != 0) {
+            break;
+        }
+        level++;
+    }
+    return level;
+}
+
+/**
+ * @brief Allocates a skip node with the given number of levels.
+ * @param level The number of forward links.
+ * @param data The element stored in the node.
+ * @return A pointer to the new node, or NULL on memory allocation failure.
+ */
+static SkipNode* createSkipNode(int level, void* data) {
+    SkipNode* newNode = (SkipNode*)malloc(sizeof(SkipNode) + (size_t)level * sizeof(SkipLink));
+    if (!newNode) {
+        return NULL;
+    }
+    newNode->data = data;
+    newNode->level = level;
+    for (int i = 0; i < level; i++) {
+        newNode->links[i].next = NULL;
+        newNode->links[i].span = 0;
+    }
+    return newNode;
+}
+
+/**
+ * @brief Creates an empty skip list ordered by a comparator.
+ * @param sl A double pointer to the skip list to be created.
+ * @param compare The comparator that defines the order.
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int createSkipList(SkipList** sl, SkipListCompare compare) {
+    if (sl == NULL || compare == NULL) {
+        return -1;
+    }
+
+    *sl = (SkipList*)malloc(sizeof(SkipList));
+    if (!(*sl)) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+
+    (*sl)->header = createSkipNode(skipListMaxLevel, NULL);
+    if (!(*sl)->header) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(*sl);
+        *sl = NULL;
+        return -1;
+    }
+    (*sl)->level = 1;
+    (*sl)->size = 0;
+    (*sl)->compare = compare;
+    (*sl)->seed = (unsigned int)time(NULL) | 1u; // xorshift needs a non-zero state
+    return 0;
+}
+
+/**
+ * @brief Destroys a skip list, optionally freeing the elements.
+ * @param sl A double pointer to the skip list. The pointer will be set to NULL.
+ * @param freeData A function pointer to free each element. Can be NULL.
+ */
+void destroySkipList(SkipList** sl, void (*freeData)(void* data)) {
+    if (sl == NULL || *sl == NULL) {
+        return;
+    }
+
+    SkipNode* current = (*sl)->header->links[0].next;
+    while (current != NULL) {
+        SkipNode* next = current->links[0].next;
+        if (freeData != NULL) {
+            freeData(current->data);
+        }
+        free(current);
+        current = next;
+    }
+
+    free((*sl)->header);
+    free(*sl);
+    *sl = NULL;
+}
+
+/**
+ * @brief Inserts an element at its sorted position.
+ * @param sl A pointer to the skip list.
+ * @param data The element to insert.
+ * @return Returns 0 on success, -1 on invalid arguments or memory allocation failure.
+ */
+int skipListInsert(SkipList* sl, void* data) {
+    if (sl == NULL || data == NULL) {
+        return -1;
+    }
+
+    SkipNode* update[skipListMaxLevel];
+    int rank[skipListMaxLevel];
+
+    // Find the predecessor on every level and how many elements precede it
+    SkipNode* current = sl->header;
+    for (int i = sl->level - 1; i >= 0; i--) {
+        rank[i] = (i == sl->level - 1) ? 0 : rank[i + 1];
+        while (current->links[i].next != NULL &&
+               orderElements(sl, current->links[i].next->data, data) < 0) {
+            rank[i] += current->links[i].span;
+            current = current->links[i].next;
+        }
+        update[i] = current;
+    }
+
+    int level = randomLevel(sl);
+    if (level > sl->level) {
+        for (int i = sl->level; i < level; i++) {
+            rank[i] = 0;
+            update[i] = sl->header;
+            update[i]->links[i].span = sl->size;
+        }
+        sl->level = level;
+    }
+
+    SkipNode* newNode = createSkipNode(level, data);
+    if (!newNode) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+
+    for (int i = 0; i < level; i++) {
+        newNode->links[i].next = update[i]->links[i].next;
+        update[i]->links[i].next = newNode;
+
+        // Split the predecessor's span around the new node
+        newNode->links[i].span = update[i]->links[i].span - (rank[0] - rank[i]);
+        update[i]->links[i].span = (rank[0] - rank[i]) + 1;
+    }
+
+    // Links above the new node now skip one more element
+    for (int i = level; i < sl->level; i++) {
+        update[i]->links[i].span++;
+    }
+
+    sl->size++;
+    return 0;
+}
+
+/**
+ * @brief Removes an element from the skip list.
+ * @param sl A pointer to the skip list.
+ * @param data The element to remove. The comparison is by pointer address.
+ * @return Returns 0 if the element was removed, -1 if it was not found.
+ */
+int skipListRemove(SkipList* sl, const void* data) {
+    if (sl == NULL || data == NULL) {
+        return -1;
+    }
+
+    SkipNode* update[skipListMaxLevel];
+    SkipNode* current = sl->header;
+    for (int i = sl->level - 1; i >= 0; i--) {
+        while (current->links[i].next != NULL &&
+               orderElements(sl, current->links[i].next->data, data) < 0) {
+            current = current->links[i].next;
+        }
+        update[i] = current;
+    }
+
+    SkipNode* target = current->links[0].next;
+    if (target == NULL || target->data != data) {
+        return -1;
+    }
+
+    for (int i = 0; i < sl->level; i++) {
+        if (update[i]->links[i].next == target) {
+            update[i]->links[i].span += target->links[i].span - 1;
+            update[i]->links[i].next = target->links[i].next;
+        } else {
+            update[i]->links[i].span--;
+        }
+    }
+
+    // Drop levels that no longer hold any node
+    while (sl->level > 1 && sl->header->links[sl->level - 1].next == NULL) {
+        sl->level--;
+    }
+
+    free(target);
+    sl->size--;
+    return 0;
+}
+
+/**
+ * @brief Finds the first element that compares equal to a key.
+ * @param sl A const pointer to the skip list.
+ * @param key The key, shaped like an element.
+ * @return A pointer to the matching element, or NULL if none matches.
+ */
+void* skipListFind(const SkipList* sl, const void* key) {
+    if (sl == NULL || key == NULL) {
+        return NULL;
+    }
+
+    SkipNode* current = sl->header;
+    for (int i = sl->level - 1; i >= 0; i--) {
+        while (current->links[i].next != NULL &&
+               sl->compare(current->links[i].next->data, key) < 0) {
+            current = current->links[i].next;
+        }
+    }
+
+    current = current->links[0].next;
+    if (current != NULL && sl->compare(current->data, key) == 0) {
+        return current->data;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns the element at a position in sorted order.
+ * @param sl A const pointer to the skip list.
+ * @param index The zero-based position.
+ * @return A pointer to the element, or NULL if the index is out of bounds.
+ */
+void* skipListGet(const SkipList* sl, int index) {
+    if (sl == NULL || index < 0 || index >= sl->size) {
+        return NULL;
+    }
+
+    // Spans are counted in elements, so the target sits at distance index + 1 from the header
+    int target = index + 1;
+    int traversed = 0;
+    SkipNode* current = sl->header;
+    for (int i = sl->level - 1; i >= 0; i--) {
+        while (current->links[i].next != NULL && traversed + current->links[i].span <= target) {
+            traversed += current->links[i].span;
+            current = current->links[i].next;
+        }
+        if (traversed == target) {
+            return current->data;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Returns the first node in sorted order.
+ * @param sl A const pointer to the skip list.
+ * @return A pointer to the first node, or NULL if the list is empty.
+ */
+SkipNode* skipListFirst(const SkipList* sl) {
+    return (sl != NULL) ? sl->header->links[0].next : NULL;
+}
+
+/**
+ * @brief Writes the sorted order of the skip list into the nodes of a list.
+ * @param sl A const pointer to the skip list.
+ * @param l A pointer to the list holding the same elements.
+ * @return Returns 0 on success, -1 if the arguments are invalid or the sizes differ.
+ */
+int skipListApplyOrder(const SkipList* sl, list* l) {
+    if (sl == NULL || l == NULL || sl->size != l->size) {
+        return -1;
+    }
+
+    node* current = l->head;
+    for (SkipNode* ordered = skipListFirst(sl); ordered != NULL; ordered = ordered->links[0].next) {
+        current->data = ordered->data;
+        current = current->next;
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include "../headers/apctxt.h"
 #include "../headers/apclrs.h"
 #include <ctype.h>
+#include <stdarg.h>
 
 // Forward declaration for internal helper function
 static const char* extractFieldName(const char* prompt);
@@ -100,21 +101,130 @@ static const char* extractFieldName(const char* prompt) {
 }
 
 /**
- * @brief Validates an input string against a specified validation type and parameters.
+ * @brief Powers of ten that are exact as doubles, for parseDecimal.
+ */
+static const double exactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Parses a decimal number without depending on the C locale.
+ * @param text The text to parse.
+ * @param value Receives the number.
+ * @return Returns true if the whole text is a decimal number, false otherwise.
+ */
+bool parseDecimal(const char* text, double* value) {
+    const char* p = text;
+    bool negative = false;
+    if (*p == '+' || *p == '-') {
+        negative = (*p++ == '-');
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;     // Significant digits kept in the mantissa
+    int exponent = 0;   // Power of ten the mantissa is scaled by
+    bool anyDigits = false;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        anyDigits = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits += (mantissa != 0);
+        } else {
+            exponent++; // Digits past the 19th only scale the value
+        }
+    }
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++) {
+            anyDigits = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                digits += (mantissa != 0);
+                exponent--;
+            }
+        }
+    }
+    if (!anyDigits) {
+        return false;
+    }
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        bool negativeExponent = false;
+        if (*p == '+' || *p == '-') {
+            negativeExponent = (*p++ == '-');
+        }
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+        int written = 0;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            if (written < 10000) {
+                written = written * 10 + (*p - '0');
+            }
+        }
+        exponent += negativeExponent ? -written : written;
+    }
+    if (*p != '\0') {
+        return false;
+    }
+
+    // One multiplication or division by an exact power is correctly rounded
+    // whenever the mantissa is exact too, which covers every ordinary input
+    double result = (double)mantissa;
+    if (mantissa != 0) {
+        if (exponent >= 0 && exponent <= 22 && mantissa <= (1ULL << 53)) {
+            result *= exactPowersOfTen[exponent];
+        } else if (exponent < 0 && exponent >= -22 && mantissa <= (1ULL << 53)) {
+            result /= exactPowersOfTen[-exponent];
+        } else {
+            for (; exponent > 22; exponent -= 22) {
+                result *= 1e22;
+            }
+            for (; exponent < -22; exponent += 22) {
+                result /= 1e22;
+            }
+            result = (exponent >= 0) ? result * exactPowersOfTen[exponent] : result / exactPowersOfTen[-exponent];
+        }
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+/**
+ * @brief Writes the reason an input is invalid, if the caller wants it.
+ * @param message The message buffer, or NULL.
+ * @param messageSize The size of the message buffer.
+ * @param format The printf-style format of the reason.
+ */
+static void describeInvalidInput(char* message, size_t messageSize, const char* format, ...) {
+    if (!message || messageSize == 0) {
+        return;
+    }
+    va_list arguments;
+    va_start(arguments, format);
+    vsnprintf(message, messageSize, format, arguments);
+    va_end(arguments);
+}
+
+/**
+ * @brief Checks an input string against a validation type and parameters without printing.
  * @param input The input string to validate.
  * @param type The type of validation to perform (e.g., integer range, choice from a list).
  * @param params A union containing the specific parameters for the validation type.
  * @param fieldName The name of the field being validated for specific error messages.
+ * @param message Receives the reason if the input is invalid, or NULL.
+ * @param messageSize The size of the message buffer.
  * @return Returns true if the input is valid, false otherwise.
  */
-bool isValid(const char* input, IValidationType type, IValidationParams params, const char* fieldName) {
+bool validateInput(const char* input, IValidationType type, IValidationParams params, const char* fieldName,
+                   char* message, size_t messageSize) {
     // Special cases: IV_OPTIONAL and IV_OPTIONAL_ALPHA_ONLY_MAX_LEN allow empty input
     if ((type == IV_OPTIONAL || type == IV_OPTIONAL_ALPHA_ONLY_MAX_LEN) && input[0] == '\0') {
         return true;
     }
     
     if (input[0] == '\0') {
-        printf("%s   [Error] %s cannot be empty. Please enter a value.%s\n", UI_ERROR, fieldName, TXT_RESET);
+        describeInvalidInput(message, messageSize, "%s cannot be empty. Please enter a value.", fieldName);
         return false;
     }
 
@@ -125,23 +235,23 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
 
         case IV_MAX_LEN:
             if (strlen(input) > (size_t)params.rangeInt.max) {
-                printf("%s   [Error] %s cannot exceed %ld characters. Current length: %zu%s\n", 
-                       UI_ERROR, fieldName, params.rangeInt.max, strlen(input), TXT_RESET);
+                describeInvalidInput(message, messageSize, "%s cannot exceed %ld characters. Current length: %zu", 
+                                     fieldName, params.rangeInt.max, strlen(input));
                 return false;
             }
             return true; 
 
         case IV_EXACT_LEN:
             if (strlen(input) != (size_t)params.rangeInt.max) {
-                printf("%s   [Error] %s must be exactly %ld characters. Current length: %zu%s\n", 
-                       UI_ERROR, fieldName, params.rangeInt.max, strlen(input), TXT_RESET);
+                describeInvalidInput(message, messageSize, "%s must be exactly %ld characters. Current length: %zu", 
+                                     fieldName, params.rangeInt.max, strlen(input));
                 return false;
             }
             /* Additional check: all characters must be numeric digits (0-9) */
-            for (size_t i = 0; i < strlen(input); i++) {
+            for (size_t i = 0; input[i] != '\0'; i++) {
                 if (input[i] < '0' || input[i] > '9') {
-                    printf("%s   [Error] %s must contain only digits (0-9). Invalid character: '%c'%s\n", 
-                           UI_ERROR, fieldName, input[i], TXT_RESET);
+                    describeInvalidInput(message, messageSize, "%s must contain only digits (0-9). Invalid character: '%c'", 
+                                         fieldName, input[i]);
                     return false;
                 }
             }
@@ -153,29 +263,26 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
                     return true;
                 }
             }
-            printf("%s   [Error] Invalid %s '%s'. Valid options are: %s", 
-                   UI_ERROR, fieldName, input, UI_WARNING);
-            for (int i = 0; i < params.choices.count; i++) {
-                printf("%s", params.choices.choices[i]);
-                if (i < params.choices.count - 1) {
-                    printf(", ");
+            if (message && messageSize > 0) {
+                int length = snprintf(message, messageSize, "Invalid %s '%s'. Valid options are: ", fieldName, input);
+                for (int i = 0; i < params.choices.count && length >= 0 && (size_t)length < messageSize; i++) {
+                    length += snprintf(message + length, messageSize - length, "%s%s", params.choices.choices[i],
+                                       (i < params.choices.count - 1) ? ", " : "");
                 }
             }
-            printf("%s\n", TXT_RESET);
             return false;
 
         case IV_RANGE_FLT:
             {
-                char* end;
-                double val = strtod(input, &end);
-                if (end == input || *end != '\0') {
-                    printf("%s   [Error] %s must be a valid decimal number. '%s' is not a valid format.%s\n", 
-                           UI_ERROR, fieldName, input, TXT_RESET);
+                double val;
+                if (!parseDecimal(input, &val)) {
+                    describeInvalidInput(message, messageSize, "%s must be a valid decimal number. '%s' is not a valid format.", 
+                                         fieldName, input);
                     return false;
                 }
                 if (val < params.rangeFloat.min || val > params.rangeFloat.max) {
-                    printf("%s   [Error] %s must be between %.2f and %.2f. You entered: %.2f%s\n", 
-                           UI_ERROR, fieldName, params.rangeFloat.min, params.rangeFloat.max, val, TXT_RESET);
+                    describeInvalidInput(message, messageSize, "%s must be between %.2f and %.2f. You entered: %.2f", 
+                                         fieldName, params.rangeFloat.min, params.rangeFloat.max, val);
                     return false;
                 }
                 return true;
@@ -186,13 +293,13 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
                 char* end;
                 long val = strtol(input, &end, 10);
                 if (end == input || *end != '\0') {
-                    printf("%s   [Error] %s must be a valid whole number. '%s' is not a valid format.%s\n", 
-                           UI_ERROR, fieldName, input, TXT_RESET);
+                    describeInvalidInput(message, messageSize, "%s must be a valid whole number. '%s' is not a valid format.", 
+                                         fieldName, input);
                     return false;
                 }
                 if (val < params.rangeInt.min || val > params.rangeInt.max) {
-                    printf("%s   [Error] %s must be between %ld and %ld. You entered: %ld%s\n", 
-                           UI_ERROR, fieldName, params.rangeInt.min, params.rangeInt.max, val, TXT_RESET);
+                    describeInvalidInput(message, messageSize, "%s must be between %ld and %ld. You entered: %ld", 
+                                         fieldName, params.rangeInt.min, params.rangeInt.max, val);
                     return false;
                 }
                 return true;
@@ -200,8 +307,8 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
             
         case IV_MAX_LEN_CHARS:
             if (strlen(input) > (size_t)params.maxLengthChars.maxLength) {
-                printf("%s   [Error] %s cannot exceed %d characters. Current length: %zu%s\n", 
-                       UI_ERROR, fieldName, params.maxLengthChars.maxLength, strlen(input), TXT_RESET);
+                describeInvalidInput(message, messageSize, "%s cannot exceed %d characters. Current length: %zu", 
+                                     fieldName, params.maxLengthChars.maxLength, strlen(input));
                 return false;
             }
             return true;
@@ -212,8 +319,8 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
                     char c = input[i];
                     // Allow only alphabetic characters and spaces
                     if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == ' ')) {
-                        printf("%s   [Error] %s can only contain letters and spaces. Invalid character: '%c'%s\n", 
-                               UI_ERROR, fieldName, c, TXT_RESET);
+                        describeInvalidInput(message, messageSize, "%s can only contain letters and spaces. Invalid character: '%c'", 
+                                             fieldName, c);
                         return false;
                     }
                 }
@@ -221,11 +328,13 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
             }
             
         case IV_ALPHA_ONLY_MAX_LEN:
+        case IV_OPTIONAL_ALPHA_ONLY_MAX_LEN:
             {
+                // Empty optional input was already accepted at the beginning of the function
                 // First check length
                 if (strlen(input) > (size_t)params.maxLengthChars.maxLength) {
-                    printf("%s   [Error] %s cannot exceed %d characters. Current length: %zu%s\n", 
-                           UI_ERROR, fieldName, params.maxLengthChars.maxLength, strlen(input), TXT_RESET);
+                    describeInvalidInput(message, messageSize, "%s cannot exceed %d characters. Current length: %zu", 
+                                         fieldName, params.maxLengthChars.maxLength, strlen(input));
                     return false;
                 }
                 
@@ -234,8 +343,8 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
                     char c = input[i];
                     // Allow only alphabetic characters and spaces
                     if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == ' ')) {
-                        printf("%s   [Error] %s can only contain letters and spaces. Invalid character: '%c'%s\n", 
-                               UI_ERROR, fieldName, c, TXT_RESET);
+                        describeInvalidInput(message, messageSize, "%s can only contain letters and spaces. Invalid character: '%c'", 
+                                             fieldName, c);
                         return false;
                     }
                 }
@@ -245,8 +354,8 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
             {
                 // First check length
                 if (strlen(input) > (size_t)params.maxLengthChars.maxLength) {
-                    printf("%s   [Error] %s cannot exceed %d characters. Current length: %zu%s\n", 
-                           UI_ERROR, fieldName, params.maxLengthChars.maxLength, strlen(input), TXT_RESET);
+                    describeInvalidInput(message, messageSize, "%s cannot exceed %d characters. Current length: %zu", 
+                                         fieldName, params.maxLengthChars.maxLength, strlen(input));
                     return false;
                 }
 
@@ -254,31 +363,8 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
                 for (int i = 0; input[i] != '\0'; i++) {
                     char c = input[i];
                     if (!( (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == ' ')) {
-                        printf("%s   [Error] %s can only contain letters, numbers and spaces. Invalid character: '%c'%s\n", 
-                               UI_ERROR, fieldName, c, TXT_RESET);
-                        return false;
-                    }
-                }
-                return true;
-            }
-              case IV_OPTIONAL_ALPHA_ONLY_MAX_LEN:
-            {
-                // Empty input was already checked at the beginning of the function
-                // Validate as alphabetic with max length
-                // First check length
-                if (strlen(input) > (size_t)params.maxLengthChars.maxLength) {
-                    printf("%s   [Error] %s cannot exceed %d characters. Current length: %zu%s\n", 
-                           UI_ERROR, fieldName, params.maxLengthChars.maxLength, strlen(input), TXT_RESET);
-                    return false;
-                }
-                
-                // Then check alphabetic characters only
-                for (int i = 0; input[i] != '\0'; i++) {
-                    char c = input[i];
-                    // Allow only alphabetic characters and spaces
-                    if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == ' ')) {
-                        printf("%s   [Error] %s can only contain letters and spaces. Invalid character: '%c'%s\n", 
-                               UI_ERROR, fieldName, c, TXT_RESET);
+                        describeInvalidInput(message, messageSize, "%s can only contain letters, numbers and spaces. Invalid character: '%c'", 
+                                             fieldName, c);
                         return false;
                     }
                 }
@@ -290,6 +376,23 @@ bool isValid(const char* input, IValidationType type, IValidationParams params,
     }
 }
 
+/**
+ * @brief Validates an input string against a specified validation type and parameters.
+ * @param input The input string to validate.
+ * @param type The type of validation to perform (e.g., integer range, choice from a list).
+ * @param params A union containing the specific parameters for the validation type.
+ * @param fieldName The name of the field being validated for specific error messages.
+ * @return Returns true if the input is valid, false otherwise.
+ */
+bool isValid(const char* input, IValidationType type, IValidationParams params, const char* fieldName) {
+    char message[512];
+    if (validateInput(input, type, params, fieldName, message, sizeof(message))) {
+        return true;
+    }
+    printf("%s   [Error] %s%s\n", UI_ERROR, message, TXT_RESET);
+    return false;
+}
+
 /**
  * @brief Prompts the user for input for a series of form fields and validates the input for each.
  * @param fields An array of appFormField structs, each defining a prompt and validation criteria.
@@ -69,7 +69,7 @@ static const char* getConfigPath(void) {
  * 2. Initializes the Windows terminal with a custom title
  * 3. Sets up the console interface system
  * 4. Initializes the data management systems (lists, courses)
- * 5. Loads program definitions from configuration
+ * 5. Loads program definitions from configuration (and the startup session, if enabled)
  * 6. Sets up the main menu structure
  * 7. Starts the main application loop
  * 8. Performs cleanup when the application exits
@@ -94,6 +94,11 @@ int main(void)
     int programCount = loadProgramsFromConfig();
     printf("Loaded %d program(s) from configuration.\n", programCount);
     
+    // Load every saved list at once if startup_session is enabled
+    if (isStartupSessionEnabled()) {
+        loadStartupSession();
+    }
+    
     // Step 5: Initialize application metadata
     AppConfig appConfig = {
         "PUP Information Management System",  // Application name
@@ -110,7 +115,8 @@ int main(void)
         {'3', "Course Management", "Create and manage course catalogs and schedules", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'4', "System Information", "View system information and application details", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'5', "Configuration Settings", "Modify system configuration and settings", false, false, 9, 0, 7, 0, 8, 0, NULL},
-        {'6', "Exit", "Close the application and return to system", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 6
+        {'6', "Load Session", "Load several saved employee and student lists at once", false, false, 9, 0, 7, 0, 8, 0, NULL},
+        {'7', "Exit", "Close the application and return to system", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 7
     };
     
     // Step 7: Start the main application loop
@@ -0,0 +1,258 @@
+/**
+ * @file autosave.c
+ * @brief Background Autosave of Modified Lists
+ *
+ * This file implements the autosave writer: a queue of list snapshots
+ * guarded by a mutex and a single pthread that writes them with
+ * writeDataFileRecords(). Snapshots are flat copies of the records, so
+ * the writer never touches a list that the menus may be changing.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For file paths and remove
+#include <stdlib.h>     // For memory allocation and general utilities
+#include <string.h>     // For memcpy and strcmp
+#include <stdbool.h>    // For boolean data type support
+#include <stdint.h>     // For the record type
+#include <stddef.h>     // For offsetof
+#include <pthread.h>    // For the writer thread
+
+// Application-specific includes
+#include "autosave.h"                           // Autosave module header
+#include "../../include/headers/apctxt.h"      // For the autosave settings and appCreateDirectory
+#include "../../include/headers/datfile.h"     // For writing snapshots as data files
+#include "../../include/models/employee.h"     // Employee record size
+#include "../../include/models/student.h"      // Student record size
+
+/**
+ * @brief Snapshot of one list waiting to be written
+ */
+typedef struct AutosaveJob {
+    char path[300];             // Path of the autosave file
+    unsigned char* records;     // Copy of the records, one after another
+    size_t bufferSize;          // Size of the records buffer in bytes
+    size_t count;               // Number of records
+    uint32_t recordType;        // Data file record type
+    size_t recordSize;          // Size of one record in bytes
+    DataFileKey key;            // Record number field, indexed like in an explicit save
+    struct AutosaveJob* next;   // Next job in the queue
+} AutosaveJob;
+
+static pthread_t autosaveThread;
+static pthread_mutex_t autosaveLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t autosaveWake = PTHREAD_COND_INITIALIZER;
+static AutosaveJob* autosaveQueue = NULL;   // Jobs in the order they were queued
+static bool autosaveRunning = false;        // The writer thread was started
+static bool autosaveStopping = false;       // The writer exits once the queue is empty
+static char autosaveWritingPath[300] = "";  // Autosave file being written, if any
+static bool autosaveDiscardWriting = false; // Delete that file once it is written
+static unsigned char* autosaveSpare = NULL; // Buffer of the last written snapshot, for reuse
+static size_t autosaveSpareSize = 0;        // Size of the spare buffer in bytes
+
+/**
+ * @brief Builds the path of a list's autosave file.
+ * @param listName The name of the list.
+ * @param dataType The data type ("employee" or "student").
+ * @param path Receives the path.
+ * @param size The size of the path buffer.
+ */
+static void getAutosavePath(const char* listName, const char* dataType, char* path, size_t size) {
+    snprintf(path, size, "data/%s_%s_autosave.dat", dataType, listName);
+}
+
+/**
+ * @brief Writes queued snapshots until the writer is stopped.
+ * @param argument Unused.
+ * @return Always NULL.
+ */
+static void* autosaveWriter(void* argument) {
+    (void)argument;
+    pthread_mutex_lock(&autosaveLock);
+    while (true) {
+        while (!autosaveQueue && !autosaveStopping) {
+            pthread_cond_wait(&autosaveWake, &autosaveLock);
+        }
+        if (!autosaveQueue) {
+            break; // Stopping and nothing left to write
+        }
+        AutosaveJob* job = autosaveQueue;
+        autosaveQueue = job->next;
+        snprintf(autosaveWritingPath, sizeof(autosaveWritingPath), "%s", job->path);
+        pthread_mutex_unlock(&autosaveLock);
+
+        // The disk I/O happens outside the lock so the menus can keep queueing
+        writeDataFileRecords(job->records, job->count, job->path, job->recordType, job->recordSize, &job->key);
+
+        pthread_mutex_lock(&autosaveLock);
+        if (autosaveDiscardWriting) {
+            remove(job->path); // The list was saved explicitly while this was written
+            autosaveDiscardWriting = false;
+        }
+        autosaveWritingPath[0] = '\0';
+        
+        // Keep the larger buffer: writing into pages that are already mapped
+        // makes the next snapshot several times cheaper than a fresh allocation
+        if (job->bufferSize > autosaveSpareSize) {
+            free(autosaveSpare);
+            autosaveSpare = job->records;
+            autosaveSpareSize = job->bufferSize;
+        } else {
+            free(job->records);
+        }
+        free(job);
+    }
+    pthread_mutex_unlock(&autosaveLock);
+    return NULL;
+}
+
+/**
+ * @brief Starts the background autosave writer.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int startAutosave(void) {
+    if (autosaveRunning || getAutosaveInterval() <= 0) {
+        return 0;
+    }
+
+    autosaveStopping = false;
+    if (pthread_create(&autosaveThread, NULL, autosaveWriter, NULL) != 0) {
+        return -1;
+    }
+    autosaveRunning = true;
+    return 0;
+}
+
+/**
+ * @brief Writes all queued snapshots and stops the writer.
+ */
+void stopAutosave(void) {
+    if (!autosaveRunning) {
+        return;
+    }
+    pthread_mutex_lock(&autosaveLock);
+    autosaveStopping = true;
+    pthread_cond_signal(&autosaveWake);
+    pthread_mutex_unlock(&autosaveLock);
+
+    pthread_join(autosaveThread, NULL);
+    autosaveRunning = false;
+    
+    free(autosaveSpare);
+    autosaveSpare = NULL;
+    autosaveSpareSize = 0;
+}
+
+/**
+ * @brief Snapshots a list and queues it for writing in the background.
+ * @param dataList The list to snapshot.
+ * @param listName The name of the list.
+ * @param dataType The data type ("employee" or "student").
+ * @return Returns 0 if the snapshot was queued, -1 on failure.
+ */
+int autosaveList(const list* dataList, const char* listName, const char* dataType) {
+    if (!autosaveRunning || !dataList || !listName || !dataType) {
+        return -1;
+    }
+
+    AutosaveJob* job = (AutosaveJob*)calloc(1, sizeof(AutosaveJob));
+    if (!job) {
+        return -1;
+    }
+    if (strcmp(dataType, "employee") == 0) {
+        job->recordType = dataFileEmployees;
+        job->recordSize = sizeof(Employee);
+        job->key.offset = offsetof(Employee, personal.employeeNumber);
+        job->key.length = employeeNumberLen;
+    } else if (strcmp(dataType, "student") == 0) {
+        job->recordType = dataFileStudents;
+        job->recordSize = sizeof(Student);
+        job->key.offset = offsetof(Student, personal.studentNumber);
+        job->key.length = studentNumberLen;
+    } else {
+        free(job);
+        return -1;
+    }
+    if (isCompressionEnabled()) {
+        job->recordType |= dataFileCompressed; // Compressed on the writer thread, off the menus' time
+    }
+    getAutosavePath(listName, dataType, job->path, sizeof(job->path));
+
+    // One flat copy of the records is all the menus pay for
+    size_t capacity = (dataList->size > 0) ? (size_t)dataList->size : 0;
+    job->bufferSize = capacity * job->recordSize + 1;
+    pthread_mutex_lock(&autosaveLock);
+    if (autosaveSpare && autosaveSpareSize >= job->bufferSize) {
+        job->records = autosaveSpare;
+        job->bufferSize = autosaveSpareSize;
+        autosaveSpare = NULL;
+        autosaveSpareSize = 0;
+    }
+    pthread_mutex_unlock(&autosaveLock);
+    if (!job->records) {
+        job->records = (unsigned char*)malloc(job->bufferSize);
+    }
+    if (!job->records) {
+        free(job);
+        return -1;
+    }
+    node* current = dataList->head;
+    for (size_t i = 0; i < capacity; i++, current = current->next) {
+        if (current->data) {
+            memcpy(job->records + job->count * job->recordSize, current->data, job->recordSize);
+            job->count++;
+        }
+    }
+    appCreateDirectory("data");
+
+    pthread_mutex_lock(&autosaveLock);
+    AutosaveJob** link = &autosaveQueue;
+    while (*link && strcmp((*link)->path, job->path) != 0) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        // Replace the older snapshot that is still waiting
+        AutosaveJob* stale = *link;
+        job->next = stale->next;
+        *link = job;
+        free(stale->records);
+        free(stale);
+    } else {
+        *link = job;
+    }
+    pthread_cond_signal(&autosaveWake);
+    pthread_mutex_unlock(&autosaveLock);
+    return 0;
+}
+
+/**
+ * @brief Drops the queued snapshot of a list and deletes its autosave file.
+ * @param listName The name of the list.
+ * @param dataType The data type ("employee" or "student").
+ */
+void discardAutosave(const char* listName, const char* dataType) {
+    if (!listName || !dataType) {
+        return;
+    }
+    char path[300];
+    getAutosavePath(listName, dataType, path, sizeof(path));
+
+    pthread_mutex_lock(&autosaveLock);
+    for (AutosaveJob** link = &autosaveQueue; *link; link = &(*link)->next) {
+        if (strcmp((*link)->path, path) == 0) {
+            AutosaveJob* job = *link;
+            *link = job->next;
+            free(job->records);
+            free(job);
+            break;
+        }
+    }
+    if (strcmp(autosaveWritingPath, path) == 0) {
+        autosaveDiscardWriting = true;
+    }
+    pthread_mutex_unlock(&autosaveLock);
+    remove(path);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file autosave.h
+ * @brief Background Autosave Module Header
+ *
+ * This header declares the autosave writer. The menus periodically hand
+ * it the lists that changed since they were last saved; each list is
+ * copied into one flat snapshot on the calling thread, which only costs
+ * a memory copy, and a background thread writes the snapshots to disk.
+ * The menus therefore never wait for file writes or syncs.
+ *
+ * Autosaves never overwrite the files the user saved. A list named NAME
+ * is autosaved to data/<type>_NAME_autosave.dat, a complete data file
+ * that shows up in the load menu for recovery after a crash. Saving the
+ * list explicitly deletes its autosave file. The interval is set with
+ * autosave_seconds in the configuration file.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef AUTOSAVE_H
+#define AUTOSAVE_H
+
+// Standard C library includes
+#include <stddef.h>     // For size_t
+
+// Application-specific includes
+#include "../../include/headers/list.h"        // Lists to snapshot
+
+/**
+ * @name Autosave Functions
+ * @brief Starting the writer and queueing snapshots
+ * @{
+ */
+
+/**
+ * @brief Starts the background autosave writer
+ *
+ * Does nothing if autosaving is disabled in the configuration or the
+ * writer is already running.
+ *
+ * @return 0 on success, -1 if the writer thread could not be started
+ */
+int startAutosave(void);
+
+/**
+ * @brief Writes all queued snapshots and stops the writer
+ *
+ * Called once at exit; waits for the writes in progress to finish.
+ */
+void stopAutosave(void);
+
+/**
+ * @brief Snapshots a list and queues it for writing in the background
+ *
+ * A snapshot of the same list that is still waiting is replaced, so a
+ * slow disk never builds up a backlog.
+ *
+ * @param dataList The list to snapshot
+ * @param listName Name of the list
+ * @param dataType Data type ("employee" or "student")
+ * @return 0 if the snapshot was queued, -1 on error or if the writer is not running
+ */
+int autosaveList(const list* dataList, const char* listName, const char* dataType);
+
+/**
+ * @brief Drops the queued snapshot of a list and deletes its autosave file
+ *
+ * Called after the list was saved explicitly, when the autosave is no
+ * longer needed for recovery.
+ *
+ * @param listName Name of the list
+ * @param dataType Data type ("employee" or "student")
+ */
+void discardAutosave(const char* listName, const char* dataType);
+
+/** @} */ // End of Autosave Functions
+
+#endif // AUTOSAVE_H
@@ -0,0 +1,503 @@
+/**
+ * @file columnar.c
+ * @brief Columnar Student File Implementation
+ *
+ * This file implements the columnar student file: the writer transposes
+ * a list into one column at a time through a small buffer, and the
+ * readers either read selected columns straight into arrays or scatter
+ * all of them back into complete Student records.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For file operations and I/O
+#include <stdlib.h>     // For memory allocation and general utilities
+#include <string.h>     // For memcpy and memset
+#include <stdbool.h>    // For boolean data type support
+#include <stddef.h>     // For offsetof
+
+// Application-specific includes
+#include "columnar.h"                           // Columnar module header
+#include "../../include/headers/apctxt.h"      // For the passing grade and appCreateDirectory
+#include "../../include/headers/datfile.h"     // Data file header and checksums
+#include "../../include/headers/journal.h"     // For removing the journal of a replaced file
+#include "manifest.h"                           // For recording saves in the manifest
+
+#define columnChunkRecords 4096     // Values moved between records and a column at a time
+
+/**
+ * @brief Position and size of the field behind each column
+ */
+static const struct {
+    size_t offset;  // Offset of the field in Student
+    size_t width;   // Size of the field in bytes
+} studentColumnLayout[studentColumnCount] = {
+    { offsetof(Student, personal.studentNumber), studentNumberLen },
+    { offsetof(Student, personal.name.firstName), studentFirstNameLen },
+    { offsetof(Student, personal.name.middleName), studentMiddleNameLen },
+    { offsetof(Student, personal.name.lastName), studentLastNameLen },
+    { offsetof(Student, personal.name.fullName), studentNameLen },
+    { offsetof(Student, personal.gender), sizeof(Gender) },
+    { offsetof(Student, personal.programCode), programCodeLen },
+    { offsetof(Student, personal.yearLevel), sizeof(YearLevel) },
+    { offsetof(Student, academic.unitsEnrolled), sizeof(int) },
+    { offsetof(Student, academic.prelimGrade), sizeof(float) },
+    { offsetof(Student, academic.midtermGrade), sizeof(float) },
+    { offsetof(Student, academic.finalExamGrade), sizeof(float) },
+    { offsetof(Student, academic.finalGrade), sizeof(float) },
+    { offsetof(Student, academic.remarks), studentRemarksLen },
+    { offsetof(Student, standing), sizeof(AcademicStanding) }
+};
+
+/**
+ * @brief Returns the total width of the columns before a column.
+ * @param column The column (studentColumnCount for the width of a whole row).
+ * @return The width in bytes.
+ */
+static size_t getColumnsWidth(int column) {
+    size_t width = 0;
+    for (int c = 0; c < column; c++) {
+        width += studentColumnLayout[c].width;
+    }
+    return width;
+}
+
+/**
+ * @brief Returns the offset of a value in the column area of a file.
+ * @param column The column.
+ * @param count The number of records in the file.
+ * @param index The position of the value in its column.
+ * @return The offset in bytes from the first column.
+ */
+static int64_t getColumnOffset(int column, size_t count, size_t index) {
+    // Columns of a large file lie past 2 GB, beyond what a long holds on Windows
+    return (int64_t)((uint64_t)count * getColumnsWidth(column) + (uint64_t)index * studentColumnLayout[column].width);
+}
+
+/**
+ * @brief Returns the width of the widest column.
+ * @return The width in bytes.
+ */
+static size_t getWidestColumn(void) {
+    size_t widest = 0;
+    for (int c = 0; c < studentColumnCount; c++) {
+        if (studentColumnLayout[c].width > widest) {
+            widest = studentColumnLayout[c].width;
+        }
+    }
+    return widest;
+}
+
+/**
+ * @brief Copies one field of a chunk of records into a column.
+ * @param rows The records.
+ * @param offset The offset of the field in a record.
+ * @param width The width of the field in bytes.
+ * @param count The number of records.
+ * @param values Receives the column values.
+ */
+static void gatherField(const unsigned char* const* rows, size_t offset, size_t width, size_t count,
+                        unsigned char* values) {
+    // Constant-size copies compile to plain moves; most fields are 4 or 32 bytes wide
+    switch (width) {
+        case 4:
+            for (size_t i = 0; i < count; i++) memcpy(values + i * 4, rows[i] + offset, 4);
+            break;
+        case 32:
+            for (size_t i = 0; i < count; i++) memcpy(values + i * 32, rows[i] + offset, 32);
+            break;
+        default:
+            for (size_t i = 0; i < count; i++) memcpy(values + i * width, rows[i] + offset, width);
+            break;
+    }
+}
+
+/**
+ * @brief Copies column values into one field of consecutive records.
+ * @param students The first record.
+ * @param offset The offset of the field in a record.
+ * @param width The width of the field in bytes.
+ * @param count The number of records.
+ * @param values The column values.
+ */
+static void scatterField(Student* students, size_t offset, size_t width, size_t count, const unsigned char* values) {
+    unsigned char* field = (unsigned char*)students + offset;
+    switch (width) {
+        case 4:
+            for (size_t i = 0; i < count; i++) memcpy(field + i * sizeof(Student), values + i * 4, 4);
+            break;
+        case 32:
+            for (size_t i = 0; i < count; i++) memcpy(field + i * sizeof(Student), values + i * 32, 32);
+            break;
+        default:
+            for (size_t i = 0; i < count; i++) memcpy(field + i * sizeof(Student), values + i * width, width);
+            break;
+    }
+}
+
+/**
+ * @brief Computes the header checksum of a columnar file from its column checksums.
+ * @param directory The column directory with the checksum of each column.
+ * @param count The number of records.
+ * @return The checksum of the directory followed by all columns.
+ */
+static uint32_t getColumnFileChecksum(const StudentColumnEntry* directory, size_t count) {
+    uint32_t checksum = crc32c(0, directory, studentColumnCount * sizeof(StudentColumnEntry));
+    for (int c = 0; c < studentColumnCount; c++) {
+        checksum = crc32cCombine(checksum, directory[c].checksum, (uint64_t)count * studentColumnLayout[c].width);
+    }
+    return checksum;
+}
+
+/**
+ * @brief Builds the path of a file under data/.
+ * @param filename The name of the file.
+ * @param path Receives the path.
+ * @param size The size of the path buffer.
+ */
+static void getColumnFilePath(const char* filename, char* path, size_t size) {
+    snprintf(path, size, "data/%s", filename);
+}
+
+/**
+ * @brief Saves a student list as a columnar file under data/.
+ * @param studentList The list of students.
+ * @param filename The name of the file.
+ * @return The number of students saved, or -1 on failure.
+ */
+int saveStudentColumnFile(const list* studentList, const char* filename) {
+    if (!studentList || !filename || studentList->size < 0) {
+        return -1;
+    }
+    appCreateDirectory("data");
+
+    char path[256];
+    char savingPath[300];
+    getColumnFilePath(filename, path, sizeof(path));
+    snprintf(savingPath, sizeof(savingPath), "%s.saving.tmp", path);
+
+    // Gather the records once; every column is then one pass over the array
+    size_t capacity = (size_t)studentList->size;
+    const unsigned char** rows = (const unsigned char**)malloc((capacity > 0 ? capacity : 1) * sizeof(*rows));
+    unsigned char* buffer = (unsigned char*)malloc(columnChunkRecords * getWidestColumn());
+    uint32_t checksums[studentColumnCount] = { 0 };
+    if (!rows || !buffer) {
+        free(rows);
+        free(buffer);
+        return -1;
+    }
+    size_t count = 0;
+    node* current = studentList->head;
+    for (size_t i = 0; i < capacity; i++, current = current->next) {
+        if (current->data) {
+            rows[count++] = (const unsigned char*)current->data;
+        }
+    }
+
+    FILE* file = fopen(savingPath, "wb");
+    if (!file) {
+        free(rows);
+        free(buffer);
+        return -1;
+    }
+    DataFileHeader header;
+    StudentColumnEntry directory[studentColumnCount];
+    memset(directory, 0, sizeof(directory));
+    initDataFileHeader(&header, dataFileStudentColumns, getColumnsWidth(studentColumnCount), sizeof(directory));
+    bool ok = writeDataFileHeader(file, &header) == 0 && fwrite(directory, sizeof(directory), 1, file) == 1;
+
+    // Chunks of rows are transposed while their records are still in cache,
+    // and each column's piece is written at its place in the file
+    int64_t columnsStart = (int64_t)header.headerSize + (int64_t)header.metadataSize;
+    for (size_t done = 0; done < count && ok; done += columnChunkRecords) {
+        size_t chunk = (count - done < columnChunkRecords) ? count - done : columnChunkRecords;
+        for (int c = 0; c < studentColumnCount && ok; c++) {
+            size_t offset = studentColumnLayout[c].offset;
+            size_t width = studentColumnLayout[c].width;
+            gatherField(rows + done, offset, width, chunk, buffer);
+            checksums[c] = crc32c(checksums[c], buffer, chunk * width);
+            ok = seekDataFile(file, columnsStart + getColumnOffset(c, count, done), SEEK_SET) == 0 &&
+                 fwrite(buffer, width, chunk, file) == chunk;
+        }
+    }
+    free(rows);
+    free(buffer);
+    for (int c = 0; c < studentColumnCount; c++) {
+        directory[c].column = (uint32_t)c;
+        directory[c].width = (uint32_t)studentColumnLayout[c].width;
+        directory[c].checksum = checksums[c];
+    }
+
+    header.recordCount = (uint32_t)count;
+    header.checksum = getColumnFileChecksum(directory, count);
+    ok = ok && seekDataFile(file, (int64_t)sizeof(header), SEEK_SET) == 0 &&
+         fwrite(directory, sizeof(directory), 1, file) == 1 &&
+         writeDataFileHeader(file, &header) == 0 && syncDataFile(file) == 0;
+    if (fclose(file) != 0 || !ok) {
+        remove(savingPath);
+        return -1;
+    }
+    if (replaceDataFile(savingPath, path) != 0) {
+        return -1;
+    }
+
+    // A journal of a row file with this name no longer applies
+    char logPath[300];
+    getJournalPath(path, logPath, sizeof(logPath));
+    remove(logPath);
+    journalBaseReplaced(path);
+    updateDataFileManifest(filename, (int)count);
+    return (int)count;
+}
+
+/**
+ * @brief Checks whether a file under data/ is a columnar student file.
+ * @param filename The name of the file.
+ * @return true if the file has a columnar student header, false otherwise.
+ */
+bool isStudentColumnFile(const char* filename) {
+    if (!filename) {
+        return false;
+    }
+    char path[256];
+    getColumnFilePath(filename, path, sizeof(path));
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    DataFileHeader header;
+    bool columnar = fread(&header, sizeof(header), 1, file) == 1 && header.magic == dataFileMagic &&
+                    (header.flags & dataFileTypeMask) == dataFileStudentColumns;
+    fclose(file);
+    return columnar;
+}
+
+/**
+ * @brief Opens a columnar student file and validates its header and directory.
+ * @param filename The name of the file.
+ * @param header Receives the header.
+ * @param directory Receives the column directory.
+ * @return The file positioned at the first column, or NULL if it is missing or invalid.
+ */
+static FILE* openStudentColumnFile(const char* filename, DataFileHeader* header, StudentColumnEntry* directory) {
+    char path[256];
+    getColumnFilePath(filename, path, sizeof(path));
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    size_t directorySize = studentColumnCount * sizeof(StudentColumnEntry);
+    bool ok = readDataFileHeader(file, dataFileStudentColumns, getColumnsWidth(studentColumnCount), directory,
+                                 directorySize, header) == 0 &&
+              header->version >= 1 && (header->flags & dataFileOptionMask) == 0;
+
+    // A file written for another layout of Student has different columns or widths
+    for (int c = 0; c < studentColumnCount && ok; c++) {
+        ok = directory[c].column == (uint32_t)c && directory[c].width == studentColumnLayout[c].width &&
+             directory[c].reserved == 0;
+    }
+    if (!ok) {
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+/**
+ * @brief Loads the columns of a columnar student file selected by a mask.
+ * @param filename The name of the file.
+ * @param columnMask The columns to load.
+ * @param columns Receives the columns.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int loadStudentColumns(const char* filename, uint32_t columnMask, StudentColumns* columns) {
+    if (!columns) {
+        return -1;
+    }
+    memset(columns, 0, sizeof(*columns));
+    if (!filename || (columnMask & ~studentColumnsAll) != 0) {
+        return -1;
+    }
+
+    DataFileHeader header;
+    StudentColumnEntry directory[studentColumnCount];
+    FILE* file = openStudentColumnFile(filename, &header, directory);
+    if (!file) {
+        return -1;
+    }
+    columns->count = header.recordCount;
+    int64_t columnsStart = (int64_t)header.headerSize + (int64_t)header.metadataSize;
+
+    bool ok = true;
+    for (int c = 0; c < studentColumnCount && ok; c++) {
+        if (!(columnMask & studentColumnBit(c))) {
+            continue;
+        }
+        size_t size = columns->count * studentColumnLayout[c].width;
+        columns->columns[c] = malloc(size > 0 ? size : 1);
+        ok = columns->columns[c] != NULL &&
+             seekDataFile(file, columnsStart + getColumnOffset(c, columns->count, 0), SEEK_SET) == 0 &&
+             (size == 0 || fread(columns->columns[c], size, 1, file) == 1) &&
+             crc32c(0, columns->columns[c], size) == directory[c].checksum;
+    }
+    fclose(file);
+    if (!ok) {
+        freeStudentColumns(columns);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Releases the columns of a projection.
+ * @param columns The columns.
+ */
+void freeStudentColumns(StudentColumns* columns) {
+    if (!columns) {
+        return;
+    }
+    for (int c = 0; c < studentColumnCount; c++) {
+        free(columns->columns[c]);
+        columns->columns[c] = NULL;
+    }
+    columns->count = 0;
+}
+
+/**
+ * @brief Reads every column of an open columnar file back into complete records.
+ * @param file The columnar file.
+ * @param header The header of the file.
+ * @param directory The column directory.
+ * @param students The zeroed records to fill.
+ * @return Returns 0 if every column and the header checksum match, -1 otherwise.
+ */
+static int readAllColumns(FILE* file, const DataFileHeader* header, const StudentColumnEntry* directory,
+                          Student* students) {
+    size_t count = header->recordCount;
+    unsigned char* buffer = (unsigned char*)malloc(columnChunkRecords * getWidestColumn());
+    if (!buffer) {
+        return -1;
+    }
+
+    // Rows are filled a chunk at a time from every column, so each chunk of
+    // records is written while it is in cache instead of once per column
+    int64_t columnsStart = (int64_t)header->headerSize + (int64_t)header->metadataSize;
+    uint32_t checksums[studentColumnCount] = { 0 };
+    bool ok = true;
+    for (size_t done = 0; done < count && ok; done += columnChunkRecords) {
+        size_t chunk = (count - done < columnChunkRecords) ? count - done : columnChunkRecords;
+        for (int c = 0; c < studentColumnCount && ok; c++) {
+            size_t offset = studentColumnLayout[c].offset;
+            size_t width = studentColumnLayout[c].width;
+            ok = seekDataFile(file, columnsStart + getColumnOffset(c, count, done), SEEK_SET) == 0 &&
+                 fread(buffer, width, chunk, file) == chunk;
+            if (!ok) {
+                break;
+            }
+            checksums[c] = crc32c(checksums[c], buffer, chunk * width);
+            scatterField(students + done, offset, width, chunk, buffer);
+        }
+    }
+    free(buffer);
+    for (int c = 0; c < studentColumnCount && ok; c++) {
+        ok = checksums[c] == directory[c].checksum;
+    }
+    return (ok && verifyDataFileChecksum(header, getColumnFileChecksum(directory, count)) == 0) ? 0 : -1;
+}
+
+/**
+ * @brief Loads a columnar student file as a list of complete students.
+ * @param filename The name of the file.
+ * @param listType The type of list to create.
+ * @return The new list, or NULL on failure.
+ */
+list* loadStudentColumnFile(const char* filename, ListType listType) {
+    if (!filename) {
+        return NULL;
+    }
+    DataFileHeader header;
+    StudentColumnEntry directory[studentColumnCount];
+    FILE* file = openStudentColumnFile(filename, &header, directory);
+    if (!file) {
+        return NULL;
+    }
+
+    list* studentList = NULL;
+    if (createStudentListOfType(&studentList, listType) != 0) {
+        fclose(file);
+        return NULL;
+    }
+    size_t count = header.recordCount;
+    if (count == 0) {
+        fclose(file);
+        return studentList;
+    }
+
+    // Padding between fields stays zero, as in records written by the row format
+    Student* students = (Student*)calloc(count, sizeof(Student));
+    void** items = (void**)malloc(count * sizeof(void*));
+    bool ok = students && items && readAllColumns(file, &header, directory, students) == 0 &&
+              adoptDataBlock(studentList, students, count * sizeof(Student)) == 0;
+    fclose(file);
+    if (!ok) {
+        free(students);
+        free(items);
+        destroyList(&studentList, freeStudent);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        items[i] = &students[i];
+    }
+    int result = addNodesBulk(studentList, items, count);
+    free(items);
+    if (result != 0) {
+        destroyList(&studentList, freeStudent);
+        return NULL;
+    }
+    return studentList;
+}
+
+/**
+ * @brief Computes grade statistics of a columnar student file from its exam grade columns.
+ * @param filename The name of the file.
+ * @param summary Receives the statistics.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int summarizeStudentColumnFile(const char* filename, StudentGradeSummary* summary) {
+    if (!summary) {
+        return -1;
+    }
+    memset(summary, 0, sizeof(*summary));
+
+    StudentColumns columns;
+    if (loadStudentColumns(filename, studentColumnsExamGrades, &columns) != 0) {
+        return -1;
+    }
+    const float* prelim = (const float*)columns.columns[STUDENT_COLUMN_PRELIM_GRADE];
+    const float* midterm = (const float*)columns.columns[STUDENT_COLUMN_MIDTERM_GRADE];
+    const float* finalExam = (const float*)columns.columns[STUDENT_COLUMN_FINAL_EXAM_GRADE];
+    float passingGrade = getPassingGrade();
+
+    // Same arithmetic as calculateFinalGrade(), so the results match a full load
+    double total = 0.0;
+    for (size_t i = 0; i < columns.count; i++) {
+        float finalGrade = (prelim[i] + midterm[i] + finalExam[i]) / 3.0f;
+        total += finalGrade;
+        if (finalGrade >= passingGrade) {
+            summary->passedCount++;
+        } else {
+            summary->failedCount++;
+        }
+        if (finalGrade >= 90.0f) {
+            summary->deansListCount++;
+        }
+    }
+    summary->count = (int)columns.count;
+    summary->averageGrade = (columns.count > 0) ? total / (double)columns.count : 0.0;
+    freeStudentColumns(&columns);
+    return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file columnar.h
+ * @brief Columnar Student File Module Header
+ *
+ * This header declares a column-by-column variant of the student data
+ * file. Each Student field is stored as one contiguous column, so work
+ * that only needs a few fields, such as grade statistics over millions of
+ * students, reads only those columns instead of every full record with
+ * its names.
+ *
+ * File layout (see datfile.h for the header):
+ * - DataFileHeader with record type dataFileStudentColumns; its record
+ *   size is the total width of all columns
+ * - Column directory (metadata): one StudentColumnEntry per column
+ * - The columns in StudentColumn order, each recordCount values wide
+ *
+ * Every column carries its own CRC32C in the directory, so a projection
+ * verifies what it reads without reading the rest of the file. The header
+ * checksum covers the directory and all columns like in a row file.
+ * saveStudentColumnDataFromFile() converts a list to this format,
+ * saveStudentDataFromFile() keeps an existing columnar file columnar, and
+ * loadStudentDataFromFile() also accepts columnar files.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef COLUMNAR_H
+#define COLUMNAR_H
+
+// Standard C library includes
+#include <stddef.h>     // For size_t
+#include <stdint.h>     // For fixed-width directory fields
+
+// Application-specific includes
+#include "../../include/headers/list.h"        // Student lists
+#include "../../include/models/student.h"     // Student fields
+
+/**
+ * @enum StudentColumn
+ * @brief Columns of a columnar student file, in file order
+ */
+typedef enum {
+    STUDENT_COLUMN_NUMBER,          // personal.studentNumber
+    STUDENT_COLUMN_FIRST_NAME,      // personal.name.firstName
+    STUDENT_COLUMN_MIDDLE_NAME,     // personal.name.middleName
+    STUDENT_COLUMN_LAST_NAME,       // personal.name.lastName
+    STUDENT_COLUMN_FULL_NAME,       // personal.name.fullName
+    STUDENT_COLUMN_GENDER,          // personal.gender
+    STUDENT_COLUMN_PROGRAM_CODE,    // personal.programCode
+    STUDENT_COLUMN_YEAR_LEVEL,      // personal.yearLevel
+    STUDENT_COLUMN_UNITS,           // academic.unitsEnrolled
+    STUDENT_COLUMN_PRELIM_GRADE,    // academic.prelimGrade
+    STUDENT_COLUMN_MIDTERM_GRADE,   // academic.midtermGrade
+    STUDENT_COLUMN_FINAL_EXAM_GRADE,// academic.finalExamGrade
+    STUDENT_COLUMN_FINAL_GRADE,     // academic.finalGrade
+    STUDENT_COLUMN_REMARKS,         // academic.remarks
+    STUDENT_COLUMN_STANDING,        // standing
+    studentColumnCount              // Number of columns
+} StudentColumn;
+
+/**
+ * @name Column Selection
+ * @brief Bit masks selecting the columns of a projection
+ * @{
+ */
+#define studentColumnBit(column) (1u << (column))   // Mask of one column
+#define studentColumnsAll ((1u << studentColumnCount) - 1u)
+#define studentColumnsExamGrades (studentColumnBit(STUDENT_COLUMN_PRELIM_GRADE) | \
+                                  studentColumnBit(STUDENT_COLUMN_MIDTERM_GRADE) | \
+                                  studentColumnBit(STUDENT_COLUMN_FINAL_EXAM_GRADE))
+
+/** @} */ // End of Column Selection
+
+/**
+ * @struct StudentColumnEntry
+ * @brief Directory entry describing one column of the file
+ */
+typedef struct {
+    uint32_t column;        // StudentColumn of the entry
+    uint32_t width;         // Size of one value in bytes
+    uint32_t checksum;      // CRC32C of the column
+    uint32_t reserved;      // Always 0
+} StudentColumnEntry;
+
+/**
+ * @struct StudentColumns
+ * @brief Columns loaded by a projection
+ *
+ * columns[c] points to count values of the field of column c, e.g.
+ * (const float*)set.columns[STUDENT_COLUMN_FINAL_GRADE], or is NULL if
+ * the column was not requested. Text columns hold fixed-width fields,
+ * so value i of STUDENT_COLUMN_NUMBER starts at i * studentNumberLen.
+ */
+typedef struct {
+    size_t count;                           // Number of students
+    void* columns[studentColumnCount];      // Loaded columns, NULL for the others
+} StudentColumns;
+
+/**
+ * @struct StudentGradeSummary
+ * @brief Grade statistics of a student file
+ */
+typedef struct {
+    int count;              // Number of students
+    double averageGrade;    // Average final grade (0 if there are no students)
+    int passedCount;        // Students at or above the passing grade
+    int failedCount;        // Students below the passing grade
+    int deansListCount;     // Students with a final grade of at least 90
+} StudentGradeSummary;
+
+/**
+ * @name Columnar Student File Functions
+ * @brief Writing, loading and projecting columnar student files
+ * @{
+ */
+
+/**
+ * @brief Saves a student list as a columnar file under data/
+ *
+ * The file is written under a temporary name, synced and renamed into
+ * place like a row file.
+ *
+ * @param studentList List of students
+ * @param filename Name of the file (in data directory)
+ * @return Number of students saved, or -1 on error
+ */
+int saveStudentColumnFile(const list* studentList, const char* filename);
+
+/**
+ * @brief Checks whether a file under data/ is a columnar student file
+ *
+ * @param filename Name of the file (in data directory)
+ * @return true if the file starts with a columnar student header
+ */
+bool isStudentColumnFile(const char* filename);
+
+/**
+ * @brief Loads the columns of a columnar student file selected by a mask
+ *
+ * Each requested column is read with one fread straight into its own
+ * array and checked against its checksum; the other columns are skipped.
+ *
+ * @param filename Name of the file (in data directory)
+ * @param columnMask Columns to load (studentColumnBit() values)
+ * @param columns Receives the columns; release with freeStudentColumns()
+ * @return 0 on success, -1 on error or checksum mismatch
+ */
+int loadStudentColumns(const char* filename, uint32_t columnMask, StudentColumns* columns);
+
+/**
+ * @brief Releases the columns of a projection
+ *
+ * @param columns Columns filled by loadStudentColumns()
+ */
+void freeStudentColumns(StudentColumns* columns);
+
+/**
+ * @brief Loads a columnar student file as a list of complete students
+ *
+ * @param filename Name of the file (in data directory)
+ * @param listType Type of list to create
+ * @return New list, or NULL on error or checksum mismatch
+ */
+list* loadStudentColumnFile(const char* filename, ListType listType);
+
+/**
+ * @brief Computes grade statistics of a columnar student file
+ *
+ * Only the three exam grade columns are read. Final grades are computed
+ * from them the same way calculateFinalGrade() does, so stale stored
+ * final grades and remarks do not affect the result.
+ *
+ * @param filename Name of the file (in data directory)
+ * @param summary Receives the statistics
+ * @return 0 on success, -1 on error
+ */
+int summarizeStudentColumnFile(const char* filename, StudentGradeSummary* summary);
+
+/** @} */ // End of Columnar Student File Functions
+
+#endif // COLUMNAR_H
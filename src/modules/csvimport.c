@@ -0,0 +1,634 @@
+/**
+ * @file csvimport.c
+ * @brief Bulk CSV/TSV Import Implementation
+ *
+ * This file implements the bulk importers. A reader splits the file into
+ * rows without ever copying more than one row: fields are found with a
+ * 16-byte SSE2 scan for the delimiter, line feeds and quotes (a plain
+ * byte loop on other processors) and copied NUL-terminated into a row
+ * buffer. A row that runs past the end of the buffer is parsed again
+ * once the next chunk has been read behind it.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For file operations and the error report
+#include <stdlib.h>     // For memory allocation and strtol
+#include <string.h>     // For memcpy, memchr and strlen
+#include <stdbool.h>    // For boolean data type support
+
+#ifdef __SSE2__
+#include <emmintrin.h>  // For the vectorized field scan
+#endif
+
+// Application-specific includes
+#include "csvimport.h"                          // Bulk import module header
+#include "payroll.h"                            // For computing imported payroll
+#include "../../include/headers/apctxt.h"      // For validateInput and parseDecimal
+#include "../../include/headers/journal.h"     // For compacting a journaled list after an import
+#include "../../include/models/employee.h"     // Employee records
+#include "../../include/models/student.h"      // Student records
+
+#define csvScanPadding 16           // Readable bytes after the data, so a 16-byte load never leaves the buffer
+#define csvMessageLength 256        // Longest reason written to the error report
+
+/**
+ * @brief Reads a CSV/TSV file one row at a time
+ */
+typedef struct {
+    FILE* file;                                 // The open file
+    char* buffer;                               // File bytes, followed by csvScanPadding zero bytes
+    size_t capacity;                            // Bytes the buffer holds, not counting the padding
+    size_t start;                               // First byte not parsed yet
+    size_t length;                              // Bytes in the buffer
+    bool atEnd;                                 // The whole file has been read
+    char delimiter;                             // ',' or '\t'
+    char* text;                                 // Values of the current row, each NUL-terminated
+    const char* values[csvImportMaxFields];     // Start of each value in text
+    int fieldCount;                             // Fields of the current row (may exceed csvImportMaxFields)
+    size_t line;                                // Line the current row starts on
+    size_t nextLine;                            // Line the next row starts on
+} CsvReader;
+
+/**
+ * @brief Validation rule of one column
+ */
+typedef struct {
+    const char* name;           // Field name used in the error report
+    IValidationType type;       // Rule of the matching form field
+    IValidationParams params;   // Parameters of the rule
+} CsvColumn;
+
+/**
+ * @brief Columns of a record type and how a validated row becomes a record
+ */
+typedef struct {
+    size_t recordSize;          // Size of one record in bytes
+    int columnCount;            // Number of columns
+    const CsvColumn* columns;   // Rule of each column
+    bool (*buildRecord)(const char* const* values, void* record, char* message, size_t messageSize);
+} CsvRecordFormat;
+
+/**
+ * @brief Records waiting to be appended to the list in one block
+ */
+typedef struct {
+    list* target;               // List that receives the records
+    size_t recordSize;          // Size of one record in bytes
+    unsigned char* records;     // Block being filled, NULL before the first record
+    size_t used;                // Records in the block
+    size_t capacity;            // Records the block holds
+    size_t nextCapacity;        // Records the next block will hold
+    void** items;               // Pointers handed to addNodesBulk()
+} CsvBatch;
+
+static const char* employeeStatusChoices[] = {"R", "C", "r", "c"};
+static const char* studentGenderChoices[] = {"M", "F", "m", "f"};
+
+/**
+ * @brief Rules of the employee columns, as on the Add Employee form
+ */
+static const CsvColumn employeeColumns[] = {
+    { "Employee Number", IV_EXACT_LEN, {.rangeInt = {.max = 10}} },
+    { "First Name", IV_ALPHA_ONLY_MAX_LEN, {.maxLengthChars = {.maxLength = employeeFirstNameLen - 1}} },
+    { "Middle Name", IV_OPTIONAL_ALPHA_ONLY_MAX_LEN, {.maxLengthChars = {.maxLength = employeeMiddleNameLen - 1}} },
+    { "Last Name", IV_ALPHA_ONLY_MAX_LEN, {.maxLengthChars = {.maxLength = employeeLastNameLen - 1}} },
+    { "Employment Status", IV_CHOICES, {.choices = {.choices = employeeStatusChoices, .count = 4}} },
+    { "Hours Worked", IV_RANGE_INT, {.rangeInt = {.min = 0, .max = 744}} },
+    { "Basic Rate", IV_RANGE_FLT, {.rangeFloat = {.min = 0.01, .max = 999.99}} }
+};
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ * @param mask The mask.
+ * @return The bit index.
+ */
+static unsigned lowestSetBit(unsigned mask) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Finds the next delimiter, line feed or quote.
+ * @param p The first byte to look at.
+ * @param end The end of the data; csvScanPadding readable bytes must follow it.
+ * @param delimiter The field delimiter.
+ * @return The position of the byte found, or end if there is none.
+ */
+static const char* findFieldEnd(const char* p, const char* end, char delimiter) {
+#ifdef __SSE2__
+    const __m128i delimiters = _mm_set1_epi8(delimiter);
+    const __m128i lineFeeds = _mm_set1_epi8('\n');
+    const __m128i quotes = _mm_set1_epi8('"');
+    for (; p < end; p += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)p);
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, delimiters), _mm_cmpeq_epi8(bytes, lineFeeds)),
+                                    _mm_cmpeq_epi8(bytes, quotes));
+        unsigned mask = (unsigned)_mm_movemask_epi8(hits);
+        if (mask != 0) {
+            p += lowestSetBit(mask);
+            return (p < end) ? p : end;
+        }
+    }
+    return end;
+#else
+    for (; p < end; p++) {
+        if (*p == delimiter || *p == '\n' || *p == '"') {
+            return p;
+        }
+    }
+    return end;
+#endif
+}
+
+/**
+ * @brief Moves the unparsed bytes to the front of the buffer and reads more behind them.
+ * @param reader The reader.
+ * @return Returns 0 on success, -1 on a read error or memory allocation failure.
+ */
+static int refillCsvReader(CsvReader* reader) {
+    size_t remaining = reader->length - reader->start;
+    if (reader->start == 0 && remaining == reader->capacity) {
+        // A single row fills the whole buffer, so it has to grow
+        size_t capacity = reader->capacity * 2;
+        char* buffer = (char*)realloc(reader->buffer, capacity + csvScanPadding);
+        if (!buffer) {
+            return -1;
+        }
+        reader->buffer = buffer;
+        char* text = (char*)realloc(reader->text, capacity + csvImportMaxFields);
+        if (!text) {
+            return -1;
+        }
+        reader->text = text;
+        reader->capacity = capacity;
+    } else if (remaining > 0) {
+        memmove(reader->buffer, reader->buffer + reader->start, remaining);
+    }
+    reader->start = 0;
+    reader->length = remaining;
+
+    size_t wanted = reader->capacity - reader->length;
+    size_t count = fread(reader->buffer + reader->length, 1, wanted, reader->file);
+    reader->length += count;
+    memset(reader->buffer + reader->length, 0, csvScanPadding);
+    if (count < wanted) {
+        if (ferror(reader->file)) {
+            return -1;
+        }
+        reader->atEnd = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Opens a CSV/TSV file and picks its delimiter from the first line.
+ * @param reader The reader to initialize.
+ * @param path The path of the file.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int openCsvReader(CsvReader* reader, const char* path) {
+    memset(reader, 0, sizeof(*reader));
+    reader->capacity = csvImportBufferBytes;
+    reader->buffer = (char*)malloc(reader->capacity + csvScanPadding);
+    reader->text = (char*)malloc(reader->capacity + csvImportMaxFields);
+    reader->file = fopen(path, "rb");
+    if (!reader->buffer || !reader->text || !reader->file || refillCsvReader(reader) != 0) {
+        if (reader->file) {
+            fclose(reader->file);
+        }
+        free(reader->buffer);
+        free(reader->text);
+        return -1;
+    }
+
+    // Skip the byte order mark spreadsheet programs put in front of UTF-8 text
+    if (reader->length >= 3 && memcmp(reader->buffer, "\xEF\xBB\xBF", 3) == 0) {
+        reader->start = 3;
+    }
+    const char* firstLine = reader->buffer + reader->start;
+    const char* lineEnd = (const char*)memchr(firstLine, '\n', reader->length - reader->start);
+    size_t lineLength = lineEnd ? (size_t)(lineEnd - firstLine) : reader->length - reader->start;
+    reader->delimiter = memchr(firstLine, '\t', lineLength) ? '\t' : ',';
+    reader->nextLine = 1;
+    return 0;
+}
+
+/**
+ * @brief Closes a CSV/TSV file and releases the reader's buffers.
+ * @param reader The reader.
+ */
+static void closeCsvReader(CsvReader* reader) {
+    fclose(reader->file);
+    free(reader->buffer);
+    free(reader->text);
+}
+
+/**
+ * @brief Splits the next row of the buffer into values.
+ * @param reader The reader.
+ * @param final True if no more data follows the buffer, so its end also ends the row.
+ * @return Returns true if a whole row was parsed, false if the row continues past the buffer.
+ */
+static bool parseCsvRow(CsvReader* reader, bool final) {
+    const char* p = reader->buffer + reader->start;
+    const char* end = reader->buffer + reader->length;
+    char* out = reader->text;
+    size_t lineFeeds = 0; // Line feeds inside quoted values
+    reader->fieldCount = 0;
+
+    while (true) {
+        char* value = out;
+        bool kept = reader->fieldCount < csvImportMaxFields;
+        if (p < end && *p == '"') {
+            for (p++; ; ) {
+                const char* quote = (const char*)memchr(p, '"', (size_t)(end - p));
+                if (!quote && !final) {
+                    return false;
+                }
+                if (!quote) {
+                    quote = end; // Unterminated at the end of the file: the rest is the value
+                }
+                for (const char* c = p; c < quote; c++) {
+                    lineFeeds += (*c == '\n');
+                }
+                if (kept) {
+                    memcpy(out, p, (size_t)(quote - p));
+                    out += quote - p;
+                }
+                if (quote == end) {
+                    p = end;
+                    break;
+                }
+                if (quote + 1 == end && !final) {
+                    return false; // Cannot tell a closing quote from the first of a pair yet
+                }
+                if (quote + 1 < end && quote[1] == '"') {
+                    if (kept) {
+                        *out++ = '"';
+                    }
+                    p = quote + 2;
+                    continue;
+                }
+                p = quote + 1;
+                break;
+            }
+        }
+
+        // Unquoted text, or anything after a closing quote, runs to the next delimiter or line end
+        const char* stop = findFieldEnd(p, end, reader->delimiter);
+        while (stop < end && *stop == '"') {
+            stop = findFieldEnd(stop + 1, end, reader->delimiter);
+        }
+        if (stop == end && !final) {
+            return false;
+        }
+        if (kept) {
+            memcpy(out, p, (size_t)(stop - p));
+            out += stop - p;
+        }
+        p = stop;
+
+        bool lineEnd = (p == end || *p == '\n');
+        if (lineEnd && kept && out > value && out[-1] == '\r') {
+            out--;
+        }
+        if (kept) {
+            *out++ = '\0';
+            reader->values[reader->fieldCount] = value;
+        }
+        reader->fieldCount++;
+        if (lineEnd) {
+            p += (p < end);
+            break;
+        }
+        p++; // Past the delimiter
+    }
+
+    reader->start = (size_t)(p - reader->buffer);
+    reader->line = reader->nextLine;
+    reader->nextLine += 1 + lineFeeds;
+    return true;
+}
+
+/**
+ * @brief Reads the next row of the file.
+ * @param reader The reader.
+ * @return Returns 1 if a row was read, 0 at the end of the file, -1 on error.
+ */
+static int readCsvRow(CsvReader* reader) {
+    while (true) {
+        if (reader->start == reader->length && reader->atEnd) {
+            return 0;
+        }
+        if (reader->start < reader->length && parseCsvRow(reader, reader->atEnd)) {
+            return 1;
+        }
+        if (refillCsvReader(reader) != 0) {
+            return -1;
+        }
+    }
+}
+
+/**
+ * @brief Returns the next zeroed record of the batch, starting a new block if needed.
+ * @param batch The batch.
+ * @return The record, or NULL on memory allocation failure.
+ */
+static void* nextBatchRecord(CsvBatch* batch) {
+    if (!batch->records) {
+        batch->records = (unsigned char*)malloc(batch->nextCapacity * batch->recordSize);
+        if (!batch->records) {
+            return NULL;
+        }
+        batch->capacity = batch->nextCapacity;
+        batch->used = 0;
+        if (batch->nextCapacity < csvImportMaxBatch) {
+            batch->nextCapacity *= 2; // Few blocks for a large file, little waste for a small one
+        }
+    }
+    void* record = batch->records + batch->used * batch->recordSize;
+    memset(record, 0, batch->recordSize);
+    return record;
+}
+
+/**
+ * @brief Hands the filled part of the current block to the list.
+ * @param batch The batch.
+ * @param summary The import summary, whose imported count is increased.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int flushBatch(CsvBatch* batch, CsvImportSummary* summary) {
+    if (!batch->records) {
+        return 0;
+    }
+    unsigned char* records = batch->records;
+    size_t used = batch->used;
+    batch->records = NULL;
+    if (used == 0) {
+        free(records);
+        return 0;
+    }
+    if (used < batch->capacity) {
+        unsigned char* trimmed = (unsigned char*)realloc(records, used * batch->recordSize);
+        if (trimmed) {
+            records = trimmed;
+        }
+    }
+    if (adoptDataBlock(batch->target, records, used * batch->recordSize) != 0) {
+        free(records);
+        return -1;
+    }
+    for (size_t i = 0; i < used; i++) {
+        batch->items[i] = records + i * batch->recordSize;
+    }
+    if (addNodesBulk(batch->target, batch->items, used) != 0) {
+        return -1;
+    }
+    summary->importedCount += used;
+    return 0;
+}
+
+/**
+ * @brief Checks a row against the column rules and builds its record.
+ * @param format The record format.
+ * @param reader The reader holding the row.
+ * @param record The zeroed record to fill.
+ * @param message Receives the reason if the row is rejected.
+ * @param messageSize The size of the message buffer.
+ * @return Returns true if the row is valid, false otherwise.
+ */
+static bool convertRow(const CsvRecordFormat* format, const CsvReader* reader, void* record,
+                       char* message, size_t messageSize) {
+    if (reader->fieldCount != format->columnCount) {
+        snprintf(message, messageSize, "Expected %d fields, found %d", format->columnCount, reader->fieldCount);
+        return false;
+    }
+    for (int i = 0; i < format->columnCount; i++) {
+        const CsvColumn* column = &format->columns[i];
+        if (!validateInput(reader->values[i], column->type, column->params, column->name, message, messageSize)) {
+            return false;
+        }
+    }
+    return format->buildRecord(reader->values, record, message, messageSize);
+}
+
+/**
+ * @brief Checks whether a value contains no digits, as a column title does.
+ * @param value The value.
+ * @return Returns true if the value has no digits, false otherwise.
+ */
+static bool isColumnTitle(const char* value) {
+    for (; *value; value++) {
+        if (*value >= '0' && *value <= '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Imports the rows of a CSV/TSV file into a list.
+ * @param path The path of the file.
+ * @param dataList The list that receives the records.
+ * @param report The error report, or NULL.
+ * @param summary Receives the row counts.
+ * @param format The record format.
+ * @return Returns 0 if the whole file was read, -1 otherwise.
+ */
+static int importRecords(const char* path, list* dataList, FILE* report, CsvImportSummary* summary,
+                         const CsvRecordFormat* format) {
+    memset(summary, 0, sizeof(*summary));
+    if (!path || !dataList) {
+        return -1;
+    }
+    CsvReader reader;
+    if (openCsvReader(&reader, path) != 0) {
+        return -1;
+    }
+    CsvBatch batch = { dataList, format->recordSize, NULL, 0, 0, csvImportFirstBatch, NULL };
+    batch.items = (void**)malloc(csvImportMaxBatch * sizeof(void*));
+    if (!batch.items) {
+        closeCsvReader(&reader);
+        return -1;
+    }
+
+    char message[csvMessageLength];
+    int result = 0;
+    int status;
+    while ((status = readCsvRow(&reader)) == 1) {
+        if (reader.fieldCount == 1 && reader.values[0][0] == '\0') {
+            continue; // Blank line
+        }
+        if (reader.line == 1 && isColumnTitle(reader.values[0])) {
+            continue; // Header
+        }
+        summary->rowCount++;
+
+        void* record = nextBatchRecord(&batch);
+        if (!record) {
+            result = -1;
+            break;
+        }
+        if (!convertRow(format, &reader, record, message, sizeof(message))) {
+            summary->rejectedCount++;
+            if (report) {
+                fprintf(report, "Line %zu: %s\n", reader.line, message);
+            }
+            continue; // The slot is reused by the next row
+        }
+        if (++batch.used == batch.capacity && flushBatch(&batch, summary) != 0) {
+            result = -1;
+            break;
+        }
+    }
+    if (status < 0 || flushBatch(&batch, summary) != 0) {
+        result = -1;
+    }
+    free(batch.records); // Left over only after a failure
+    free(batch.items);
+    closeCsvReader(&reader);
+
+    // One new base on the next save is cheaper than a log entry per imported row
+    if (summary->importedCount > 0) {
+        journalForceCompaction(dataList);
+    }
+    return result;
+}
+
+/**
+ * @brief Copies a validated value into a fixed-size text field.
+ * @param field The field, large enough for the value.
+ * @param value The value.
+ */
+static void copyValue(char* field, const char* value) {
+    memcpy(field, value, strlen(value) + 1);
+}
+
+/**
+ * @brief Builds an employee from a validated row.
+ * @param values The values of the row.
+ * @param record The zeroed Employee to fill.
+ * @param message Receives the reason if the row is rejected.
+ * @param messageSize The size of the message buffer.
+ * @return Returns true on success, false if the name cannot be formatted.
+ */
+static bool buildEmployee(const char* const* values, void* record, char* message, size_t messageSize) {
+    Employee* employee = (Employee*)record;
+    copyValue(employee->personal.employeeNumber, values[0]);
+    copyValue(employee->personal.name.firstName, values[1]);
+    copyValue(employee->personal.name.middleName, values[2]);
+    copyValue(employee->personal.name.lastName, values[3]);
+    if (!composeEmployeeName(&employee->personal.name)) {
+        snprintf(message, messageSize, "First and last names must each be less than %d characters",
+                 employeeNameLen - 5);
+        return false;
+    }
+
+    double basicRate = 0.0;
+    parseDecimal(values[6], &basicRate);
+    employee->employment.status = (values[4][0] == 'R' || values[4][0] == 'r') ? statusRegular : statusCasual;
+    employee->employment.hoursWorked = (int)strtol(values[5], NULL, 10);
+    employee->employment.basicRate = (float)basicRate;
+    calculatePayroll(employee);
+    return true;
+}
+
+/**
+ * @brief Builds a student from a validated row.
+ * @param values The values of the row.
+ * @param record The zeroed Student to fill.
+ * @param message Receives the reason if the row is rejected.
+ * @param messageSize The size of the message buffer.
+ * @return Returns true on success, false if the name cannot be formatted.
+ */
+static bool buildStudent(const char* const* values, void* record, char* message, size_t messageSize) {
+    Student* student = (Student*)record;
+    copyValue(student->personal.studentNumber, values[0]);
+    copyValue(student->personal.name.firstName, values[1]);
+    copyValue(student->personal.name.middleName, values[2]);
+    copyValue(student->personal.name.lastName, values[3]);
+    if (!composeStudentName(&student->personal.name)) {
+        snprintf(message, messageSize, "First and last names must each be less than %d characters",
+                 studentNameLen - 5);
+        return false;
+    }
+
+    double prelim = 0.0, midterm = 0.0, finalExam = 0.0;
+    parseDecimal(values[8], &prelim);
+    parseDecimal(values[9], &midterm);
+    parseDecimal(values[10], &finalExam);
+    student->personal.gender = (values[4][0] == 'M' || values[4][0] == 'm') ? genderMale : genderFemale;
+    copyValue(student->personal.programCode, values[5]);
+    student->personal.yearLevel = (YearLevel)strtol(values[6], NULL, 10);
+    student->academic.unitsEnrolled = (int)strtol(values[7], NULL, 10);
+    student->academic.prelimGrade = (float)prelim;
+    student->academic.midtermGrade = (float)midterm;
+    student->academic.finalExamGrade = (float)finalExam;
+    calculateFinalGrade(student);
+    return true;
+}
+
+/**
+ * @brief Appends the employees of a CSV/TSV file to a list.
+ * @param path The path of the text file.
+ * @param employeeList The list that receives the employees.
+ * @param report The error report, or NULL.
+ * @param summary Receives the row counts.
+ * @return Returns 0 if the whole file was read, -1 otherwise.
+ */
+int importEmployeesFromCsv(const char* path, list* employeeList, FILE* report, CsvImportSummary* summary) {
+    const CsvRecordFormat format = {
+        sizeof(Employee), (int)(sizeof(employeeColumns) / sizeof(employeeColumns[0])), employeeColumns, buildEmployee
+    };
+    
+    // A warning per capped employee would bury the summary of a large import
+    setPayrollWarnings(false);
+    int result = importRecords(path, employeeList, report, summary, &format);
+    setPayrollWarnings(true);
+    return result;
+}
+
+/**
+ * @brief Appends the students of a CSV/TSV file to a list.
+ * @param path The path of the text file.
+ * @param studentList The list that receives the students.
+ * @param report The error report, or NULL.
+ * @param summary Receives the row counts.
+ * @return Returns 0 if the whole file was read, -1 otherwise.
+ */
+int importStudentsFromCsv(const char* path, list* studentList, FILE* report, CsvImportSummary* summary) {
+    // Program codes come from the configuration, so their rule is built per import
+    const char* programChoices[maxProgramCount];
+    for (int i = 0; i < g_programCount; i++) {
+        programChoices[i] = g_programs[i].code;
+    }
+    const CsvColumn studentColumns[] = {
+        { "Student Number", IV_EXACT_LEN, {.rangeInt = {.max = 10}} },
+        { "First Name", IV_ALPHA_ONLY_MAX_LEN, {.maxLengthChars = {.maxLength = studentFirstNameLen - 1}} },
+        { "Middle Name", IV_OPTIONAL_ALPHA_ONLY_MAX_LEN, {.maxLengthChars = {.maxLength = studentMiddleNameLen - 1}} },
+        { "Last Name", IV_ALPHA_ONLY_MAX_LEN, {.maxLengthChars = {.maxLength = studentLastNameLen - 1}} },
+        { "Gender", IV_CHOICES, {.choices = {.choices = studentGenderChoices, .count = 4}} },
+        { "Program Code", IV_CHOICES, {.choices = {.choices = programChoices, .count = g_programCount}} },
+        { "Year Level", IV_RANGE_INT, {.rangeInt = {.min = 1, .max = 4}} },
+        { "Units Enrolled", IV_RANGE_INT, {.rangeInt = {.min = 1, .max = 30}} },
+        { "Prelim Grade", IV_RANGE_FLT, {.rangeFloat = {.min = 0.0, .max = 100.0}} },
+        { "Midterm Grade", IV_RANGE_FLT, {.rangeFloat = {.min = 0.0, .max = 100.0}} },
+        { "Final Exam Grade", IV_RANGE_FLT, {.rangeFloat = {.min = 0.0, .max = 100.0}} }
+    };
+    const CsvRecordFormat format = {
+        sizeof(Student), (int)(sizeof(studentColumns) / sizeof(studentColumns[0])), studentColumns, buildStudent
+    };
+    return importRecords(path, studentList, report, summary, &format);
+}
@@ -0,0 +1,106 @@
+/**
+ * @file csvimport.h
+ * @brief Bulk CSV/TSV Import Module Header
+ *
+ * This header declares the bulk importers that append employees and
+ * students from comma- or tab-separated text files to a list, for data
+ * sets far larger than the interactive forms can enter.
+ *
+ * File format:
+ * - One record per line; CRLF and LF line ends are both accepted
+ * - Fields separated by tabs if the first line contains a tab, otherwise
+ *   by commas; a field may be quoted with '"' ("" inside is one quote)
+ * - An optional header line, recognized by a first field without digits
+ * - Blank lines are skipped
+ *
+ * Employee columns: number, first name, middle name, last name, status
+ * (R/C), hours worked, basic rate
+ *
+ * Student columns: number, first name, middle name, last name, gender
+ * (M/F), program code, year level, units enrolled, prelim grade, midterm
+ * grade, final exam grade
+ *
+ * Every field is checked with the rules of the Add Employee and Add
+ * Student forms, and names, payroll and final grades are computed the
+ * same way. Rows that fail are not imported; each is written to the
+ * error report with its line number and the reason.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef CSVIMPORT_H
+#define CSVIMPORT_H
+
+// Standard C library includes
+#include <stdio.h>      // For the error report
+#include <stddef.h>     // For size_t
+
+// Application-specific includes
+#include "../../include/headers/list.h"        // Lists that receive the records
+
+/**
+ * @name Import Constants
+ * @brief Buffer sizes of the importer
+ * @{
+ */
+#define csvImportBufferBytes (1 << 20)  // Bytes of the file read at a time
+#define csvImportMaxFields 16           // Fields of a row kept for validation
+#define csvImportFirstBatch 1024        // Records in the first block appended to the list
+#define csvImportMaxBatch 65536         // Records in the largest block appended to the list
+
+/** @} */ // End of Import Constants
+
+/**
+ * @struct CsvImportSummary
+ * @brief Outcome of a bulk import
+ */
+typedef struct {
+    size_t rowCount;        // Data rows read, not counting a header or blank lines
+    size_t importedCount;   // Rows appended to the list
+    size_t rejectedCount;   // Rows written to the error report
+} CsvImportSummary;
+
+/**
+ * @name Bulk Import Functions
+ * @brief Appending records from CSV/TSV files
+ * @{
+ */
+
+/**
+ * @brief Appends the employees of a CSV/TSV file to a list
+ *
+ * The file is read in csvImportBufferBytes chunks and split with a
+ * vectorized scan for delimiters, line ends and quotes. Valid rows are
+ * stored in large blocks owned by the list and appended with
+ * addNodesBulk() as each block fills, so the list is never searched or
+ * grown one record at a time. The list is not sorted afterwards.
+ *
+ * @param path Path of the text file
+ * @param employeeList List that receives the employees
+ * @param report Receives one line per rejected row (may be NULL)
+ * @param summary Receives the row counts
+ * @return 0 if the whole file was read, -1 if it could not be opened or
+ *         read or memory ran out (rows appended before that stay in the list)
+ */
+int importEmployeesFromCsv(const char* path, list* employeeList, FILE* report, CsvImportSummary* summary);
+
+/**
+ * @brief Appends the students of a CSV/TSV file to a list
+ *
+ * Works like importEmployeesFromCsv(). Program codes must be among the
+ * currently configured programs.
+ *
+ * @param path Path of the text file
+ * @param studentList List that receives the students
+ * @param report Receives one line per rejected row (may be NULL)
+ * @param summary Receives the row counts
+ * @return 0 if the whole file was read, -1 if it could not be opened or
+ *         read or memory ran out (rows appended before that stay in the list)
+ */
+int importStudentsFromCsv(const char* path, list* studentList, FILE* report, CsvImportSummary* summary);
+
+/** @} */ // End of Bulk Import Functions
+
+#endif // CSVIMPORT_H
@@ -24,9 +24,7 @@
 #include <stdlib.h>     // For memory allocation and general utilities
 #include <string.h>     // For string manipulation functions
 #include <time.h>       // For timestamp generation
-#ifdef _WIN32
-#include <windows.h>    // For Windows-specific file operations
-#endif
+#include <stddef.h>     // For offsetof
 
 // Application-specific includes
 #include "data.h"                               // Data module header
@@ -34,6 +32,11 @@
 #include "../../include/models/student.h"      // Student data structures
 #include "../../include/headers/list.h"        // Generic linked list implementation
 #include "../../include/headers/apctxt.h"      // Application context and utilities
+#include "../../include/headers/datfile.h"     // Data file header and checksums
+#include "../../include/headers/journal.h"     // Journaled saves
+#include "../../include/headers/delta.h"       // Delta saves
+#include "columnar.h"                           // Columnar student files
+#include "manifest.h"                           // Data directory manifest
 
 /**
  * @name Directory Management Functions
@@ -195,11 +198,31 @@ int generatePayrollReportFile(const list* employeeList, char* generatedFilePath,
 }
 
 // Function to generate student report file
-int generateStudentReportFile(const list* studentList, char* generatedFilePath, const int pathBufferSize) {
+int generateStudentReportFile(const list* studentList, const StudentSortSpec* order, const int orderCount,
+                              char* generatedFilePath, const int pathBufferSize) {
     if (!studentList || !studentList->head || studentList->size == 0) {
         return -1;
     }
     
+    // Rows are written from a sorted view, so the list itself keeps its order
+    SortKey keys[studentSortMaxFields];
+    if (orderCount > 0 && compileStudentSortKeys(order, orderCount, keys) != 0) {
+        return -1;
+    }
+    SortItem* rows = gatherSortItems(studentList);
+    if (!rows) {
+        return -1;
+    }
+    for (int i = 0; i < studentList->size; i++) {
+        if (rows[i].data) {
+            calculateFinalGrade((Student*)rows[i].data); // Grades must be current before ordering by them
+        }
+    }
+    if (orderCount > 0 && sortItemsByKeys(rows, studentList->size, keys, orderCount) != 0) {
+        free(rows);
+        return -1;
+    }
+    
     createOutputDirectory();
     
     char timestamp[32];
@@ -212,6 +235,7 @@ int generateStudentReportFile(const list* studentList, char* generatedFilePath,
     
     FILE *file = fopen(filename, "w");
     if (!file) {
+        free(rows);
         return -1;
     }
     
@@ -247,38 +271,34 @@ int generateStudentReportFile(const list* studentList, char* generatedFilePath,
     fputc('\n', file);
 
     /* ------------------- Table Rows ----------------- */
-    node* current = studentList->head;
     int count = 0;
     double totalFinalGrade = 0.0;
     int passedCount = 0;
     int failedCount = 0;
 
-    if (current) {
-        do {
-            Student* stu = (Student*)current->data;
-            if (stu) {
-                calculateFinalGrade(stu);
-                const char* standingStr = (stu->standing == acadDeansLister) ? "Dean's Lister" : (stu->standing == acadRegular) ? "Regular" : "Probation";
-                fprintf(file, "%-12s  %-*.*s  %-8s  %-4d  %11.2f  %-8s  %-12s\n",
-                        stu->personal.studentNumber,
-                        fullNameWidth, fullNameWidth, stu->personal.name.fullName,
-                        stu->personal.programCode,
-                        stu->personal.yearLevel,
-                        stu->academic.finalGrade,
-                        stu->academic.remarks,
-                        standingStr);
-
-                totalFinalGrade += stu->academic.finalGrade;
-                if (strcmp(stu->academic.remarks, "Passed") == 0) {
-                    passedCount++;
-                } else {
-                    failedCount++;
-                }
-                count++;
+    for (int i = 0; i < studentList->size; i++) {
+        Student* stu = (Student*)rows[i].data;
+        if (stu) {
+            const char* standingStr = (stu->standing == acadDeansLister) ? "Dean's Lister" : (stu->standing == acadRegular) ? "Regular" : "Probation";
+            fprintf(file, "%-12s  %-*.*s  %-8s  %-4d  %11.2f  %-8s  %-12s\n",
+                    stu->personal.studentNumber,
+                    fullNameWidth, fullNameWidth, stu->personal.name.fullName,
+                    stu->personal.programCode,
+                    stu->personal.yearLevel,
+                    stu->academic.finalGrade,
+                    stu->academic.remarks,
+                    standingStr);
+
+            totalFinalGrade += stu->academic.finalGrade;
+            if (strcmp(stu->academic.remarks, "Passed") == 0) {
+                passedCount++;
+            } else {
+                failedCount++;
             }
-            current = current->next;
-        } while (current && current != studentList->head);
+            count++;
+        }
     }
+    free(rows);
 
     /* -------------------- Footer -------------------- */
     for (int i = 0; i < reportWidth; ++i) fputc('-', file);
@@ -293,59 +313,327 @@ int generateStudentReportFile(const list* studentList, char* generatedFilePath,
     }
 
     fprintf(file, "Total students: %d | Passed: %d | Failed: %d\n\n", count, passedCount, failedCount);
+
+    /* ------------------ Dean's List ----------------- */
+    Student* deansList[deansListMaxEntries];
+    int deansListCount = findTopStudents(studentList, deansListMaxEntries, true, deansList);
+    if (deansListCount > 0) {
+        const char* deansTitle = "DEAN'S LIST";
+        margin = (reportWidth - (int)strlen(deansTitle)) / 2;
+        if (margin < 0) margin = 0;
+        fprintf(file, "%*s%s\n\n", margin, "", deansTitle);
+
+        fprintf(file, "%-4s  %-12s  %-*s  %-8s  %-4s  %-11s\n",
+                "Rank", "Student No.", fullNameWidth, "Full Name", "Course", "Year", "Final Grade");
+        for (int i = 0; i < reportWidth; ++i) fputc('-', file);
+        fputc('\n', file);
+
+        for (int i = 0; i < deansListCount; i++) {
+            const Student* stu = deansList[i];
+            fprintf(file, "%-4d  %-12s  %-*.*s  %-8s  %-4d  %11.2f\n",
+                    i + 1,
+                    stu->personal.studentNumber,
+                    fullNameWidth, fullNameWidth, stu->personal.name.fullName,
+                    stu->personal.programCode,
+                    stu->personal.yearLevel,
+                    stu->academic.finalGrade);
+        }
+
+        for (int i = 0; i < reportWidth; ++i) fputc('-', file);
+        fputc('\n', file);
+        fprintf(file, "Dean's Listers shown: %d\n\n", deansListCount);
+    }
+
     fprintf(file, "Report generated by PUP Information Management System\n");
 
     fclose(file);
     return count;
 }
 
-// Complete implementations for file I/O functions
-int saveEmployeeDataFromFile(list* employeeList, const char *filename) {
-    if (!employeeList || !filename) {
+/**
+ * @brief Record formats of the journaled employee and student files
+ */
+static const RecordFormat employeeFormat = {
+    dataFileEmployees, sizeof(Employee), offsetof(Employee, personal.employeeNumber), employeeNumberLen, 0
+};
+static const RecordFormat studentFormat = {
+    dataFileStudents, sizeof(Student), offsetof(Student, personal.studentNumber), studentNumberLen, 0
+};
+
+/**
+ * @brief Reads a run of fixed-size records into one block owned by the list
+ * 
+ * All records are read (and decompressed, for compressed files) into one
+ * allocation sized from the validated header, checked against the header
+ * checksum and handed to the list with adoptDataBlock(), so a large file
+ * costs a handful of allocations instead of two per record.
+ * 
+ * @param file Open data file positioned at the first record
+ * @param dataList List that takes ownership of the block
+ * @param header Header returned by readDataFileHeader()
+ * @param items Receives a malloc'd array of pointers to the records (NULL if there are none)
+ * @return 0 on success, -1 on error or checksum mismatch (the caller destroys the list)
+ */
+static int loadRecordBlock(FILE* file, list* dataList, const DataFileHeader* header, void*** items) {
+    size_t recordSize = header->recordSize;
+    size_t count = header->recordCount;
+    *items = NULL;
+    if (count == 0) {
+        return verifyDataFileChecksum(header, 0);
+    }
+    
+    unsigned char* records = (unsigned char*)malloc(count * recordSize);
+    void** pointers = (void**)malloc(count * sizeof(void*));
+    if (!records || !pointers) {
+        free(records);
+        free(pointers);
         return -1;
     }
     
-    createDataDirectory();
-    
-    char fullPath[256];
-    snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
-    
-    FILE *file = fopen(fullPath, "wb");
-    if (!file) {
+    DataFileReader reader;
+    bool ok = initDataFileReader(&reader, file, header) == 0;
+    ok = ok && readDataFileRecords(&reader, records, count) == 0;
+    closeDataFileReader(&reader);
+    if (!ok || verifyDataFileChecksum(header, crc32c(0, records, count * recordSize)) != 0 ||
+        adoptDataBlock(dataList, records, count * recordSize) != 0) {
+        free(records);
+        free(pointers);
         return -1;
     }
     
-    // Write number of employees
-    int count = employeeList->size;
-    fwrite(&count, sizeof(int), 1, file);
-    
-    // Write each employee record
-    node* current = employeeList->head;
-    int saved = 0;
+    for (size_t i = 0; i < count; i++) {
+        pointers[i] = records + i * recordSize;
+    }
+    *items = pointers;
+    return 0;
+}
+
+/**
+ * @brief Uses the records of a data file in place from a copy-on-write mapping
+ * 
+ * The list owns the mapping and unmaps it when it is destroyed. Only the
+ * node entries are allocated; record pages are read when first touched
+ * and copied into private memory when first modified. The caller
+ * verifies the payload checksum.
+ * 
+ * @param path Path of the data file
+ * @param recordOffset Offset of the first record in the file
+ * @param dataList List that takes ownership of the mapping
+ * @param header Header returned by readDataFileHeader()
+ * @param items Receives a malloc'd array of pointers to the records (NULL if there are none)
+ * @return 0 on success, -1 on error (the caller destroys the list)
+ */
+static int mapRecordBlock(const char* path, int64_t recordOffset, list* dataList, const DataFileHeader* header,
+                          void*** items) {
+    size_t recordSize = header->recordSize;
+    size_t count = header->recordCount;
+    *items = NULL;
+    if (count == 0 || recordOffset < 0) {
+        return (recordOffset < 0) ? -1 : 0;
+    }
+    
+    size_t mappedSize = (size_t)recordOffset + count * recordSize;
+    unsigned char* mapping = (unsigned char*)mapDataFile(path, mappedSize);
+    if (!mapping) {
+        return -1;
+    }
+    if (adoptExternalDataBlock(dataList, mapping, mappedSize, unmapDataFile) != 0) {
+        unmapDataFile(mapping, mappedSize);
+        return -1;
+    }
     
-    if (current != NULL) {
-        do {
-            Employee* emp = (Employee*)current->data;
-            if (emp != NULL) {
-                fwrite(emp, sizeof(Employee), 1, file);
-                saved++;
+    void** pointers = (void**)malloc(count * sizeof(void*));
+    if (!pointers) {
+        return -1;
+    }
+    unsigned char* records = mapping + recordOffset;
+    for (size_t i = 0; i < count; i++) {
+        pointers[i] = records + i * recordSize;
+    }
+    *items = pointers;
+    return 0;
+}
+
+/**
+ * @brief Loads the records of a validated data file and replays its journal
+ * 
+ * Large plain files are mapped instead of read; their checksum is
+ * verified either way. The file's journal, if any, is applied to the
+ * records before they are linked into the list in a single pass. What
+ * the list must be registered with (see registerLoadedList()) is left in
+ * the registration, so that loads on other threads can leave that to
+ * the main thread.
+ * 
+ * @param file Open data file positioned at the first record
+ * @param path Path of the data file
+ * @param dataList List that receives the records
+ * @param header Header returned by readDataFileHeader()
+ * @param format Record format of the file
+ * @param registration Receives the journal or delta tracking the list needs
+ * @return 0 on success, -1 on error (the caller destroys the list)
+ */
+static int loadRecords(FILE* file, const char* path, list* dataList, const DataFileHeader* header,
+                       const RecordFormat* format, DataFileRegistration* registration) {
+    void** items = NULL;
+    size_t count = header->recordCount;
+    size_t payloadSize = count * header->recordSize;
+    
+    // Compressed records cannot be used in place, so they are always read
+    bool mappable = !(header->flags & dataFileCompressed);
+    bool mapped = mappable && payloadSize > 0 && payloadSize >= getMappedLoadThreshold();
+    int result = mapped ? mapRecordBlock(path, tellDataFile(file), dataList, header, &items)
+                        : loadRecordBlock(file, dataList, header, &items);
+    if (result == 0 && mapped &&
+        verifyDataFileChecksum(header, crc32c(0, items[0], payloadSize)) != 0) {
+        result = -1;
+    }
+    
+    JournalReplay replay;
+    if (result == 0) {
+        result = replayJournal(path, header, format, &items, &count, &replay);
+    }
+    if (result == 0 && count > 0 && addNodesBulk(dataList, items, count) != 0) {
+        for (size_t i = 0; i < count; i++) {
+            if (!isOwnedData(dataList, items[i])) {
+                free(items[i]); // Added by the journal and not linked
             }
-            current = current->next;
-        } while (current != employeeList->head && current != NULL);
+        }
+        result = -1;
+    }
+    free(items);
+    
+    memset(registration, 0, sizeof(*registration));
+    if (result == 0 && isJournalEnabled()) {
+        // The journal remembers how the file is stored, so a save in another format rewrites it
+        registration->kind = registerJournal;
+        registration->format = *format;
+        registration->format.fileOptions = header->flags & dataFileOptionMask;
+        registration->replay = replay;
+    } else if (result == 0 && replay.applied == 0 && (header->flags & dataFileIndexed)) {
+        registration->kind = registerDelta;
+    }
+    snprintf(registration->path, sizeof(registration->path), "%s", path);
+    registration->header = *header;
+    return result;
+}
+
+/**
+ * @brief Journals or tracks a loaded list as its load decided
+ * @param dataList The loaded list.
+ * @param registration The registration filled in by the load.
+ */
+void registerLoadedList(list* dataList, const DataFileRegistration* registration) {
+    if (!dataList || !registration) {
+        return;
+    }
+    if (registration->kind == registerJournal) {
+        attachJournal(dataList, registration->path, &registration->format, &registration->header,
+                      &registration->replay);
+    } else if (registration->kind == registerDelta) {
+        trackDataFile(dataList, registration->path, &registration->header);
+    }
+}
+
+/**
+ * @brief Moves the records of a list out of the files they are mapped from
+ * 
+ * Windows refuses to replace or truncate a mapped file, so a list that was
+ * loaded by mapping its file detaches the mapping before it is saved. The
+ * records stay at their addresses. Does nothing on other systems and for
+ * lists that were read.
+ * 
+ * @param dataList List about to be saved
+ * @return 0 on success, -1 on error
+ */
+static int releaseFileMappings(list* dataList) {
+    for (DataBlock* block = dataList->dataBlocks; block != NULL; block = block->next) {
+        if (block->release == unmapDataFile && detachDataFileMapping(block->memory, block->size) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Saves a list of records to a data file under data/
+ * 
+ * With journaling enabled, a list that was loaded from or last saved to
+ * the same file only appends its changes to the file's journal. Otherwise
+ * a list that still matches the file slot by slot only rewrites its dirty
+ * records in place (see delta.h); any other list rewrites the whole file
+ * with writeDataFile(), compressed if compress_saves is enabled. Either
+ * way any journal of the file is removed. Written files always get a key
+ * index over the record numbers for lookupRecordInFile(), and the save is
+ * recorded in the data directory manifest.
+ * 
+ * @param dataList List of fixed-size records
+ * @param filename Name of the file (in data directory)
+ * @param format Record format of the file
+ * @return Number of records saved, or -1 on error
+ */
+static int saveRecordFile(list* dataList, const char* filename, const RecordFormat* format) {
+    createDataDirectory();
+    if (releaseFileMappings(dataList) != 0) {
+        return -1;
     }
     
-    fclose(file);
+    char fullPath[256];
+    snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
+    
+    RecordFormat fileFormat = *format;
+    fileFormat.fileOptions = (isCompressionEnabled() ? dataFileCompressed : 0) | dataFileIndexed;
+    if (isJournalEnabled()) {
+        int saved = saveJournaledList(dataList, fullPath, &fileFormat);
+        if (saved >= 0) {
+            updateDataFileManifest(filename, saved);
+        }
+        return saved;
+    }
+    
+    // Compressed files are always rewritten; their blocks cannot be patched in place
+    detachJournal(dataList);
+    int saved = !(fileFormat.fileOptions & dataFileCompressed) ? saveDataFileDelta(dataList, fullPath) : -1;
+    if (saved < 0) {
+        DataFileHeader header;
+        DataFileKey key = { format->keyOffset, format->keyLength };
+        saved = writeDataFile(dataList, fullPath, format->recordType | fileFormat.fileOptions, format->recordSize,
+                              &key, &header);
+        if (saved >= 0) {
+            trackDataFile(dataList, fullPath, &header);
+        } else {
+            untrackDataFile(dataList);
+        }
+    }
+    if (saved >= 0) {
+        char logPath[300];
+        getJournalPath(fullPath, logPath, sizeof(logPath));
+        remove(logPath);
+        updateDataFileManifest(filename, saved);
+    }
     return saved;
 }
 
-list* loadEmployeeDataFromFile(const char* filename, ListType listType) {
+// Complete implementations for file I/O functions
+int saveEmployeeDataFromFile(list* employeeList, const char *filename) {
+    if (!employeeList || !filename) {
+        return -1;
+    }
+    return saveRecordFile(employeeList, filename, &employeeFormat);
+}
+
+/**
+ * @brief Loads an employee file without registering the list
+ * @param filename The name of the file in the data directory.
+ * @param listType The type of list to create.
+ * @param registration Receives what registerLoadedList() must do for the list.
+ * @return The new list, or NULL on error.
+ */
+static list* loadEmployeeFile(const char* filename, ListType listType, DataFileRegistration* registration) {
+    memset(registration, 0, sizeof(*registration));
     if (!filename) {
         return NULL;
     }
     
-    // Note: listType parameter reserved for future list type handling
-    (void)listType; // Suppress unused parameter warning
-    
     char fullPath[256];
     snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
     
@@ -354,94 +642,78 @@ list* loadEmployeeDataFromFile(const char* filename, ListType listType) {
         return NULL;
     }
     
-    // Read number of employees
-    int count;
-    if (fread(&count, sizeof(int), 1, file) != 1) {
+    // Reject foreign, truncated or mismatched files before allocating anything
+    DataFileHeader header;
+    if (readDataFileHeader(file, dataFileEmployees, sizeof(Employee), NULL, 0, &header) != 0) {
         fclose(file);
         return NULL;
     }
     
     // Create new list
     list* employeeList = NULL;
-    if (createEmployeeList(&employeeList) != 0) {
+    if (createEmployeeListOfType(&employeeList, listType) != 0) {
         fclose(file);
         return NULL;
     }
     
-    // Read each employee record
-    for (int i = 0; i < count; i++) {
-        Employee* emp = (Employee*)malloc(sizeof(Employee));
-        if (!emp) {
-            fclose(file);
-            destroyList(&employeeList, freeEmployee);
-            return NULL;
-        }
-        
-        if (fread(emp, sizeof(Employee), 1, file) != 1) {
-            free(emp);
-            fclose(file);
-            destroyList(&employeeList, freeEmployee);
-            return NULL;
-        }
-        
-        if (createEmployee(emp, &employeeList) != 0) {
-            free(emp);
-            fclose(file);
-            destroyList(&employeeList, freeEmployee);
-            return NULL;
-        }
+    // Read all employee records into one block (or map them) and link them in a single pass
+    if (loadRecords(file, fullPath, employeeList, &header, &employeeFormat, registration) != 0) {
+        fclose(file);
+        destroyList(&employeeList, freeEmployee);
+        return NULL;
     }
     
     fclose(file);
     return employeeList;
 }
 
+list* loadEmployeeDataFromFile(const char* filename, ListType listType) {
+    DataFileRegistration registration;
+    list* employeeList = loadEmployeeFile(filename, listType, &registration);
+    registerLoadedList(employeeList, &registration);
+    return employeeList;
+}
+
 int saveStudentDataFromFile(list* studentList, const char *filename) {
     if (!studentList || !filename) {
         return -1;
     }
     
-    createDataDirectory();
-    
-    char fullPath[256];
-    snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
-    
-    FILE *file = fopen(fullPath, "wb");
-    if (!file) {
+    // A columnar file stays columnar; rewriting it as rows would lose the fast grade summary
+    if (isStudentColumnFile(filename)) {
+        return saveStudentColumnDataFromFile(studentList, filename);
+    }
+    return saveRecordFile(studentList, filename, &studentFormat);
+}
+
+int saveStudentColumnDataFromFile(list* studentList, const char* filename) {
+    if (!studentList || !filename) {
         return -1;
     }
-    
-    // Write number of students
-    int count = studentList->size;
-    fwrite(&count, sizeof(int), 1, file);
-    
-    // Write each student record
-    node* current = studentList->head;
-    int saved = 0;
-    
-    if (current != NULL) {
-        do {
-            Student* stu = (Student*)current->data;
-            if (stu != NULL) {
-                fwrite(stu, sizeof(Student), 1, file);
-                saved++;
-            }
-            current = current->next;
-        } while (current != studentList->head && current != NULL);
+    createDataDirectory();
+    if (releaseFileMappings(studentList) != 0) {
+        return -1;
     }
     
-    fclose(file);
-    return saved;
+    // Columnar files have no journal or delta saves; the next save writes every column again
+    detachJournal(studentList);
+    untrackDataFile(studentList);
+    return saveStudentColumnFile(studentList, filename);
 }
 
-list* loadStudentDataFromFile(const char* filename, ListType listType) {
+/**
+ * @brief Loads a student file without registering the list
+ * @param filename The name of the file in the data directory.
+ * @param listType The type of list to create.
+ * @param registration Receives what registerLoadedList() must do for the list.
+ * @return The new list, or NULL on error.
+ */
+static list* loadStudentFile(const char* filename, ListType listType, DataFileRegistration* registration) {
+    memset(registration, 0, sizeof(*registration));
     if (!filename) {
         return NULL;
     }
     
-    // Note: listType parameter reserved for future list type handling
-    (void)listType; // Suppress unused parameter warning
-    
     char fullPath[256];
     snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
     
@@ -450,158 +722,104 @@ list* loadStudentDataFromFile(const char* filename, ListType listType) {
         return NULL;
     }
     
-    // Read number of students
-    int count;
-    if (fread(&count, sizeof(int), 1, file) != 1) {
+    // Reject foreign, truncated or mismatched files before allocating anything
+    DataFileHeader header;
+    if (readDataFileHeader(file, dataFileStudents, sizeof(Student), NULL, 0, &header) != 0) {
         fclose(file);
-        return NULL;
+        return isStudentColumnFile(filename) ? loadStudentColumnFile(filename, listType) : NULL;
     }
     
     // Create new list
     list* studentList = NULL;
-    if (createStudentList(&studentList) != 0) {
+    if (createStudentListOfType(&studentList, listType) != 0) {
         fclose(file);
         return NULL;
     }
     
-    // Read each student record
-    for (int i = 0; i < count; i++) {
-        Student* stu = (Student*)malloc(sizeof(Student));
-        if (!stu) {
-            fclose(file);
-            destroyList(&studentList, freeStudent);
-            return NULL;
-        }
-        
-        if (fread(stu, sizeof(Student), 1, file) != 1) {
-            free(stu);
-            fclose(file);
-            destroyList(&studentList, freeStudent);
-            return NULL;
-        }
-        
-        if (createStudent(stu, &studentList) != 0) {
-            free(stu);
-            fclose(file);
-            destroyList(&studentList, freeStudent);
-            return NULL;
-        }
+    // Read all student records into one block (or map them) and link them in a single pass
+    if (loadRecords(file, fullPath, studentList, &header, &studentFormat, registration) != 0) {
+        fclose(file);
+        destroyList(&studentList, freeStudent);
+        return NULL;
     }
     
     fclose(file);
     return studentList;
 }
 
-// Function to find the middle node of a linked list using fast/slow pointer approach
-static node* findMiddleNode(node* head, node* tail) {
-    if (!head || head == tail) {
-        return head;
-    }
-    
-    node* slow = head;
-    node* fast = head->next;
-    
-    // Fast pointer moves twice as fast as slow pointer
-    while (fast != tail && fast->next != tail) {
-        slow = slow->next;
-        fast = fast->next->next;
-    }
-    
-    return slow;
-}
-
-// Function to merge two sorted linked lists
-static node* mergeSortedLists(node* left, node* right, node* tail, int descending, 
-                             int (*compareFunc)(void*, void*, int)) {
-    node dummy;
-    node* current = &dummy;
-    
-    // Merge the two lists
-    while (left != NULL && right != NULL && left != tail && right != tail) {
-        if (compareFunc(left->data, right->data, descending)) {
-            current->next = left;
-            left = left->next;
-        } else {
-            current->next = right;
-            right = right->next;
-        }
-        current = current->next;
-    }
-    
-    // Attach the remaining nodes
-    if (left != NULL && left != tail) {
-        current->next = left;
-    } else if (right != NULL && right != tail) {
-        current->next = right;
-    }
-    
-    return dummy.next;
+list* loadStudentDataFromFile(const char* filename, ListType listType) {
+    DataFileRegistration registration;
+    list* studentList = loadStudentFile(filename, listType, &registration);
+    registerLoadedList(studentList, &registration);
+    return studentList;
 }
 
-// Compare function for student grades
-static int compareStudentGrades(void* data1, void* data2, int descending) {
-    Student* stu1 = (Student*)data1;
-    Student* stu2 = (Student*)data2;
-    
-    if (descending) {
-        return stu1->academic.finalGrade >= stu2->academic.finalGrade;
-    } else {
-        return stu1->academic.finalGrade <= stu2->academic.finalGrade;
-    }
+/**
+ * @brief Orders students by final grade, lowest first
+ * @param stu1 Pointer to the first student
+ * @param stu2 Pointer to the second student
+ * @return Negative if stu1 has the lower grade, 0 if equal, positive otherwise
+ */
+static int compareStudentByGradeAscending(const void* stu1, const void* stu2) {
+    float grade1 = ((const Student*)stu1)->academic.finalGrade;
+    float grade2 = ((const Student*)stu2)->academic.finalGrade;
+    return (grade1 > grade2) - (grade1 < grade2);
 }
 
-// Recursive merge sort implementation for linked list
-static node* mergeSortList(node* head, node* tail, int descending, 
-                          int (*compareFunc)(void*, void*, int)) {
-    // Base case: empty list or single node
-    if (!head || head == tail || head->next == tail) {
-        return head;
+int sortStudentsByGrade(list* studentList, const int descending) {
+    if (!studentList || studentList->size <= 1) {
+        return 0;
     }
     
-    // Find the middle node
-    node* middle = findMiddleNode(head, tail);
-    node* right = middle->next;
-    
-    // Split the list into two halves
-    middle->next = NULL;
+    // The radix sort beats the comparator sort on one thread; threads only pay
+    // off once every one of them gets a full run (measured by bench/sort_bench.c)
+    int threads = getSortThreads();
+    if (threads > 1 && studentList->size >= threads * listParallelSortMinRun) {
+        // Descending order uses the ranking comparator so both views agree on ties
+        if (sortListParallel(studentList, descending ? compareStudentByGrade : compareStudentByGradeAscending,
+                             true, threads) != 0) {
+            return 0;
+        }
+        journalListReordered(studentList);
+        return 1;
+    }
     
-    // Recursively sort both halves
-    node* leftSorted = mergeSortList(head, NULL, descending, compareFunc);
-    node* rightSorted = mergeSortList(right, tail, descending, compareFunc);
+    // Radix sort on the grade, then the student number like compareStudentByGrade()
+    StudentSortSpec byGrade[2] = {
+        { STUDENT_SORT_FINAL_GRADE, descending != 0 },
+        { STUDENT_SORT_NUMBER, false }
+    };
+    if (sortStudentsBySpec(studentList, byGrade, descending ? 2 : 1) != 0) {
+        return 0;
+    }
     
-    // Merge the sorted halves
-    return mergeSortedLists(leftSorted, rightSorted, tail, descending, compareFunc);
+    return 1;
 }
 
-int sortStudentsByGrade(list* studentList, const int descending) {
-    if (!studentList || studentList->size <= 1) {
+/**
+ * @brief Copies the names of the data files matching a pattern
+ * @param pattern File pattern to match in the data directory
+ * @param fileNames Receives the file names, sorted
+ * @param maxFiles Capacity of the fileNames array
+ * @return Number of names copied
+ */
+static int getDataFileNames(const char* pattern, char fileNames[][256], int maxFiles) {
+    if (!fileNames || maxFiles <= 0) {
         return 0;
     }
     
-    // Handle circular lists by temporarily breaking the circle
-    node* oldTail = NULL;
-    
-    if (studentList->type == SINGLY_CIRCULAR || studentList->type == DOUBLY_CIRCULAR) {
-        oldTail = studentList->tail;
-        studentList->tail->next = NULL;  // Break the circle
-    }
-    
-    // Apply merge sort
-    studentList->head = mergeSortList(studentList->head, NULL, descending, compareStudentGrades);
+    createDataDirectory();
     
-    // Update the tail pointer
-    node* current = studentList->head;
-    while (current && current->next) {
-        current = current->next;
+    AppFileInfo* files = NULL;
+    int fileCount = appScanDirectory("data", pattern, &files);
+    if (fileCount > maxFiles) {
+        fileCount = maxFiles;
     }
-    studentList->tail = current;
-    
-    // Restore circular structure if needed
-    if (oldTail) {
-        studentList->tail->next = studentList->head;  // Restore the circle
+    for (int i = 0; i < fileCount; i++) {
+        memcpy(fileNames[i], files[i].name, sizeof(files[i].name));
     }
-    
-    return 1;
+    free(files);
+    return (fileCount > 0) ? fileCount : 0;
 }
 
 int listEmployeeDataFiles(void) {
@@ -615,36 +833,7 @@ int listEmployeeDataFiles(void) {
 }
 
 int getEmployeeDataFileNames(char fileNames[][256], int maxFiles) {
-    if (!fileNames || maxFiles <= 0) {
-        return 0;
-    }
-    
-    createDataDirectory();
-    
-    // Construct the search path
-    char searchPath[512];
-    snprintf(searchPath, sizeof(searchPath), "data\\*employee*.dat");
-    
-    WIN32_FIND_DATA findFileData;
-    HANDLE hFind = FindFirstFile(searchPath, &findFileData);
-    
-    if (hFind == INVALID_HANDLE_VALUE) {
-        return 0; // No files found
-    }
-    
-    int fileCount = 0;
-    
-    do {
-        // Skip directories and ensure we don't exceed maxFiles
-        if (!(findFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && fileCount < maxFiles) {
-            strncpy(fileNames[fileCount], findFileData.cFileName, 255);
-            fileNames[fileCount][255] = '\0'; // Ensure null termination
-            fileCount++;
-        }
-    } while (FindNextFile(hFind, &findFileData) != 0 && fileCount < maxFiles);
-    
-    FindClose(hFind);
-    return fileCount;
+    return getDataFileNames("*employee*.dat", fileNames, maxFiles);
 }
 
 int listStudentDataFiles(void) {
@@ -658,36 +847,7 @@ int listStudentDataFiles(void) {
 }
 
 int getStudentDataFileNames(char fileNames[][256], int maxFiles) {
-    if (!fileNames || maxFiles <= 0) {
-        return 0;
-    }
-    
-    createDataDirectory();
-    
-    // Construct the search path
-    char searchPath[512];
-    snprintf(searchPath, sizeof(searchPath), "data\\*student*.dat");
-    
-    WIN32_FIND_DATA findFileData;
-    HANDLE hFind = FindFirstFile(searchPath, &findFileData);
-    
-    if (hFind == INVALID_HANDLE_VALUE) {
-        return 0; // No files found
-    }
-    
-    int fileCount = 0;
-    
-    do {
-        // Skip directories and ensure we don't exceed maxFiles
-        if (!(findFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && fileCount < maxFiles) {
-            strncpy(fileNames[fileCount], findFileData.cFileName, 255);
-            fileNames[fileCount][255] = '\0'; // Ensure null termination
-            fileCount++;
-        }
-    } while (FindNextFile(hFind, &findFileData) != 0 && fileCount < maxFiles);
-    
-    FindClose(hFind);
-    return fileCount;
+    return getDataFileNames("*student*.dat", fileNames, maxFiles);
 }
 
 int saveListWithCustomName(list* dataList, const char* listName, const char* dataType) {
@@ -720,4 +880,72 @@ list* loadListWithName(const char* filename, const char* dataType, ListType list
     }
     
     return NULL;
-} 
\ No newline at end of file
+} 
+
+list* loadListUnregistered(const char* filename, const char* dataType, ListType listType,
+                           DataFileRegistration* registration) {
+    if (!registration) {
+        return NULL;
+    }
+    memset(registration, 0, sizeof(*registration));
+    if (!filename || !dataType) {
+        return NULL;
+    }
+    
+    if (strcmp(dataType, "employee") == 0) {
+        return loadEmployeeFile(filename, listType, registration);
+    } else if (strcmp(dataType, "student") == 0) {
+        return loadStudentFile(filename, listType, registration);
+    }
+    
+    return NULL;
+}
+
+int lookupRecordInFile(const char* filename, const char* dataType, const char* key, void* record) {
+    if (!filename || !dataType || !key || !record) {
+        return -1;
+    }
+    
+    const RecordFormat* format = NULL;
+    if (strcmp(dataType, "employee") == 0) {
+        format = &employeeFormat;
+    } else if (strcmp(dataType, "student") == 0) {
+        format = &studentFormat;
+    } else {
+        return -1;
+    }
+    
+    char fullPath[256];
+    snprintf(fullPath, sizeof(fullPath), "data/%s", filename);
+    
+    FILE* file = fopen(fullPath, "rb");
+    if (!file) {
+        return -1;
+    }
+    DataFileHeader header;
+    if (readDataFileHeader(file, format->recordType, format->recordSize, NULL, 0, &header) != 0) {
+        fclose(file);
+        return -1;
+    }
+    
+    // Only the index run holding the key and the record itself are read
+    DataFileKey field = { format->keyOffset, format->keyLength };
+    size_t slot = 0;
+    bool duplicated = false;
+    int found = findDataFileKey(file, &header, &field, key, &slot, &duplicated);
+    if (found == 1 && (readDataFileRecord(file, &header, slot, record) != 0 ||
+                       strncmp((const char*)record + format->keyOffset, key, format->keyLength) != 0)) {
+        found = -1; // The index does not match the records
+    }
+    fclose(file);
+    if (found < 0) {
+        return -1;
+    }
+    
+    // Changes journaled since the base was written still apply
+    size_t matches = (found == 0) ? 0 : (duplicated ? 2 : 1);
+    if (replayJournalRecord(fullPath, &header, format, key, record, &matches) != 0) {
+        return -1;
+    }
+    return (matches > 0) ? 1 : 0;
+}
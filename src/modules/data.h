@@ -29,6 +29,30 @@
 #include "../../include/headers/list.h"        // Generic linked list implementation
 #include "../../include/models/employee.h"    // Employee data structures
 #include "../../include/models/student.h"     // Student data structures
+#include "../../include/headers/datfile.h"     // Data file headers
+#include "../../include/headers/journal.h"     // Record formats and journal replays
+
+/**
+ * @enum DataFileRegistrationKind
+ * @brief How a loaded list keeps following its file
+ */
+typedef enum {
+    registerNothing,    // Neither journaled nor tracked (columnar and legacy files)
+    registerJournal,    // Journaled with attachJournal()
+    registerDelta       // Tracked for delta saves with trackDataFile()
+} DataFileRegistrationKind;
+
+/**
+ * @struct DataFileRegistration
+ * @brief What a load leaves for registerLoadedList()
+ */
+typedef struct DataFileRegistration {
+    DataFileRegistrationKind kind;  // What the list is registered with
+    char path[256];                 // Path of the data file
+    DataFileHeader header;          // Header of the data file
+    RecordFormat format;            // Record format with the file's options (journal only)
+    JournalReplay replay;           // Where the file's journal ended (journal only)
+} DataFileRegistration;
 
 /**
  * @name Common Data Management Functions
@@ -84,8 +108,13 @@ int generatePayrollReportFile(const list* employeeList, char* generatedFilePath,
  * @brief Saves employee list data to a binary file
  * 
  * Serializes the entire employee list to a binary file for efficient
- * storage and later retrieval. The file format includes metadata
- * and individual employee records.
+ * storage and later retrieval. The file starts with a DataFileHeader
+ * (see datfile.h) holding the record count and a CRC32C of the
+ * individual employee records that follow it.
+ * The file is written under a temporary name and renamed into place
+ * once complete. With journal_saves enabled, saving a list back to the
+ * file it was loaded from only appends its changes to the file's
+ * journal (see journal.h).
  * 
  * @param employeeList Pointer to the employee list to save
  * @param filename Name of the file to save to (will be placed in data directory)
@@ -97,7 +126,17 @@ int saveEmployeeDataFromFile(list* employeeList, const char* filename);
  * @brief Loads employee data from a binary file
  * 
  * Reads employee records from a binary file and reconstructs the
- * employee list. Creates a new list with the specified type.
+ * employee list. Creates a new list with the specified type. Files with
+ * a wrong magic number, version, record type or size, a size that does
+ * not match the record count, or a checksum mismatch are rejected.
+ * Headerless files from older versions are still loaded.
+ * 
+ * Files with at least getMappedLoadThreshold() bytes of records are
+ * memory-mapped copy-on-write instead of read: the records are used in
+ * place, so loading costs only the node entries and the file's pages
+ * stay in the page cache until touched. Modified records are copied
+ * into private memory and never written back to the file. The checksum
+ * of a mapped file is verified like that of a read file.
  * 
  * @param filename Name of the file to load from (in data directory)
  * @param listType Type of linked list to create for the loaded data
@@ -120,19 +159,33 @@ list* loadEmployeeDataFromFile(const char* filename, ListType listType);
  * student details, grades, academic standing, and statistics.
  * The report is saved with a timestamp-based filename.
  * 
+ * The rows can be ordered by any StudentSortSpec, e.g. program, year
+ * level, final grade descending and last name for registrar reports.
+ * The rows are radix sorted on packed keys in a separate view, so the
+ * list keeps its own order.
+ * 
  * @param studentList Pointer to the student list to generate report from
+ * @param order Fields to order the rows by, most significant first (NULL for list order)
+ * @param orderCount Number of fields in order (0 for list order)
  * @param generatedFilePath Buffer to store the generated file path
  * @param pathBufferSize Size of the file path buffer
  * @return Number of students included in report, or negative on error
  */
-int generateStudentReportFile(const list* studentList, char* generatedFilePath, const int pathBufferSize);
+int generateStudentReportFile(const list* studentList, const StudentSortSpec* order, const int orderCount,
+                              char* generatedFilePath, const int pathBufferSize);
 
 /**
  * @brief Saves student list data to a binary file
  * 
  * Serializes the entire student list to a binary file for efficient
- * storage and later retrieval. The file format includes metadata
- * and individual student records.
+ * storage and later retrieval. The file starts with a DataFileHeader
+ * (see datfile.h) holding the record count and a CRC32C of the
+ * individual student records that follow it.
+ * The file is written under a temporary name and renamed into place
+ * once complete. With journal_saves enabled, saving a list back to the
+ * file it was loaded from only appends its changes to the file's
+ * journal (see journal.h). An existing columnar file (see columnar.h)
+ * is saved with saveStudentColumnDataFromFile() and stays columnar.
  * 
  * @param studentList Pointer to the student list to save
  * @param filename Name of the file to save to (will be placed in data directory)
@@ -140,11 +193,38 @@ int generateStudentReportFile(const list* studentList, char* generatedFilePath,
  */
 int saveStudentDataFromFile(list* studentList, const char* filename);
 
+/**
+ * @brief Saves student data to a columnar file
+ * 
+ * Writes the list with saveStudentColumnFile(): every field is stored
+ * as one contiguous column, so summarizeStudentColumnFile() computes
+ * grade statistics from the exam grade columns alone. Saving to a row
+ * file converts it; later saves with saveStudentDataFromFile() keep
+ * the columnar format. Columnar files are always rewritten in full,
+ * so the list is detached from any journal and delta tracking.
+ * 
+ * @param studentList Pointer to the student list to save
+ * @param filename Name of the file to save to (will be placed in data directory)
+ * @return Number of records saved, or negative on error
+ */
+int saveStudentColumnDataFromFile(list* studentList, const char* filename);
+
 /**
  * @brief Loads student data from a binary file
  * 
  * Reads student records from a binary file and reconstructs the
- * student list. Creates a new list with the specified type.
+ * student list. Creates a new list with the specified type. Files with
+ * a wrong magic number, version, record type or size, a size that does
+ * not match the record count, or a checksum mismatch are rejected.
+ * Headerless files from older versions are still loaded.
+ * 
+ * Files with at least getMappedLoadThreshold() bytes of records are
+ * memory-mapped copy-on-write instead of read: the records are used in
+ * place, so loading costs only the node entries and the file's pages
+ * stay in the page cache until touched. Modified records are copied
+ * into private memory and never written back to the file. The checksum
+ * of a mapped file is verified like that of a read file. Columnar
+ * student files (see columnar.h) are loaded with loadStudentColumnFile().
  * 
  * @param filename Name of the file to load from (in data directory)
  * @param listType Type of linked list to create for the loaded data
@@ -155,12 +235,16 @@ list* loadStudentDataFromFile(const char* filename, ListType listType);
 /**
  * @brief Sorts students by final grade
  * 
- * Sorts the student list based on final grades using an efficient
- * sorting algorithm. Can sort in ascending or descending order.
+ * Sorts the student list based on final grades by radix sorting the
+ * grades with sortListByKeys(). With more than one sort_threads
+ * configured, lists large enough to give every thread
+ * listParallelSortMinRun students use the stable sortListParallel()
+ * instead. Can sort in ascending or descending order; descending order
+ * breaks ties by student number like compareStudentByGrade().
  * 
  * @param studentList Pointer to the student list to sort
  * @param descending 1 for descending order (highest grades first), 0 for ascending
- * @return 0 on success, non-zero on error
+ * @return 1 if the list was sorted, 0 if there was nothing to sort or on error
  */
 int sortStudentsByGrade(list* studentList, const int descending);
 
@@ -244,6 +328,51 @@ int saveListWithCustomName(list* dataList, const char* listName, const char* dat
  */
 list* loadListWithName(const char* filename, const char* dataType, ListType listType);
 
+/**
+ * @brief Loads a list like loadListWithName() but leaves its registration to the caller
+ * 
+ * The journal and delta registries are not thread-safe, so loads on
+ * other threads call this and the main thread passes the registration
+ * to registerLoadedList() afterwards.
+ * 
+ * @param filename Name of the file to load
+ * @param dataType Type identifier ("employee" or "student")
+ * @param listType Type of linked list to create
+ * @param registration Receives what registerLoadedList() must do for the list
+ * @return Pointer to loaded list, or NULL on error
+ */
+list* loadListUnregistered(const char* filename, const char* dataType, ListType listType,
+                           DataFileRegistration* registration);
+
+/**
+ * @brief Journals or delta-tracks a list loaded by loadListUnregistered()
+ * 
+ * Must be called from the main thread before the list is changed or saved.
+ * 
+ * @param dataList The loaded list
+ * @param registration The registration filled in by the load
+ */
+void registerLoadedList(list* dataList, const DataFileRegistration* registration);
+
+/**
+ * @brief Looks up one record of a saved list by its number
+ * 
+ * Uses the key index at the end of the data file (see datfile.h) to read
+ * only the record with the given employee or student number instead of
+ * loading the whole file, then applies the file's journal to it. Files
+ * saved before the index existed, and the rare journal changes that
+ * cannot be followed for a single record, make the lookup decline; the
+ * caller can then load the file and search the list.
+ * 
+ * @param filename Name of the file (in data directory)
+ * @param dataType Type identifier ("employee" or "student")
+ * @param key Employee or student number to look up
+ * @param record Receives the Employee or Student if one is found
+ * @return 1 if the record was found, 0 if the file has no record with the
+ *         number, -1 if the file cannot be searched without loading it
+ */
+int lookupRecordInFile(const char* filename, const char* dataType, const char* key, void* record);
+
 /** @} */ // End of Multi-List Management Functions
 
 #endif // DATA_H 
\ No newline at end of file
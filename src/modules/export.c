@@ -0,0 +1,496 @@
+/**
+ * @file export.c
+ * @brief Streaming CSV and JSON Lines Export
+ *
+ * This file implements the exporters for employee lists, student lists
+ * and course catalogs. Each row is formatted straight into a fixed write
+ * buffer by small field writers that know both formats, so the column
+ * list of a record type is written once and serves for the CSV header,
+ * CSV rows and JSON objects alike. Numbers are converted by hand; printf
+ * would parse a format string for every field.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For file output and remove
+#include <stdlib.h>     // For memory allocation
+#include <string.h>     // For memcpy, memchr and strlen
+#include <stdbool.h>    // For boolean data type support
+#include <math.h>       // For rint, isfinite and signbit
+
+// Application-specific includes
+#include "export.h"                             // Export module header
+#include "data.h"                               // For getCurrentTimestamp
+#include "../../include/headers/apctxt.h"      // For appCreateDirectory
+#include "../../include/headers/datfile.h"     // For syncDataFile and replaceDataFile
+#include "../../include/models/employee.h"     // Employee records
+#include "../../include/models/student.h"      // Student records
+
+/**
+ * @brief Output buffer and row state of one export
+ */
+typedef struct {
+    FILE* file;             // Temporary file receiving the text
+    char* buffer;           // exportBufferBytes of text not yet written
+    size_t used;            // Bytes of the buffer in use
+    ExportFormat format;    // Format being written
+    bool header;            // Fields write their column names instead of values
+    int fieldCount;         // Fields written to the current row
+    bool failed;            // A write failed; the export is abandoned at the end
+} ExportWriter;
+
+/**
+ * @brief Writes a record of the list as one row.
+ */
+typedef void (*ExportRowWriter)(ExportWriter* writer, const void* record);
+
+/**
+ * @brief Writes the buffered text to the file.
+ * @param writer The export writer.
+ */
+static void flushExport(ExportWriter* writer) {
+    if (writer->used > 0 && !writer->failed &&
+        fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used) {
+        writer->failed = true;
+    }
+    writer->used = 0;
+}
+
+/**
+ * @brief Starts a field, writing the separator and in JSON the key.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param valueBytes The most bytes the value can take.
+ * @return Where the value goes, or NULL for the header row (the name was written instead).
+ */
+static char* beginField(ExportWriter* writer, const char* name, size_t valueBytes) {
+    size_t nameLength = strlen(name);
+    if (writer->used + nameLength + valueBytes + 4 > exportBufferBytes) {
+        flushExport(writer);
+    }
+    char* out = writer->buffer + writer->used;
+
+    if (writer->fieldCount++ > 0) {
+        *out++ = ',';
+    }
+    if (writer->header) {
+        memcpy(out, name, nameLength);
+        writer->used = (size_t)(out + nameLength - writer->buffer);
+        return NULL;
+    }
+    if (writer->format == exportJsonLines) {
+        *out++ = '"';
+        memcpy(out, name, nameLength);
+        out += nameLength;
+        *out++ = '"';
+        *out++ = ':';
+    }
+    return out;
+}
+
+/**
+ * @brief Ends a field started with beginField().
+ * @param writer The export writer.
+ * @param out The end of the value.
+ */
+static void endField(ExportWriter* writer, char* out) {
+    writer->used = (size_t)(out - writer->buffer);
+}
+
+/**
+ * @brief Writes the digits of an unsigned number.
+ * @param out Where the digits go.
+ * @param value The number.
+ * @return The end of the digits.
+ */
+static char* formatUnsigned(char* out, unsigned long long value) {
+    char digits[20];
+    int count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count > 0) {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+/**
+ * @brief Writes a text field, quoted in CSV only when it has to be.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param text The text.
+ * @param length The length of the text.
+ */
+static void writeText(ExportWriter* writer, const char* name, const char* text, size_t length) {
+    char* out = beginField(writer, name, length * 6 + 2);
+    if (!out) {
+        return;
+    }
+
+    if (writer->format == exportJsonLines) {
+        static const char hexDigits[] = "0123456789abcdef";
+        *out++ = '"';
+        for (size_t i = 0; i < length; i++) {
+            unsigned char c = (unsigned char)text[i];
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                *out++ = (char)c;
+            } else if (c == '"' || c == '\\') {
+                *out++ = '\\';
+                *out++ = (char)c;
+            } else if (c == '\n') {
+                *out++ = '\\';
+                *out++ = 'n';
+            } else if (c == '\r') {
+                *out++ = '\\';
+                *out++ = 'r';
+            } else if (c == '\t') {
+                *out++ = '\\';
+                *out++ = 't';
+            } else {
+                memcpy(out, "\\u00", 4);
+                out[4] = hexDigits[c >> 4];
+                out[5] = hexDigits[c & 0x0F];
+                out += 6;
+            }
+        }
+        *out++ = '"';
+    } else {
+        bool quoted = false;
+        for (size_t i = 0; i < length && !quoted; i++) {
+            char c = text[i];
+            quoted = (c == ',' || c == '"' || c == '\n' || c == '\r');
+        }
+        if (!quoted) {
+            memcpy(out, text, length);
+            out += length;
+        } else {
+            *out++ = '"';
+            for (size_t i = 0; i < length; i++) {
+                if (text[i] == '"') {
+                    *out++ = '"';
+                }
+                *out++ = text[i];
+            }
+            *out++ = '"';
+        }
+    }
+    endField(writer, out);
+}
+
+/**
+ * @brief Writes a fixed-size character array field.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param text The array; it need not be terminated if it is full.
+ * @param capacity The size of the array.
+ */
+static void writeTextField(ExportWriter* writer, const char* name, const char* text, size_t capacity) {
+    const char* end = (const char*)memchr(text, '\0', capacity);
+    writeText(writer, name, text, end ? (size_t)(end - text) : capacity);
+}
+
+/**
+ * @brief Writes a field holding one of the fixed words of an enumeration.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param word The word.
+ */
+static void writeWordField(ExportWriter* writer, const char* name, const char* word) {
+    writeText(writer, name, word, strlen(word));
+}
+
+/**
+ * @brief Writes an integer field.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param value The value.
+ */
+static void writeIntegerField(ExportWriter* writer, const char* name, long long value) {
+    char* out = beginField(writer, name, 21);
+    if (!out) {
+        return;
+    }
+    unsigned long long magnitude = (unsigned long long)value;
+    if (value < 0) {
+        *out++ = '-';
+        magnitude = 0ULL - magnitude;
+    }
+    endField(writer, formatUnsigned(out, magnitude));
+}
+
+/**
+ * @brief Writes an amount or grade field with two decimals, as "%.2f" would.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param value The value.
+ */
+static void writeDecimalField(ExportWriter* writer, const char* name, float value) {
+    char* out = beginField(writer, name, 48);
+    if (!out) {
+        return;
+    }
+    if (!isfinite(value)) {
+        if (writer->format == exportJsonLines) {
+            memcpy(out, "null", 4);
+            out += 4;
+        }
+        endField(writer, out);
+        return;
+    }
+
+    // A float times 100 is exact in a double, so rint() rounds the true
+    // value, ties to even, the same way printf does
+    double cents = fabs(rint((double)value * 100.0));
+    if (cents >= 1e18) {
+        out += snprintf(out, 48, "%.2f", value); // Beyond 64-bit cents; never a real amount
+        endField(writer, out);
+        return;
+    }
+    unsigned long long magnitude = (unsigned long long)cents;
+    if (signbit(value)) {
+        *out++ = '-';
+    }
+    out = formatUnsigned(out, magnitude / 100);
+    out[0] = '.';
+    out[1] = (char)('0' + magnitude / 10 % 10);
+    out[2] = (char)('0' + magnitude % 10);
+    endField(writer, out + 3);
+}
+
+/**
+ * @brief Writes a true/false field.
+ * @param writer The export writer.
+ * @param name The column name.
+ * @param value The value.
+ */
+static void writeBooleanField(ExportWriter* writer, const char* name, bool value) {
+    char* out = beginField(writer, name, 5);
+    if (!out) {
+        return;
+    }
+    const char* word = value ? "true" : "false";
+    size_t length = value ? 4 : 5;
+    memcpy(out, word, length);
+    endField(writer, out + length);
+}
+
+/**
+ * @brief Starts a row.
+ * @param writer The export writer.
+ */
+static void beginRow(ExportWriter* writer) {
+    writer->fieldCount = 0;
+    if (writer->format == exportJsonLines && !writer->header) {
+        if (writer->used + 1 > exportBufferBytes) {
+            flushExport(writer);
+        }
+        writer->buffer[writer->used++] = '{';
+    }
+}
+
+/**
+ * @brief Ends a row.
+ * @param writer The export writer.
+ */
+static void endRow(ExportWriter* writer) {
+    if (writer->used + 2 > exportBufferBytes) {
+        flushExport(writer);
+    }
+    if (writer->format == exportJsonLines && !writer->header) {
+        writer->buffer[writer->used++] = '}';
+    }
+    writer->buffer[writer->used++] = '\n';
+}
+
+/**
+ * @brief Writes an employee and its payroll as one row.
+ * @param writer The export writer.
+ * @param record The employee.
+ */
+static void writeEmployeeRow(ExportWriter* writer, const void* record) {
+    const Employee* employee = (const Employee*)record;
+    const EmployeeName* name = &employee->personal.name;
+
+    beginRow(writer);
+    writeTextField(writer, "employeeNumber", employee->personal.employeeNumber, sizeof(employee->personal.employeeNumber));
+    writeTextField(writer, "firstName", name->firstName, sizeof(name->firstName));
+    writeTextField(writer, "middleName", name->middleName, sizeof(name->middleName));
+    writeTextField(writer, "lastName", name->lastName, sizeof(name->lastName));
+    writeTextField(writer, "fullName", name->fullName, sizeof(name->fullName));
+    writeWordField(writer, "status", employee->employment.status == statusRegular ? "Regular" : "Casual");
+    writeIntegerField(writer, "hoursWorked", employee->employment.hoursWorked);
+    writeDecimalField(writer, "basicRate", employee->employment.basicRate);
+    writeDecimalField(writer, "basicPay", employee->payroll.basicPay);
+    writeDecimalField(writer, "overtimePay", employee->payroll.overtimePay);
+    writeDecimalField(writer, "deductions", employee->payroll.deductions);
+    writeDecimalField(writer, "netPay", employee->payroll.netPay);
+    endRow(writer);
+}
+
+/**
+ * @brief Writes a student as one row.
+ * @param writer The export writer.
+ * @param record The student.
+ */
+static void writeStudentRow(ExportWriter* writer, const void* record) {
+    const Student* student = (const Student*)record;
+    const StudentName* name = &student->personal.name;
+    const char* standing = "Regular";
+    if (student->standing == acadDeansLister) {
+        standing = "Dean's Lister";
+    } else if (student->standing == acadProbation) {
+        standing = "Probation";
+    }
+
+    beginRow(writer);
+    writeTextField(writer, "studentNumber", student->personal.studentNumber, sizeof(student->personal.studentNumber));
+    writeTextField(writer, "firstName", name->firstName, sizeof(name->firstName));
+    writeTextField(writer, "middleName", name->middleName, sizeof(name->middleName));
+    writeTextField(writer, "lastName", name->lastName, sizeof(name->lastName));
+    writeTextField(writer, "fullName", name->fullName, sizeof(name->fullName));
+    writeWordField(writer, "gender", student->personal.gender == genderMale ? "Male" : "Female");
+    writeTextField(writer, "programCode", student->personal.programCode, sizeof(student->personal.programCode));
+    writeIntegerField(writer, "yearLevel", student->personal.yearLevel);
+    writeIntegerField(writer, "unitsEnrolled", student->academic.unitsEnrolled);
+    writeDecimalField(writer, "prelimGrade", student->academic.prelimGrade);
+    writeDecimalField(writer, "midtermGrade", student->academic.midtermGrade);
+    writeDecimalField(writer, "finalExamGrade", student->academic.finalExamGrade);
+    writeDecimalField(writer, "finalGrade", student->academic.finalGrade);
+    writeTextField(writer, "remarks", student->academic.remarks, sizeof(student->academic.remarks));
+    writeWordField(writer, "standing", standing);
+    endRow(writer);
+}
+
+/**
+ * @brief Writes a course as one row.
+ * @param writer The export writer.
+ * @param record The course.
+ */
+static void writeCourseRow(ExportWriter* writer, const void* record) {
+    const Course* course = (const Course*)record;
+
+    beginRow(writer);
+    writeTextField(writer, "code", course->code, sizeof(course->code));
+    writeTextField(writer, "name", course->name, sizeof(course->name));
+    writeTextField(writer, "description", course->description, sizeof(course->description));
+    writeIntegerField(writer, "units", course->units);
+    writeWordField(writer, "type", getCourseTypeString(course->type));
+    writeBooleanField(writer, "isActive", course->isActive);
+    endRow(writer);
+}
+
+/**
+ * @brief Writes every record of a list to an export file.
+ * @param dataList The list to export.
+ * @param format The format of the file.
+ * @param path The path of the file.
+ * @param writeRow The row writer of the record type.
+ * @param blank A zeroed record, used to write the CSV header.
+ * @return The number of records written, or -1 on failure.
+ */
+static long exportList(const list* dataList, ExportFormat format, const char* path,
+                       ExportRowWriter writeRow, const void* blank) {
+    if (!dataList || !path) {
+        return -1;
+    }
+
+    char tempPath[300];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+    ExportWriter writer = { NULL, NULL, 0, format, false, 0, false };
+    writer.buffer = (char*)malloc(exportBufferBytes);
+    if (!writer.buffer) {
+        return -1;
+    }
+    writer.file = fopen(tempPath, "wb");
+    if (!writer.file) {
+        free(writer.buffer);
+        return -1;
+    }
+    setvbuf(writer.file, NULL, _IONBF, 0); // Our buffer is the only one needed
+
+    if (format == exportCsv) {
+        writer.header = true;
+        writeRow(&writer, blank);
+        writer.header = false;
+    }
+
+    long count = 0;
+    node* current = dataList->head;
+    for (int i = 0; i < dataList->size && !writer.failed; i++, current = current->next) {
+        if (current->data) {
+            writeRow(&writer, current->data);
+            count++;
+        }
+    }
+    flushExport(&writer);
+    free(writer.buffer);
+
+    bool ok = !writer.failed && syncDataFile(writer.file) == 0;
+    if (fclose(writer.file) != 0 || !ok) {
+        remove(tempPath);
+        return -1;
+    }
+    if (replaceDataFile(tempPath, path) != 0) {
+        return -1;
+    }
+    return count;
+}
+
+/**
+ * @brief Builds the path of a new export file in the output directory.
+ * @param dataType The data type used in the name.
+ * @param format The format of the file.
+ * @param path Receives the path.
+ * @param size The size of the path buffer.
+ */
+void getExportFilePath(const char* dataType, ExportFormat format, char* path, size_t size) {
+    char timestamp[32];
+    getCurrentTimestamp(timestamp, sizeof(timestamp));
+    appCreateDirectory("output");
+    snprintf(path, size, "output/%s_export-%s.%s", dataType, timestamp,
+             format == exportJsonLines ? "jsonl" : "csv");
+}
+
+/**
+ * @brief Writes an employee list with its payroll to an export file.
+ * @param employeeList The list to export.
+ * @param format The format of the file.
+ * @param path The path of the file.
+ * @return The number of employees written, or -1 on failure.
+ */
+long exportEmployeeList(const list* employeeList, ExportFormat format, const char* path) {
+    static const Employee blank;
+    return exportList(employeeList, format, path, writeEmployeeRow, &blank);
+}
+
+/**
+ * @brief Writes a student list to an export file.
+ * @param studentList The list to export.
+ * @param format The format of the file.
+ * @param path The path of the file.
+ * @return The number of students written, or -1 on failure.
+ */
+long exportStudentList(const list* studentList, ExportFormat format, const char* path) {
+    static const Student blank;
+    return exportList(studentList, format, path, writeStudentRow, &blank);
+}
+
+/**
+ * @brief Writes the courses of a catalog to an export file.
+ * @param catalog The catalog to export.
+ * @param format The format of the file.
+ * @param path The path of the file.
+ * @return The number of courses written, or -1 on failure.
+ */
+long exportCourseCatalog(const CourseCatalog* catalog, ExportFormat format, const char* path) {
+    static const Course blank;
+    if (!catalog) {
+        return -1;
+    }
+    return exportList(catalog->courseList, format, path, writeCourseRow, &blank);
+}
@@ -0,0 +1,124 @@
+/**
+ * @file export.h
+ * @brief Streaming CSV and JSON Lines Export Module Header
+ *
+ * This header declares the exporters that write employee lists (with
+ * their computed payroll), student lists and course catalogs as CSV or
+ * JSON Lines files for spreadsheets and other systems, next to the
+ * fixed-width reports meant for printing.
+ *
+ * File formats:
+ * - CSV: a header line with the column names, then one record per line,
+ *   LF line ends; a field is quoted with '"' only if it contains a comma,
+ *   a quote or a line end ("" inside is one quote)
+ * - JSON Lines: one object per line with the column names as keys;
+ *   numbers and booleans are unquoted
+ * - Amounts and grades have two decimals; a value that is not a finite
+ *   number is written as an empty field in CSV and as null in JSON
+ *
+ * Employee columns: employeeNumber, firstName, middleName, lastName,
+ * fullName, status, hoursWorked, basicRate, basicPay, overtimePay,
+ * deductions, netPay
+ *
+ * Student columns: studentNumber, firstName, middleName, lastName,
+ * fullName, gender, programCode, yearLevel, unitsEnrolled, prelimGrade,
+ * midtermGrade, finalExamGrade, finalGrade, remarks, standing
+ *
+ * Course columns: code, name, description, units, type, isActive
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef EXPORT_H
+#define EXPORT_H
+
+// Standard C library includes
+#include <stddef.h>     // For size_t
+
+// Application-specific includes
+#include "../../include/headers/list.h"        // Lists being exported
+#include "../../include/models/course.h"       // Course catalogs being exported
+
+/**
+ * @name Export Constants
+ * @brief Buffer size of the exporter
+ * @{
+ */
+#define exportBufferBytes (256 * 1024)  // Bytes of text collected before each write
+
+/** @} */ // End of Export Constants
+
+/**
+ * @enum ExportFormat
+ * @brief Text formats the exporters can write
+ */
+typedef enum {
+    exportCsv,          // Comma-separated values with a header line
+    exportJsonLines     // One JSON object per line
+} ExportFormat;
+
+/**
+ * @name Export Functions
+ * @brief Writing lists as CSV or JSON Lines files
+ * @{
+ */
+
+/**
+ * @brief Builds the path of a new export file in the output directory
+ *
+ * The name is "<dataType>_export-<timestamp>" with the extension ".csv"
+ * or ".jsonl". The output directory is created if needed.
+ *
+ * @param dataType Data type used in the name ("employee", "student" or "course")
+ * @param format Format of the file
+ * @param path Receives the path
+ * @param size Size of the path buffer
+ */
+void getExportFilePath(const char* dataType, ExportFormat format, char* path, size_t size);
+
+/**
+ * @brief Writes an employee list with its payroll to a CSV or JSON Lines file
+ *
+ * Rows are formatted straight into one exportBufferBytes buffer, without
+ * printf, and the buffer is written whenever it fills, so memory use does
+ * not grow with the list. The payroll written is the one stored with each
+ * employee. The text goes to a temporary file that replaces the path only
+ * once it is complete.
+ *
+ * @param employeeList List to export
+ * @param format Format of the file
+ * @param path Path of the file to write
+ * @return Number of employees written, or -1 if the file could not be written
+ */
+long exportEmployeeList(const list* employeeList, ExportFormat format, const char* path);
+
+/**
+ * @brief Writes a student list to a CSV or JSON Lines file
+ *
+ * Works like exportEmployeeList(). Gender and standing are written as
+ * words ("Male", "Dean's Lister", ...).
+ *
+ * @param studentList List to export
+ * @param format Format of the file
+ * @param path Path of the file to write
+ * @return Number of students written, or -1 if the file could not be written
+ */
+long exportStudentList(const list* studentList, ExportFormat format, const char* path);
+
+/**
+ * @brief Writes the courses of a catalog to a CSV or JSON Lines file
+ *
+ * Works like exportEmployeeList().
+ *
+ * @param catalog Catalog to export
+ * @param format Format of the file
+ * @param path Path of the file to write
+ * @return Number of courses written, or -1 if the file could not be written
+ */
+long exportCourseCatalog(const CourseCatalog* catalog, ExportFormat format, const char* path);
+
+/** @} */ // End of Export Functions
+
+#endif // EXPORT_H
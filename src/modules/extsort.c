@@ -0,0 +1,753 @@
+/**
+ * @file extsort.c
+ * @brief External Sorting of Data Files
+ *
+ * This file implements sorting of employee and student data files that
+ * do not have to fit in memory. The input is split into runs that fit
+ * the memory budget, each run is radix sorted on packed keys and written
+ * to data/, and the runs are merged with a heap ordered by memcmp() of
+ * the packed keys of their current records. The input's journal is
+ * replayed while it is read, and the output is written like a save:
+ * with a key index, compressed if configured, and recorded in the
+ * manifest.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For file operations and I/O
+#include <stdlib.h>     // For memory allocation and general utilities
+#include <stddef.h>     // For offsetof
+#include <string.h>     // For memcmp and memcpy
+#include <stdbool.h>    // For boolean data type support
+
+// Application-specific includes
+#include "extsort.h"                            // External sorting module header
+#include "manifest.h"                           // Data directory manifest
+#include "../../include/headers/apctxt.h"      // For appCreateDirectory and compression settings
+#include "../../include/headers/datfile.h"     // Data file header and checksums
+
+/**
+ * @brief Record formats of the employee and student files
+ */
+static const RecordFormat employeeFileFormat = {
+    dataFileEmployees, sizeof(Employee), offsetof(Employee, personal.employeeNumber), employeeNumberLen, 0
+};
+static const RecordFormat studentFileFormat = {
+    dataFileStudents, sizeof(Student), offsetof(Student, personal.studentNumber), studentNumberLen, 0
+};
+
+/**
+ * @brief Sorted run written to a temporary file
+ */
+typedef struct {
+    char path[300];     // Path of the run file
+    int count;          // Number of records in the run
+} SortRun;
+
+/**
+ * @brief Destination of sorted records: a run file or the output data file
+ */
+typedef struct {
+    FILE* file;                 // Run file, or NULL
+    DataFileWriter* writer;     // Output data file, or NULL
+} SortSink;
+
+/**
+ * @brief Records of the input file with its journal applied, read in file order
+ *
+ * Only the base records whose key the journal updates or removes are
+ * replayed, in memory; the others are passed through as they are read.
+ * Records the journal added follow the base records.
+ */
+typedef struct {
+    FILE* file;                 // Input file
+    DataFileHeader header;      // Header of the input file
+    DataFileReader reader;      // Reader of the base records
+    bool readerOpen;            // The reader has buffers to release
+    size_t recordSize;          // Size of one record in bytes
+    size_t baseLeft;            // Base records not yet read
+    size_t slot;                // Slot of the next base record
+    uint32_t checksum;          // Checksum of the base records read so far
+    size_t* pickedSlots;        // Slots of the base records the journal may change, ascending
+    unsigned char* picked;      // Those records after the replay
+    bool* kept;                 // Whether each picked record survived the replay
+    size_t pickedCount;         // Number of picked records
+    size_t nextPicked;          // First picked record not yet passed
+    void** added;               // Records the journal added, in order
+    size_t addedCount;          // Number of added records
+    size_t nextAdded;           // First added record not yet passed
+    size_t count;               // Number of records after the replay
+} SortInput;
+
+/**
+ * @brief Buffered reader over one run during a merge
+ */
+typedef struct {
+    FILE* file;                 // Open run file
+    unsigned char* buffer;      // Records read ahead from the file
+    int capacity;               // Records the buffer can hold
+    int filled;                 // Records currently in the buffer
+    int position;               // Index of the current record in the buffer
+    int remaining;              // Records not yet read from the file
+    unsigned char* key;         // Packed key of the current record
+} RunReader;
+
+/**
+ * @brief Writes sorted records to a run file or the output file.
+ * @param sink The destination.
+ * @param records The records, one after another.
+ * @param count The number of records.
+ * @param recordSize The size of one record in bytes.
+ * @return Returns 0 on success, -1 on a write error.
+ */
+static int writeToSink(const SortSink* sink, const void* records, size_t count, size_t recordSize) {
+    if (sink->writer) {
+        return appendDataFileRecords(sink->writer, records, count);
+    }
+    return (count == 0 || fwrite(records, recordSize, count, sink->file) == count) ? 0 : -1;
+}
+
+/**
+ * @brief Checks whether a record's key is one of a sorted set of keys.
+ * @param record The record.
+ * @param format The record format.
+ * @param keys The keys, sorted and zero-padded to the key field size.
+ * @param keyCount The number of keys.
+ * @param padded Scratch space for the record's key.
+ * @return true if the set holds the record's key.
+ */
+static bool hasJournalKey(const unsigned char* record, const RecordFormat* format, const unsigned char* keys,
+                          size_t keyCount, unsigned char* padded) {
+    const unsigned char* field = record + format->keyOffset;
+    size_t length = 0;
+    while (length < format->keyLength && field[length] != '\0') {
+        length++;
+    }
+    memcpy(padded, field, length);
+    memset(padded + length, 0, format->keyLength - length);
+
+    size_t low = 0;
+    size_t high = keyCount;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        int order = memcmp(keys + middle * format->keyLength, padded, format->keyLength);
+        if (order == 0) {
+            return true;
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Copies the base records the journal may change and replays the journal over them.
+ * @param input The input, positioned at the first record.
+ * @param path The path of the input file.
+ * @param format The record format.
+ * @param keys The keys the journal updates or removes.
+ * @param keyCount The number of keys.
+ * @return Returns 0 on success, -1 on error or a corrupted input.
+ */
+static int replayInputJournal(SortInput* input, const char* path, const RecordFormat* format,
+                              const unsigned char* keys, size_t keyCount) {
+    size_t recordSize = input->recordSize;
+    size_t batch = externalSortMinBuffer / recordSize + 1;
+    unsigned char* buffer = (unsigned char*)malloc(batch * recordSize);
+    unsigned char* padded = (unsigned char*)malloc(format->keyLength);
+    size_t capacity = 0;
+    uint32_t checksum = 0;
+    DataFileReader reader;
+    int result = (buffer && padded && initDataFileReader(&reader, input->file, &input->header) == 0) ? 0 : -1;
+    if (result != 0) {
+        free(buffer);
+        free(padded);
+        return -1;
+    }
+
+    // One pass over the base collects every record the journal might touch
+    for (size_t slot = 0; result == 0 && slot < input->header.recordCount;) {
+        size_t count = (input->header.recordCount - slot < batch) ? input->header.recordCount - slot : batch;
+        if (readDataFileRecords(&reader, buffer, count) != 0) {
+            result = -1;
+            break;
+        }
+        checksum = crc32c(checksum, buffer, count * recordSize);
+        for (size_t i = 0; i < count; i++, slot++) {
+            const unsigned char* record = buffer + i * recordSize;
+            if (!hasJournalKey(record, format, keys, keyCount, padded)) {
+                continue;
+            }
+            if (input->pickedCount == capacity) {
+                capacity = (capacity > 0) ? capacity * 2 : 64;
+                size_t* slots = (size_t*)realloc(input->pickedSlots, capacity * sizeof(size_t));
+                if (slots) {
+                    input->pickedSlots = slots;
+                }
+                unsigned char* picked = (unsigned char*)realloc(input->picked, capacity * recordSize);
+                if (picked) {
+                    input->picked = picked;
+                }
+                if (!slots || !picked) {
+                    result = -1;
+                    break;
+                }
+            }
+            input->pickedSlots[input->pickedCount] = slot;
+            memcpy(input->picked + input->pickedCount++ * recordSize, record, recordSize);
+        }
+    }
+    closeDataFileReader(&reader);
+    free(buffer);
+    free(padded);
+    if (result != 0 || verifyDataFileChecksum(&input->header, checksum) != 0) {
+        return -1;
+    }
+
+    // Replaying only the picked records in file order treats them exactly as a full replay would
+    size_t count = input->pickedCount;
+    void** items = (void**)malloc((count > 0 ? count : 1) * sizeof(void*));
+    input->kept = (bool*)calloc(count > 0 ? count : 1, sizeof(bool));
+    if (!items || !input->kept) {
+        free(items);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        items[i] = input->picked + i * recordSize;
+    }
+    JournalReplay replay;
+    if (replayJournal(path, &input->header, format, &items, &count, &replay) != 0) {
+        free(items);
+        return -1;
+    }
+
+    // Survivors are still in the picked block; anything else was added by the journal
+    input->added = (void**)malloc((count > 0 ? count : 1) * sizeof(void*));
+    for (size_t i = 0; i < count; i++) {
+        unsigned char* record = (unsigned char*)items[i];
+        if (record >= input->picked && record < input->picked + input->pickedCount * recordSize) {
+            input->kept[(size_t)(record - input->picked) / recordSize] = true;
+            input->count++;
+        } else if (input->added) {
+            input->added[input->addedCount++] = record;
+        } else {
+            free(record);
+        }
+    }
+    free(items);
+    if (!input->added) {
+        return -1;
+    }
+    input->count += input->header.recordCount - input->pickedCount + input->addedCount;
+    return 0;
+}
+
+/**
+ * @brief Releases the buffers and replayed records of an input and closes its file.
+ * @param input The input.
+ */
+static void closeSortInput(SortInput* input) {
+    if (input->readerOpen) {
+        closeDataFileReader(&input->reader);
+    }
+    if (input->file) {
+        fclose(input->file);
+    }
+    for (size_t i = 0; i < input->addedCount; i++) {
+        free(input->added[i]);
+    }
+    free(input->added);
+    free(input->pickedSlots);
+    free(input->picked);
+    free(input->kept);
+    memset(input, 0, sizeof(*input));
+}
+
+/**
+ * @brief Opens a data file for sorting and replays its journal, if it has one.
+ * @param input The input to initialize.
+ * @param path The path of the data file.
+ * @param format The record format.
+ * @return Returns 0 on success, -1 on error or a corrupted input.
+ */
+static int openSortInput(SortInput* input, const char* path, const RecordFormat* format) {
+    memset(input, 0, sizeof(*input));
+    input->recordSize = format->recordSize;
+    input->file = fopen(path, "rb");
+    if (!input->file ||
+        readDataFileHeader(input->file, format->recordType, format->recordSize, NULL, 0, &input->header) != 0) {
+        closeSortInput(input);
+        return -1;
+    }
+    input->baseLeft = input->header.recordCount;
+    input->count = input->header.recordCount;
+
+    unsigned char* keys = NULL;
+    size_t keyCount = 0;
+    int64_t recordStart = tellDataFile(input->file);
+    int found = (recordStart >= 0) ? readJournalKeys(path, &input->header, format, &keys, &keyCount) : -1;
+    if (found == 1) {
+        input->count = 0;
+        found = (replayInputJournal(input, path, format, keys, keyCount) == 0 &&
+                 seekDataFile(input->file, recordStart, SEEK_SET) == 0) ? 1 : -1;
+    }
+    free(keys);
+    if (found < 0 || initDataFileReader(&input->reader, input->file, &input->header) != 0) {
+        closeSortInput(input);
+        return -1;
+    }
+    input->readerOpen = true;
+    return 0;
+}
+
+/**
+ * @brief Reads the next records of an input with its journal applied.
+ * @param input The input.
+ * @param records The buffer for the records.
+ * @param count The number of records to read.
+ * @return Returns 0 on success, -1 on a read error, a corrupted input or the end of the records.
+ */
+static int readSortInput(SortInput* input, unsigned char* records, size_t count) {
+    size_t recordSize = input->recordSize;
+    size_t filled = 0;
+    while (filled < count) {
+        unsigned char* destination = records + filled * recordSize;
+        if (input->baseLeft == 0) {
+            if (input->nextAdded == input->addedCount) {
+                return -1;
+            }
+            memcpy(destination, input->added[input->nextAdded++], recordSize);
+            filled++;
+            continue;
+        }
+
+        size_t batch = (count - filled < input->baseLeft) ? count - filled : input->baseLeft;
+        if (readDataFileRecords(&input->reader, destination, batch) != 0) {
+            return -1;
+        }
+        input->checksum = crc32c(input->checksum, destination, batch * recordSize);
+        input->baseLeft -= batch;
+        if (input->baseLeft == 0 && verifyDataFileChecksum(&input->header, input->checksum) != 0) {
+            return -1; // A corrupted input is detected before any merging work is done
+        }
+
+        // Records the journal changed are swapped for their replayed versions, removed ones dropped
+        size_t kept = 0;
+        for (size_t i = 0; i < batch; i++, input->slot++) {
+            const unsigned char* record = destination + i * recordSize;
+            if (input->nextPicked < input->pickedCount && input->pickedSlots[input->nextPicked] == input->slot) {
+                size_t picked = input->nextPicked++;
+                if (!input->kept[picked]) {
+                    continue;
+                }
+                record = input->picked + picked * recordSize;
+            }
+            if (record != destination + kept * recordSize) {
+                memmove(destination + kept * recordSize, record, recordSize);
+            }
+            kept++;
+        }
+        filled += kept;
+    }
+    return 0;
+}
+
+/**
+ * @brief Reads the next batch of records of a run into its buffer.
+ * @param reader The run reader.
+ * @param recordSize The size of one record in bytes.
+ * @return Returns 0 on success, -1 on a read error.
+ */
+static int refillRunReader(RunReader* reader, size_t recordSize) {
+    int batch = (reader->remaining < reader->capacity) ? reader->remaining : reader->capacity;
+    if (batch > 0 && fread(reader->buffer, recordSize, (size_t)batch, reader->file) != (size_t)batch) {
+        return -1;
+    }
+    reader->remaining -= batch;
+    reader->filled = batch;
+    reader->position = 0;
+    return 0;
+}
+
+/**
+ * @brief Checks whether the current record of one run is merged before another's.
+ * @param readers The run readers.
+ * @param a The first run index.
+ * @param b The second run index.
+ * @param keyBytes The size of the packed keys.
+ * @return true if run a's record comes first. Ties go to the earlier run, which keeps the sort stable.
+ */
+static bool runRecordBefore(const RunReader* readers, int a, int b, int keyBytes) {
+    int order = memcmp(readers[a].key, readers[b].key, (size_t)keyBytes);
+    return order < 0 || (order == 0 && a < b);
+}
+
+/**
+ * @brief Restores the min-heap of run indices below a position.
+ * @param readers The run readers.
+ * @param heap The heap of run indices.
+ * @param root The position to sift down from.
+ * @param size The number of runs in the heap.
+ * @param keyBytes The size of the packed keys.
+ */
+static void siftDownReaders(const RunReader* readers, int* heap, int root, int size, int keyBytes) {
+    int value = heap[root];
+    while (2 * root + 1 < size) {
+        int child = 2 * root + 1;
+        if (child + 1 < size && runRecordBefore(readers, heap[child + 1], heap[child], keyBytes)) {
+            child++;
+        }
+        if (!runRecordBefore(readers, heap[child], value, keyBytes)) {
+            break;
+        }
+        heap[root] = heap[child];
+        root = child;
+    }
+    heap[root] = value;
+}
+
+/**
+ * @brief K-way merges sorted runs into a run file or the output file.
+ * @param runs The runs to merge, in input order.
+ * @param runCount The number of runs.
+ * @param sink The destination of the merged records.
+ * @param recordSize The size of one record in bytes.
+ * @param keys The key fields.
+ * @param keyCount The number of key fields.
+ * @param memoryLimit The memory budget in bytes shared by all buffers.
+ * @return The number of records written, or -1 on error.
+ */
+static int mergeRuns(const SortRun* runs, int runCount, const SortSink* sink,
+                     size_t recordSize, const SortKey* keys, int keyCount, size_t memoryLimit) {
+    int keyBytes = packedSortKeySize(keys, keyCount);
+
+    // Every run and the output get an equal share of the budget
+    size_t share = memoryLimit / (size_t)(runCount + 1);
+    int bufferRecords = (share / recordSize > 0) ? (int)(share / recordSize) : 1;
+
+    RunReader* readers = (RunReader*)calloc((size_t)runCount, sizeof(RunReader));
+    int* heap = (int*)malloc((size_t)runCount * sizeof(int));
+    unsigned char* keyStore = (unsigned char*)malloc((size_t)runCount * keyBytes);
+    unsigned char* output = (unsigned char*)malloc((size_t)bufferRecords * recordSize);
+    int result = -1;
+    int heapSize = 0;
+
+    if (!readers || !heap || !keyStore || !output) {
+        goto cleanup;
+    }
+
+    for (int r = 0; r < runCount; r++) {
+        RunReader* reader = &readers[r];
+        reader->file = fopen(runs[r].path, "rb");
+        reader->buffer = (unsigned char*)malloc((size_t)bufferRecords * recordSize);
+        reader->capacity = bufferRecords;
+        reader->remaining = runs[r].count;
+        reader->key = keyStore + (size_t)r * keyBytes;
+        if (!reader->file || !reader->buffer || refillRunReader(reader, recordSize) != 0) {
+            goto cleanup;
+        }
+        if (reader->filled > 0) {
+            packSortKey(reader->buffer, keys, keyCount, reader->key);
+            heap[heapSize++] = r;
+        }
+    }
+    for (int i = heapSize / 2 - 1; i >= 0; i--) {
+        siftDownReaders(readers, heap, i, heapSize, keyBytes);
+    }
+
+    int outputCount = 0;
+    int written = 0;
+    while (heapSize > 0) {
+        RunReader* reader = &readers[heap[0]];
+        memcpy(output + (size_t)outputCount * recordSize, reader->buffer + (size_t)reader->position * recordSize, recordSize);
+        if (++outputCount == bufferRecords) {
+            if (writeToSink(sink, output, (size_t)outputCount, recordSize) != 0) {
+                goto cleanup;
+            }
+            written += outputCount;
+            outputCount = 0;
+        }
+
+        // Advance the run that supplied the record and restore the heap
+        if (++reader->position == reader->filled && refillRunReader(reader, recordSize) != 0) {
+            goto cleanup;
+        }
+        if (reader->filled == 0) {
+            heap[0] = heap[--heapSize];
+        } else {
+            packSortKey(reader->buffer + (size_t)reader->position * recordSize, keys, keyCount, reader->key);
+        }
+        siftDownReaders(readers, heap, 0, heapSize, keyBytes);
+    }
+    if (writeToSink(sink, output, (size_t)outputCount, recordSize) != 0) {
+        goto cleanup;
+    }
+    result = written + outputCount;
+
+cleanup:
+    if (readers) {
+        for (int r = 0; r < runCount; r++) {
+            if (readers[r].file) {
+                fclose(readers[r].file);
+            }
+            free(readers[r].buffer);
+        }
+    }
+    free(readers);
+    free(heap);
+    free(keyStore);
+    free(output);
+    return result;
+}
+
+/**
+ * @brief Merges runs into a new temporary run file.
+ * @param runs The runs to merge, in input order.
+ * @param runCount The number of runs.
+ * @param combined Receives the merged run; its path must be set.
+ * @param recordSize The size of one record in bytes.
+ * @param keys The key fields.
+ * @param keyCount The number of key fields.
+ * @param memoryLimit The memory budget in bytes.
+ * @return Returns 0 on success, -1 on error (the merged run file is removed).
+ */
+static int mergeRunsToFile(const SortRun* runs, int runCount, SortRun* combined,
+                           size_t recordSize, const SortKey* keys, int keyCount, size_t memoryLimit) {
+    SortSink sink = { fopen(combined->path, "wb"), NULL };
+    if (!sink.file) {
+        return -1;
+    }
+    combined->count = mergeRuns(runs, runCount, &sink, recordSize, keys, keyCount, memoryLimit);
+    if (fclose(sink.file) != 0 || combined->count < 0) {
+        remove(combined->path);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Removes the temporary files of a set of runs.
+ * @param runs The runs.
+ * @param runCount The number of runs.
+ */
+static void removeRuns(const SortRun* runs, int runCount) {
+    for (int r = 0; r < runCount; r++) {
+        remove(runs[r].path);
+    }
+}
+
+/**
+ * @brief Sorts a chunk of records in memory and writes it in sorted order.
+ * @param sink The destination of the sorted records.
+ * @param records The records of the chunk.
+ * @param items Scratch items, one per record.
+ * @param count The number of records.
+ * @param recordSize The size of one record in bytes.
+ * @param keys The key fields.
+ * @param keyCount The number of key fields.
+ * @return Returns 0 on success, -1 on error.
+ */
+static int writeSortedChunk(const SortSink* sink, unsigned char* records, SortItem* items, int count,
+                            size_t recordSize, const SortKey* keys, int keyCount) {
+    for (int i = 0; i < count; i++) {
+        items[i].data = records + (size_t)i * recordSize;
+        items[i].owner = NULL;
+    }
+    if (sortItemsByKeys(items, count, keys, keyCount) != 0) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (writeToSink(sink, items[i].data, 1, recordSize) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Sorts a data file of fixed-size records with bounded memory.
+ * @param inputFile The name of the file to sort, in the data directory.
+ * @param outputFile The name of the sorted file, in the data directory.
+ * @param format The record format.
+ * @param keys The key fields, most significant first.
+ * @param keyCount The number of key fields.
+ * @param memoryLimit The memory budget in bytes.
+ * @return The number of records written, or -1 on error.
+ */
+int externalSortDataFile(const char* inputFile, const char* outputFile, const RecordFormat* format,
+                         const SortKey* keys, int keyCount, size_t memoryLimit) {
+    int keyBytes = packedSortKeySize(keys, keyCount);
+    if (!inputFile || !outputFile || !format || format->recordSize == 0 || keyBytes < 0 ||
+        memoryLimit < externalSortMinMemory) {
+        return -1;
+    }
+    size_t recordSize = format->recordSize;
+
+    appCreateDirectory("data");
+
+    char inputPath[256];
+    char outputPath[256];
+    snprintf(inputPath, sizeof(inputPath), "data/%s", inputFile);
+    snprintf(outputPath, sizeof(outputPath), "data/%s", outputFile);
+
+    // Changes still in the input's journal are part of what gets sorted
+    SortInput input;
+    if (openSortInput(&input, inputPath, format) != 0) {
+        return -1;
+    }
+    int count = (int)input.count;
+
+    // The output is a complete data file like a save writes: key index, compressed if configured
+    DataFileKey key = { format->keyOffset, format->keyLength };
+    SortSink output = { NULL, openDataFileWriter(outputPath, format->recordType |
+                                                 (isCompressionEnabled() ? dataFileCompressed : 0),
+                                                 recordSize, &key) };
+
+    // A record in memory costs itself, its item plus the radix sort's copy,
+    // and two packed-key entries of the radix sort
+    size_t perRecord = recordSize + 2 * sizeof(SortItem) + 2 * ((size_t)keyBytes + 16);
+    int runCapacity = (int)(memoryLimit / perRecord);
+    if (runCapacity > count) {
+        runCapacity = (count > 0) ? count : 1;
+    }
+
+    unsigned char* records = (unsigned char*)malloc((size_t)runCapacity * recordSize);
+    SortItem* items = (SortItem*)malloc((size_t)runCapacity * sizeof(SortItem));
+    SortRun* runs = NULL;
+    int runCount = 0;
+    int result = -1;
+    if (!output.writer || !records || !items) {
+        goto cleanup;
+    }
+
+    if (count <= runCapacity) {
+        // Everything fits in memory: sort once and write the output directly
+        if (readSortInput(&input, records, (size_t)count) == 0 &&
+            writeSortedChunk(&output, records, items, count, recordSize, keys, keyCount) == 0) {
+            result = count;
+        }
+    } else {
+        // Phase 1: write every memory-sized chunk as a sorted run
+        int runSlots = (count + runCapacity - 1) / runCapacity;
+        runs = (SortRun*)malloc((size_t)runSlots * sizeof(SortRun));
+        if (!runs) {
+            goto cleanup;
+        }
+        for (int done = 0; done < count; done += runs[runCount++].count) {
+            SortRun* run = &runs[runCount];
+            run->count = (count - done < runCapacity) ? count - done : runCapacity;
+            snprintf(run->path, sizeof(run->path), "data/%s.run%d.tmp", outputFile, runCount);
+
+            SortSink runSink = { fopen(run->path, "wb"), NULL };
+            if (!runSink.file) {
+                goto cleanup;
+            }
+            bool ok = readSortInput(&input, records, (size_t)run->count) == 0 &&
+                      writeSortedChunk(&runSink, records, items, run->count, recordSize, keys, keyCount) == 0;
+            if (fclose(runSink.file) != 0 || !ok) {
+                runCount++;
+                goto cleanup;
+            }
+        }
+
+        // The chunk buffers are not needed while merging
+        free(records);
+        free(items);
+        records = NULL;
+        items = NULL;
+
+        // Phase 2: merge groups of runs until one pass can produce the output
+        int fanIn = (int)(memoryLimit / externalSortMinBuffer) - 1;
+        if (fanIn > externalSortMaxFanIn) fanIn = externalSortMaxFanIn;
+        if (fanIn < 2) fanIn = 2;
+
+        int nextRunId = runCount;
+        while (runCount > fanIn) {
+            int merged = 0;
+            for (int first = 0; first < runCount; first += fanIn) {
+                int groupSize = (runCount - first < fanIn) ? runCount - first : fanIn;
+                SortRun combined;
+                snprintf(combined.path, sizeof(combined.path), "data/%s.run%d.tmp", outputFile, nextRunId++);
+                int status = mergeRunsToFile(&runs[first], groupSize, &combined, recordSize, keys, keyCount,
+                                             memoryLimit);
+                removeRuns(&runs[first], groupSize);
+                if (status != 0) {
+                    // Runs after this group are still on disk; merged ones precede them
+                    memmove(&runs[merged], &runs[first + groupSize], (size_t)(runCount - first - groupSize) * sizeof(SortRun));
+                    runCount = merged + (runCount - first - groupSize);
+                    goto cleanup;
+                }
+                runs[merged++] = combined; // Merged groups keep their input order
+            }
+            runCount = merged;
+        }
+
+        result = mergeRuns(runs, runCount, &output, recordSize, keys, keyCount, memoryLimit);
+    }
+
+cleanup:
+    // The input is closed first: Windows cannot replace a file that is still open
+    closeSortInput(&input);
+    if (runs) {
+        removeRuns(runs, runCount);
+    }
+    free(runs);
+    free(records);
+    free(items);
+
+    // The output replaces its file only once it is complete, so the input may be the output
+    if (output.writer && closeDataFileWriter(output.writer, result >= 0, NULL) < 0) {
+        result = -1;
+    }
+    if (result >= 0) {
+        // The sorted file is a new base: a journal left at its name belongs to the old one
+        char logPath[300];
+        getJournalPath(outputPath, logPath, sizeof(logPath));
+        remove(logPath);
+        journalBaseReplaced(outputPath);
+        updateDataFileManifest(outputFile, result);
+    }
+    return result;
+}
+
+/**
+ * @brief Sorts an employee data file by a multi-key specification.
+ * @param inputFile The name of the employee file, in the data directory.
+ * @param outputFile The name of the sorted file, in the data directory.
+ * @param spec The fields to order by, most significant first.
+ * @param specCount The number of fields.
+ * @param memoryLimit The memory budget in bytes.
+ * @return The number of records written, or -1 on error.
+ */
+int externalSortEmployeeFile(const char* inputFile, const char* outputFile,
+                             const EmployeeSortSpec* spec, int specCount, size_t memoryLimit) {
+    SortKey keys[employeeSortMaxFields];
+    if (compileEmployeeSortKeys(spec, specCount, keys) != 0) {
+        return -1;
+    }
+    return externalSortDataFile(inputFile, outputFile, &employeeFileFormat, keys, specCount, memoryLimit);
+}
+
+/**
+ * @brief Sorts a student data file by a multi-key specification.
+ * @param inputFile The name of the student file, in the data directory.
+ * @param outputFile The name of the sorted file, in the data directory.
+ * @param spec The fields to order by, most significant first.
+ * @param specCount The number of fields.
+ * @param memoryLimit The memory budget in bytes.
+ * @return The number of records written, or -1 on error.
+ */
+int externalSortStudentFile(const char* inputFile, const char* outputFile,
+                            const StudentSortSpec* spec, int specCount, size_t memoryLimit) {
+    SortKey keys[studentSortMaxFields];
+    if (compileStudentSortKeys(spec, specCount, keys) != 0) {
+        return -1;
+    }
+    return externalSortDataFile(inputFile, outputFile, &studentFileFormat, keys, specCount, memoryLimit);
+}
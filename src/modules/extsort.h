@@ -0,0 +1,116 @@
+/**
+ * @file extsort.h
+ * @brief External Sorting Module Header
+ *
+ * This header declares functions that sort employee and student data
+ * files which may be larger than the available memory. A data file is
+ * read in chunks that fit a memory budget, every chunk is radix sorted
+ * on its packed keys and written to a temporary run file under data/,
+ * and the runs are then k-way merged into the sorted output file.
+ *
+ * Input and output use the binary format written by
+ * saveEmployeeDataFromFile() and saveStudentDataFromFile(): a
+ * DataFileHeader (see datfile.h) followed by the fixed-size records.
+ * The input's header and checksum are verified, and changes still in its
+ * journal (see journal.h) are applied as it is read, so the sort sees
+ * what loading the file would give. The output is written like a save:
+ * with a key index over the record numbers, compressed if compress_saves
+ * is enabled, renamed into place once complete and recorded in the data
+ * directory manifest; any journal left at the output's name is removed.
+ * Records with equal keys keep their order from the input file.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef EXTSORT_H
+#define EXTSORT_H
+
+// Standard C library includes
+#include <stdio.h>      // For file operations and I/O
+#include <stdlib.h>     // For memory allocation and general utilities
+
+// Application-specific includes
+#include "../../include/headers/list.h"        // Sort keys and radix sorting
+#include "../../include/headers/journal.h"     // Record formats and journal replay
+#include "../../include/models/employee.h"    // Employee sort specifications
+#include "../../include/models/student.h"     // Student sort specifications
+
+/**
+ * @name External Sort Configuration
+ * @brief Limits of the run merge
+ *
+ * At most externalSortMaxFanIn runs are merged at once; more runs are
+ * merged in several passes. The memory budget must leave every open run
+ * at least externalSortMinBuffer bytes of read buffer.
+ * @{
+ */
+#define externalSortMaxFanIn 64             // Most runs merged in one pass
+#define externalSortMinBuffer (64 * 1024)   // Smallest read buffer per run in bytes
+#define externalSortMinMemory (256 * 1024)  // Smallest accepted memory budget in bytes
+
+/** @} */ // End of External Sort Configuration
+
+/**
+ * @name External Sorting Functions
+ * @brief Sorting of data files with bounded memory
+ * @{
+ */
+
+/**
+ * @brief Sorts a data file of fixed-size records by key fields
+ *
+ * Reads as many records as fit into memoryLimit, sorts them with
+ * sortItemsByKeys() and writes them as a run file under data/. Runs are
+ * merged by comparing their packed keys with memcmp(). If the whole file
+ * fits in one run, the output is written directly without temporary
+ * files. Input and output may be the same file; the output is written to
+ * a temporary file first and renamed into place, and lists journaled to
+ * it write a new base on their next save (see journalBaseReplaced()).
+ *
+ * The journal is replayed without loading the file: the base records
+ * whose keys it updates or removes are collected in one extra pass and
+ * replayed in memory, on top of the budget. The output's key index keeps
+ * key field size + 4 bytes per record in memory until it is written.
+ *
+ * @param inputFile Name of the file to sort (in data directory)
+ * @param outputFile Name of the sorted file to write (in data directory)
+ * @param format Record type, size and key field of the file
+ * @param keys Key fields, most significant first
+ * @param keyCount Number of key fields
+ * @param memoryLimit Memory budget in bytes (at least externalSortMinMemory)
+ * @return Number of records written, or -1 on error
+ */
+int externalSortDataFile(const char* inputFile, const char* outputFile, const RecordFormat* format,
+                         const SortKey* keys, int keyCount, size_t memoryLimit);
+
+/**
+ * @brief Sorts an employee data file by a multi-key specification
+ *
+ * @param inputFile Name of the employee file to sort (in data directory)
+ * @param outputFile Name of the sorted file to write (in data directory)
+ * @param spec Fields to order by, most significant first
+ * @param specCount Number of fields
+ * @param memoryLimit Memory budget in bytes, e.g. getSortMemoryLimit()
+ * @return Number of records written, or -1 on error
+ */
+int externalSortEmployeeFile(const char* inputFile, const char* outputFile,
+                             const EmployeeSortSpec* spec, int specCount, size_t memoryLimit);
+
+/**
+ * @brief Sorts a student data file by a multi-key specification
+ *
+ * @param inputFile Name of the student file to sort (in data directory)
+ * @param outputFile Name of the sorted file to write (in data directory)
+ * @param spec Fields to order by, most significant first
+ * @param specCount Number of fields
+ * @param memoryLimit Memory budget in bytes, e.g. getSortMemoryLimit()
+ * @return Number of records written, or -1 on error
+ */
+int externalSortStudentFile(const char* inputFile, const char* outputFile,
+                            const StudentSortSpec* spec, int specCount, size_t memoryLimit);
+
+/** @} */ // End of External Sorting Functions
+
+#endif // EXTSORT_H
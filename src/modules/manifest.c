@@ -0,0 +1,334 @@
+/**
+ * @file manifest.c
+ * @brief Data Directory Manifest
+ *
+ * This file implements the manifest of the data directory. The entries
+ * are kept in memory sorted by file name once the manifest has been read,
+ * and written back whole whenever one changes; even a thousand files make
+ * a manifest of about 300 KB, far less than opening each file.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+// Standard C library includes
+#include <stdio.h>      // For file operations and remove
+#include <stdlib.h>     // For memory allocation, bsearch
+#include <string.h>     // For memcpy, memmove, strcmp and strstr
+#include <stdbool.h>    // For boolean data type support
+
+// Application-specific includes
+#include "manifest.h"                           // Manifest module header
+#include "../../include/headers/apctxt.h"      // For appScanDirectory and appGetFileInfo
+#include "../../include/headers/datfile.h"     // Data file headers and crc32c
+#include "../../include/headers/journal.h"     // For getJournalPath
+
+/**
+ * @brief Header at the start of the manifest file
+ */
+typedef struct ManifestHeader {
+    uint32_t magic;         // manifestMagic
+    uint16_t version;       // manifestVersion
+    uint16_t headerSize;    // Size of this header in bytes
+    uint32_t entrySize;     // Size of one entry in bytes
+    uint32_t entryCount;    // Number of entries after the header
+    uint32_t checksum;      // CRC32C of the entries
+    uint32_t reserved;      // Always 0
+} ManifestHeader;
+
+static ManifestEntry* manifestEntries = NULL;   // Entries sorted by file name
+static int manifestCount = 0;                   // Number of entries
+static int manifestCapacity = 0;                // Entries the array can hold
+static bool manifestLoaded = false;             // The manifest file was read
+
+/**
+ * @brief Reads the manifest file into memory, once.
+ *
+ * A missing, foreign or damaged manifest leaves the manifest empty; the
+ * next listing then rebuilds it from the files.
+ */
+static void loadManifest(void) {
+    if (manifestLoaded) {
+        return;
+    }
+    manifestLoaded = true;
+
+    FILE* file = fopen(manifestPath, "rb");
+    if (!file) {
+        return;
+    }
+    ManifestHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != manifestMagic ||
+        header.version != manifestVersion || header.headerSize != sizeof(ManifestHeader) ||
+        header.entrySize != sizeof(ManifestEntry) || header.entryCount > INT32_MAX / sizeof(ManifestEntry)) {
+        fclose(file);
+        return;
+    }
+
+    ManifestEntry* entries = NULL;
+    if (header.entryCount > 0) {
+        entries = (ManifestEntry*)malloc(header.entryCount * sizeof(ManifestEntry));
+        if (!entries || fread(entries, sizeof(ManifestEntry), header.entryCount, file) != header.entryCount ||
+            crc32c(0, entries, header.entryCount * sizeof(ManifestEntry)) != header.checksum) {
+            free(entries);
+            fclose(file);
+            return;
+        }
+    }
+    fclose(file);
+
+    // Names come from the file; make sure each one ends inside its field
+    for (uint32_t i = 0; i < header.entryCount; i++) {
+        entries[i].name[sizeof(entries[i].name) - 1] = '\0';
+    }
+    manifestEntries = entries;
+    manifestCount = (int)header.entryCount;
+    manifestCapacity = (int)header.entryCount;
+}
+
+/**
+ * @brief Writes the manifest file under a temporary name and renames it.
+ * @return Returns 0 on success, -1 on failure.
+ */
+static int saveManifest(void) {
+    appCreateDirectory("data");
+
+    char savingPath[64];
+    snprintf(savingPath, sizeof(savingPath), "%s.saving.tmp", manifestPath);
+    FILE* file = fopen(savingPath, "wb");
+    if (!file) {
+        return -1;
+    }
+    size_t bytes = (size_t)manifestCount * sizeof(ManifestEntry);
+    ManifestHeader header = { manifestMagic, manifestVersion, sizeof(ManifestHeader), sizeof(ManifestEntry),
+                              (uint32_t)manifestCount, crc32c(0, manifestEntries, bytes), 0 };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              (manifestCount == 0 || fwrite(manifestEntries, sizeof(ManifestEntry), (size_t)manifestCount, file) == (size_t)manifestCount);
+    if (fclose(file) != 0 || !ok) {
+        remove(savingPath);
+        return -1;
+    }
+    return replaceDataFile(savingPath, manifestPath);
+}
+
+/**
+ * @brief Finds a file's entry, or where it belongs.
+ * @param name The file name.
+ * @param found Receives whether the entry exists.
+ * @return The index of the entry, or the index to insert it at.
+ */
+static int findManifestEntry(const char* name, bool* found) {
+    int low = 0;
+    int high = manifestCount;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        int order = strcmp(manifestEntries[middle].name, name);
+        if (order == 0) {
+            *found = true;
+            return middle;
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    *found = false;
+    return low;
+}
+
+/**
+ * @brief Reads the record type, count and checksum from a data file's header.
+ * @param path The path of the file.
+ * @param entry Receives the header fields (all 0 for legacy or foreign files).
+ */
+static void readEntryHeader(const char* path, ManifestEntry* entry) {
+    entry->flags = 0;
+    entry->recordCount = 0;
+    entry->checksum = 0;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return;
+    }
+    DataFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) == 1 && header.magic == dataFileMagic && header.version >= 1) {
+        entry->flags = header.flags;
+        entry->recordCount = header.recordCount;
+        entry->checksum = header.checksum;
+    }
+    fclose(file);
+}
+
+/**
+ * @brief Compares scanned files by name, for bsearch.
+ * @param a The first file.
+ * @param b The second file.
+ * @return Negative, zero or positive like strcmp.
+ */
+static int compareScannedNames(const void* a, const void* b) {
+    return strcmp(((const AppFileInfo*)a)->name, ((const AppFileInfo*)b)->name);
+}
+
+/**
+ * @brief Checks whether a file name ends with a suffix.
+ * @param name The file name.
+ * @param suffix The suffix.
+ * @return true if the name ends with the suffix.
+ */
+static bool hasSuffix(const char* name, const char* suffix) {
+    size_t nameLength = strlen(name);
+    size_t suffixLength = strlen(suffix);
+    return nameLength >= suffixLength && strcmp(name + nameLength - suffixLength, suffix) == 0;
+}
+
+/**
+ * @brief Lists the data files with their manifest entries.
+ * @param dataType The text file names must contain, or NULL for all data files.
+ * @param entries Receives the entries sorted by file name.
+ * @return The number of entries, or -1 on error.
+ */
+int getDataFileManifest(const char* dataType, ManifestEntry** entries) {
+    if (!entries) {
+        return -1;
+    }
+    *entries = NULL;
+    loadManifest();
+
+    // One pass over the directory finds the data files and their journals alike
+    AppFileInfo* files = NULL;
+    int fileCount = appScanDirectory("data", "*", &files);
+    if (fileCount < 0) {
+        return -1;
+    }
+    ManifestEntry* current = (fileCount > 0) ? (ManifestEntry*)malloc((size_t)fileCount * sizeof(ManifestEntry)) : NULL;
+    if (fileCount > 0 && !current) {
+        free(files);
+        return -1;
+    }
+
+    int currentCount = 0;
+    bool changed = false;
+    for (int i = 0; i < fileCount; i++) {
+        if (!hasSuffix(files[i].name, ".dat")) {
+            continue;
+        }
+        char path[300];
+        snprintf(path, sizeof(path), "data/%s", files[i].name);
+
+        AppFileInfo journalKey;
+        getJournalPath(files[i].name, journalKey.name, sizeof(journalKey.name));
+        const AppFileInfo* journal = (const AppFileInfo*)bsearch(&journalKey, files, (size_t)fileCount,
+                                                                 sizeof(AppFileInfo), compareScannedNames);
+        int64_t journalSize = journal ? (int64_t)journal->size : -1;
+        int64_t journalModified = journal ? (int64_t)journal->modified : 0;
+
+        bool found;
+        int index = findManifestEntry(files[i].name, &found);
+        ManifestEntry* entry = &current[currentCount++];
+        if (found && manifestEntries[index].size == (int64_t)files[i].size &&
+            manifestEntries[index].modified == (int64_t)files[i].modified &&
+            manifestEntries[index].journalSize == journalSize &&
+            manifestEntries[index].journalModified == journalModified) {
+            *entry = manifestEntries[index];
+            continue;
+        }
+
+        // New or changed since the manifest saw it: only now is the file opened
+        memset(entry, 0, sizeof(*entry));
+        memcpy(entry->name, files[i].name, sizeof(entry->name));
+        readEntryHeader(path, entry);
+        entry->journalPending = journal ? 1 : 0;
+        entry->size = (int64_t)files[i].size;
+        entry->modified = (int64_t)files[i].modified;
+        entry->journalSize = journalSize;
+        entry->journalModified = journalModified;
+        changed = true;
+    }
+    free(files);
+
+    // The scan holds every data file, so entries of deleted files drop out here
+    if (changed || currentCount != manifestCount) {
+        free(manifestEntries);
+        manifestEntries = current;
+        manifestCount = currentCount;
+        manifestCapacity = fileCount;
+        saveManifest();
+    } else {
+        free(current);
+    }
+
+    int matchCount = 0;
+    for (int i = 0; i < manifestCount; i++) {
+        matchCount += (!dataType || strstr(manifestEntries[i].name, dataType)) ? 1 : 0;
+    }
+    if (matchCount == 0) {
+        return 0;
+    }
+    *entries = (ManifestEntry*)malloc((size_t)matchCount * sizeof(ManifestEntry));
+    if (!*entries) {
+        return -1;
+    }
+    int copied = 0;
+    for (int i = 0; i < manifestCount; i++) {
+        if (!dataType || strstr(manifestEntries[i].name, dataType)) {
+            (*entries)[copied++] = manifestEntries[i];
+        }
+    }
+    return matchCount;
+}
+
+/**
+ * @brief Records a data file that was just saved in the manifest.
+ * @param fileName The name of the file in the data directory.
+ * @param recordCount The number of records the save wrote.
+ * @return Returns 0 on success, -1 on failure.
+ */
+int updateDataFileManifest(const char* fileName, int recordCount) {
+    if (!fileName || recordCount < 0) {
+        return -1;
+    }
+    loadManifest();
+
+    char path[300];
+    snprintf(path, sizeof(path), "data/%s", fileName);
+    AppFileInfo info;
+    if (appGetFileInfo(path, &info) != 0) {
+        return -1;
+    }
+
+    ManifestEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    snprintf(entry.name, sizeof(entry.name), "%s", info.name);
+    readEntryHeader(path, &entry);
+    entry.recordCount = (uint32_t)recordCount; // Exact, even if part of the save went to the journal
+    entry.size = (int64_t)info.size;
+    entry.modified = (int64_t)info.modified;
+
+    char journalPath[310];
+    getJournalPath(path, journalPath, sizeof(journalPath));
+    AppFileInfo journal;
+    bool hasJournal = appGetFileInfo(journalPath, &journal) == 0;
+    entry.journalSize = hasJournal ? (int64_t)journal.size : -1;
+    entry.journalModified = hasJournal ? (int64_t)journal.modified : 0;
+
+    bool found;
+    int index = findManifestEntry(entry.name, &found);
+    if (!found) {
+        if (manifestCount == manifestCapacity) {
+            int newCapacity = (manifestCapacity > 0) ? manifestCapacity * 2 : 64;
+            ManifestEntry* grown = (ManifestEntry*)realloc(manifestEntries, (size_t)newCapacity * sizeof(ManifestEntry));
+            if (!grown) {
+                return -1;
+            }
+            manifestEntries = grown;
+            manifestCapacity = newCapacity;
+        }
+        memmove(&manifestEntries[index + 1], &manifestEntries[index],
+                (size_t)(manifestCount - index) * sizeof(ManifestEntry));
+        manifestCount++;
+    }
+    manifestEntries[index] = entry;
+    return saveManifest();
+}
@@ -0,0 +1,95 @@
+/**
+ * @file manifest.h
+ * @brief Data Directory Manifest Module Header
+ *
+ * This header declares the manifest of the data directory: a small index
+ * file, data/manifest.idx, that remembers for every .dat file its record
+ * type and options, record count, checksum, size and modification time.
+ * Listing the saved files then costs one directory scan; a file is only
+ * opened again when its size or time no longer match the manifest.
+ *
+ * Saves update the file's entry as they finish, with the exact number of
+ * records saved. Files changed by other means (autosaves, other tools)
+ * are noticed by their size and time and their header is read again.
+ * The manifest is only a cache: if it is missing or damaged it is
+ * rebuilt from the files.
+ *
+ * The manifest functions are not thread-safe; they are called from the
+ * menus only.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef MANIFEST_H
+#define MANIFEST_H
+
+// Standard C library includes
+#include <stdint.h>     // For fixed-size entry fields
+
+/**
+ * @name Manifest Constants
+ * @brief Location and format of the manifest file
+ * @{
+ */
+#define manifestPath "data/manifest.idx"   // The manifest file
+#define manifestMagic 0x4D505550u          // "PUPM" in little-endian byte order
+#define manifestVersion 1                  // Current manifest layout
+
+/** @} */ // End of Manifest Constants
+
+/**
+ * @struct ManifestEntry
+ * @brief What the manifest knows about one data file
+ */
+typedef struct ManifestEntry {
+    char name[256];             // File name in the data directory
+    uint32_t flags;             // Record type and options from the header (0 for legacy or foreign files)
+    uint32_t recordCount;       // Number of records in the list the file holds
+    uint32_t checksum;          // Payload checksum from the header
+    uint32_t journalPending;    // 1 if the changes in the file's journal are not counted in recordCount
+    int64_t size;               // Size of the file in bytes
+    int64_t modified;           // Last modification time of the file (seconds since 1970)
+    int64_t journalSize;        // Size of the file's journal in bytes, -1 if it has none
+    int64_t journalModified;    // Last modification time of the journal
+} ManifestEntry;
+
+/**
+ * @name Manifest Functions
+ * @brief Listing data files and keeping their entries current
+ * @{
+ */
+
+/**
+ * @brief Lists the data files with their manifest entries
+ *
+ * Scans the data directory once for .dat files and their journals. Entries
+ * whose file and journal still have the recorded size and time are used
+ * as they are; other files have their header read. Entries of deleted
+ * files are dropped, and the manifest is rewritten if anything changed.
+ *
+ * @param dataType Only list files whose name contains this ("employee",
+ *                 "student"), or NULL for all data files
+ * @param entries Receives the entries sorted by file name, to be released
+ *                with free() (NULL if there are none)
+ * @return Number of entries, or -1 on error
+ */
+int getDataFileManifest(const char* dataType, ManifestEntry** entries);
+
+/**
+ * @brief Records a data file that was just saved in the manifest
+ *
+ * Reads the file's header and the size and time of the file and its
+ * journal, and stores them with the number of records saved, which also
+ * counts any changes that only went to the journal.
+ *
+ * @param fileName Name of the file in the data directory
+ * @param recordCount Number of records the save wrote
+ * @return 0 on success, -1 if the file could not be read or the manifest written
+ */
+int updateDataFileManifest(const char* fileName, int recordCount);
+
+/** @} */ // End of Manifest Functions
+
+#endif // MANIFEST_H
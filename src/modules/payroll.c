@@ -1,31 +1,25 @@
 #include <stdio.h>
+#include <stdbool.h>
 #include "payroll.h"
 #include "../../include/models/employee.h"
 #include "../../include/headers/apctxt.h"
 
+static bool payrollWarningsEnabled = true; // Cap warnings are printed to the console
+
+void setPayrollWarnings(bool enabled) {
+    payrollWarningsEnabled = enabled;
+}
+
 void calculatePayroll(Employee* employee) {
     if (!employee) return;
     
     calculateBasicPay(employee);
-    printf("DEBUG: Basic Pay = %.2f\n", employee->payroll.basicPay);
-    
     calculateOvertimePay(employee);
-    printf("DEBUG: Overtime Pay = %.2f\n", employee->payroll.overtimePay);
-    
     calculateDeductions(employee);
-    printf("DEBUG: Deductions = %.2f\n", employee->payroll.deductions);
 
     employee->payroll.netPay = employee->payroll.basicPay + 
                               employee->payroll.overtimePay - 
                               employee->payroll.deductions;
-    printf("DEBUG: Net Pay = %.2f\n", employee->payroll.netPay);
-    
-    // Check if employee is regular and gets a special bonus
-    if (employee->employment.status == statusRegular) {
-        printf("DEBUG: Employee is Regular\n");
-    } else {
-        printf("DEBUG: Employee is Casual\n");
-    }
 }
 
 void calculateBasicPay(Employee* employee) {
@@ -37,8 +31,10 @@ void calculateBasicPay(Employee* employee) {
     
     // Ensure basic pay doesn't exceed maximum limit
     if (employee->payroll.basicPay > 999999.0f) {
-        printf("WARNING: Basic pay calculation exceeded maximum limit of 999999.00\n");
-        printf("         Capping basic pay at 999999.00\n");
+        if (payrollWarningsEnabled) {
+            printf("WARNING: Basic pay calculation exceeded maximum limit of 999999.00\n");
+            printf("         Capping basic pay at 999999.00\n");
+        }
         employee->payroll.basicPay = 999999.0f;
     }
 }
@@ -71,8 +67,10 @@ void calculateDeductions(Employee* employee) {
         
         // Ensure deductions don't exceed maximum limit
         if (employee->payroll.deductions > 99999.99f) {
-            printf("WARNING: Deductions calculation exceeded maximum limit of 99999.99\n");
-            printf("         Capping deductions at 99999.99\n");
+            if (payrollWarningsEnabled) {
+                printf("WARNING: Deductions calculation exceeded maximum limit of 99999.99\n");
+                printf("         Capping deductions at 99999.99\n");
+            }
             employee->payroll.deductions = 99999.99f;
         }
     } else {
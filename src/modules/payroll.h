@@ -1,11 +1,13 @@
 #ifndef PAYROLL_H
 #define PAYROLL_H
 
+#include <stdbool.h>
 #include "../../include/models/employee.h"
 
 void calculatePayroll(Employee* employee);
 void calculateBasicPay(Employee* employee);
 void calculateOvertimePay(Employee* employee);
 void calculateDeductions(Employee* employee);
+void setPayrollWarnings(bool enabled); // Bulk imports turn the per-employee cap warnings off
 
 #endif 
\ No newline at end of file
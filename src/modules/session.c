@@ -0,0 +1,264 @@
+/**
+ * @file session.c
+ * @brief Concurrent Loading of Saved Lists
+ *
+ * This file implements load sessions: a fixed pool of pthreads takes the
+ * files of a session one at a time, largest first, from a counter guarded
+ * by a mutex, and loads each with loadListUnregistered(). The main thread
+ * waits for the pool and then registers the lists, so the journal and
+ * delta registries are never touched by two threads.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // For clock_gettime
+#endif
+
+// Standard C library includes
+#include <stdio.h>      // For snprintf
+#include <stdlib.h>     // For memory allocation and qsort
+#include <string.h>     // For strncmp, strlen and strstr
+#include <stdbool.h>    // For boolean data type support
+#include <time.h>       // For clock_gettime
+#include <pthread.h>    // For the loading threads
+#ifdef _WIN32
+#include <windows.h>    // For QueryPerformanceCounter
+#endif
+
+// Application-specific includes
+#include "session.h"                            // Session module header
+#include "manifest.h"                           // For listing the saved files
+#include "../../include/headers/apctxt.h"      // For getLoadThreads and appGetFileInfo
+#include "../../include/models/employee.h"     // For freeEmployee
+#include "../../include/models/student.h"      // For freeStudent and compareStudentByGrade
+
+/**
+ * @brief Work shared by the threads of a session
+ */
+typedef struct SessionWork {
+    SessionFile** order;        // The files, largest first
+    int count;                  // Number of files
+    int next;                   // Position in order of the next file to load
+    pthread_mutex_t lock;       // Guards next
+} SessionWork;
+
+/**
+ * @brief Reads a monotonic clock.
+ * @return The time in seconds since an arbitrary point.
+ */
+static double getSessionClock(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+#endif
+}
+
+/**
+ * @brief Builds the grade ranking of a loaded student list.
+ * @param studentList The student list.
+ * @return The ranking, or NULL on memory allocation failure.
+ */
+static SkipList* buildRanking(const list* studentList) {
+    SkipList* ranking = NULL;
+    if (createSkipList(&ranking, compareStudentByGrade) != 0) {
+        return NULL;
+    }
+    node* current = studentList->head;
+    for (int i = 0; i < studentList->size; i++, current = current->next) {
+        if (skipListInsert(ranking, current->data) != 0) {
+            destroySkipList(&ranking, NULL);
+            return NULL;
+        }
+    }
+    return ranking;
+}
+
+/**
+ * @brief Loads one file of a session.
+ * @param file The file.
+ */
+static void loadSessionFile(SessionFile* file) {
+    double start = getSessionClock();
+    // Loaded lists can be large, so keep them array-backed for fast paging
+    file->dataList = loadListUnregistered(file->fileName, file->dataType, DYNAMIC_ARRAY, &file->registration);
+    file->failed = (file->dataList == NULL);
+    if (file->dataList && strcmp(file->dataType, "student") == 0) {
+        file->ranking = buildRanking(file->dataList); // The menus rebuild it if this fails
+    }
+    file->seconds = getSessionClock() - start;
+}
+
+/**
+ * @brief Thread entry point that loads files until none are left.
+ * @param argument A pointer to the SessionWork.
+ * @return Always NULL; the outcome is stored in the files.
+ */
+static void* sessionWorker(void* argument) {
+    SessionWork* work = (SessionWork*)argument;
+    while (true) {
+        pthread_mutex_lock(&work->lock);
+        int position = work->next++;
+        pthread_mutex_unlock(&work->lock);
+        if (position >= work->count) {
+            return NULL;
+        }
+        loadSessionFile(work->order[position]);
+    }
+}
+
+/**
+ * @brief Orders session files largest first, for qsort.
+ * @param a A pointer to the first file pointer.
+ * @param b A pointer to the second file pointer.
+ * @return Negative if a is larger, positive if b is larger, 0 if equal.
+ */
+static int compareFileSizes(const void* a, const void* b) {
+    int64_t sizeA = (*(SessionFile* const*)a)->size;
+    int64_t sizeB = (*(SessionFile* const*)b)->size;
+    return (sizeA < sizeB) - (sizeA > sizeB);
+}
+
+/**
+ * @brief Lists every saved employee and student list as session files.
+ * @param files Receives the files sorted by name.
+ * @return The number of files, or -1 on error.
+ */
+int getSessionFiles(SessionFile** files) {
+    if (!files) {
+        return -1;
+    }
+    *files = NULL;
+
+    ManifestEntry* entries = NULL;
+    int entryCount = getDataFileManifest(NULL, &entries);
+    if (entryCount <= 0) {
+        return entryCount;
+    }
+    *files = (SessionFile*)calloc((size_t)entryCount, sizeof(SessionFile));
+    if (!*files) {
+        free(entries);
+        return -1;
+    }
+
+    int count = 0;
+    for (int i = 0; i < entryCount; i++) {
+        const char* name = entries[i].name;
+        const char* dataType = (strncmp(name, "employee_", 9) == 0) ? "employee" :
+                               (strncmp(name, "student_", 8) == 0) ? "student" : NULL;
+        size_t nameLength = strlen(name);
+        if (!dataType || strstr(name, "_autosave.dat")) {
+            continue; // Autosaves are for recovery, not for sessions
+        }
+
+        // "employee_payroll.dat" becomes the list "payroll"
+        size_t prefixLength = strlen(dataType) + 1;
+        int listNameLength = (int)(nameLength - prefixLength - 4);
+        if (listNameLength <= 0) {
+            continue;
+        }
+        SessionFile* file = &(*files)[count++];
+        snprintf(file->fileName, sizeof(file->fileName), "%s", name);
+        snprintf(file->dataType, sizeof(file->dataType), "%s", dataType);
+        snprintf(file->listName, sizeof(file->listName), "%.*s", listNameLength, name + prefixLength);
+        file->size = entries[i].size;
+    }
+    free(entries);
+
+    if (count == 0) {
+        free(*files);
+        *files = NULL;
+    }
+    return count;
+}
+
+/**
+ * @brief Loads the files of a session concurrently.
+ * @param files The files to load.
+ * @param count The number of files.
+ * @param seconds Receives the time the whole session took. Can be NULL.
+ * @return The number of lists loaded, or -1 if any file failed.
+ */
+int loadSession(SessionFile* files, int count, double* seconds) {
+    double start = getSessionClock();
+    if (seconds) {
+        *seconds = 0.0;
+    }
+    if (!files || count < 0) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    SessionWork work;
+    work.count = count;
+    work.next = 0;
+    work.order = (SessionFile**)malloc((size_t)count * sizeof(SessionFile*));
+    if (!work.order || pthread_mutex_init(&work.lock, NULL) != 0) {
+        free(work.order);
+        return -1;
+    }
+
+    // Starting the largest file first keeps the session close to its slowest file
+    for (int i = 0; i < count; i++) {
+        files[i].dataList = NULL;
+        files[i].ranking = NULL;
+        files[i].failed = false;
+        files[i].seconds = 0.0;
+        if (files[i].size <= 0) {
+            char path[300];
+            AppFileInfo info;
+            snprintf(path, sizeof(path), "data/%s", files[i].fileName);
+            files[i].size = (appGetFileInfo(path, &info) == 0) ? info.size : 0;
+        }
+        work.order[i] = &files[i];
+    }
+    qsort(work.order, (size_t)count, sizeof(SessionFile*), compareFileSizes);
+
+    int threadCount = getLoadThreads();
+    if (threadCount > sessionMaxThreads) threadCount = sessionMaxThreads;
+    if (threadCount > count) threadCount = count;
+    pthread_t threads[sessionMaxThreads];
+    int started = 0;
+    for (int i = 1; i < threadCount; i++) {
+        if (pthread_create(&threads[started], NULL, sessionWorker, &work) == 0) {
+            started++;
+        }
+    }
+    sessionWorker(&work); // The calling thread loads files too
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_destroy(&work.lock);
+    free(work.order);
+
+    bool failed = false;
+    for (int i = 0; i < count; i++) {
+        failed = failed || files[i].failed;
+    }
+    for (int i = 0; i < count; i++) {
+        if (failed) {
+            // Nothing was registered yet, so the lists are simply released
+            destroySkipList(&files[i].ranking, NULL);
+            if (files[i].dataList) {
+                destroyList(&files[i].dataList, (strcmp(files[i].dataType, "student") == 0) ? freeStudent : freeEmployee);
+            }
+        } else {
+            registerLoadedList(files[i].dataList, &files[i].registration);
+        }
+    }
+    if (seconds) {
+        *seconds = getSessionClock() - start;
+    }
+    return failed ? -1 : count;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file session.h
+ * @brief Load Session Module Header
+ *
+ * This header declares load sessions, which load several saved employee
+ * and student lists at once. The files are loaded on a small pool of
+ * threads (load_threads in the configuration), largest file first, so
+ * a session takes about as long as its slowest file rather than the sum
+ * of all of them. Each thread reads and decodes its file, verifies the
+ * payload checksum (of mapped files too), replays the file's journal and
+ * builds the grade ranking of student lists.
+ *
+ * The journal and delta registries are only touched by the main thread:
+ * it registers the lists once every file has loaded. A session is all or
+ * nothing; if any file fails, every list it loaded is released again, so
+ * the caller adds either all of the lists to its managers or none.
+ *
+ * @author C002 - Group 1
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef SESSION_H
+#define SESSION_H
+
+// Standard C library includes
+#include <stdint.h>     // For file sizes
+#include <stdbool.h>    // For boolean data type support
+
+// Application-specific includes
+#include "../../include/headers/list.h"        // Loaded lists
+#include "../../include/headers/sklist.h"      // Grade rankings of student lists
+#include "data.h"                               // For loadListUnregistered()
+
+/**
+ * @name Session Constants
+ * @brief Limits of a load session
+ * @{
+ */
+#define sessionMaxThreads 16    // Most threads a session starts, whatever load_threads says
+
+/** @} */ // End of Session Constants
+
+/**
+ * @struct SessionFile
+ * @brief One file of a load session
+ */
+typedef struct SessionFile {
+    char fileName[256];                 // Name of the file in the data directory
+    char dataType[16];                  // Data type ("employee" or "student")
+    char listName[50];                  // Name the loaded list gets in its manager
+    int64_t size;                       // Size of the file in bytes (0 if unknown), for scheduling
+    list* dataList;                     // The loaded list, NULL if not loaded
+    SkipList* ranking;                  // Grade ranking of a loaded student list, NULL otherwise
+    bool failed;                        // The file could not be loaded
+    double seconds;                     // Time the file took to load
+    DataFileRegistration registration;  // Registered by loadSession() once every file is loaded
+} SessionFile;
+
+/**
+ * @name Session Functions
+ * @brief Choosing and loading the files of a session
+ * @{
+ */
+
+/**
+ * @brief Lists every saved employee and student list as session files
+ *
+ * Uses the data directory manifest, so no file is opened unless it
+ * changed. Files whose name starts with "employee_" or "student_" are
+ * included, except autosave files; the list name is the rest of the
+ * file name without ".dat".
+ *
+ * @param files Receives the files sorted by name, to be released with
+ *              free() (NULL if there are none)
+ * @return Number of files, or -1 on error
+ */
+int getSessionFiles(SessionFile** files);
+
+/**
+ * @brief Loads the files of a session concurrently
+ *
+ * Fills in dataList, ranking, failed and seconds of every file. If all
+ * files load, their lists are registered for journaled or delta saves
+ * and belong to the caller. Otherwise every loaded list is released
+ * again and the failed files are marked.
+ *
+ * Must be called from the main thread.
+ *
+ * @param files Files to load
+ * @param count Number of files
+ * @param seconds Receives the time the whole session took (can be NULL)
+ * @return Number of lists loaded (count), or -1 if any file failed
+ */
+int loadSession(SessionFile* files, int count, double* seconds);
+
+/** @} */ // End of Session Functions
+
+#endif // SESSION_H
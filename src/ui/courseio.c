@@ -121,7 +121,8 @@ int runCourseManagement(void) {
         {'6', "Display All Courses", "Show complete course catalog", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'7', "Save Catalog", "Save current catalog to file", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'8', "Load Catalog", "Load course data from saved file", false, false, 9, 0, 7, 0, 8, 0, NULL},
-        {'9', "Back to Main Menu", "Return to the main system menu", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 9
+        {'E', "Export Catalog", "Write courses as CSV or JSON Lines", false, false, 9, 0, 7, 0, 8, 0, NULL},
+        {'9', "Back to Main Menu", "Return to the main system menu", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 10
     };
     
     do {
@@ -149,6 +150,7 @@ int runCourseManagement(void) {
         courseMenu.options[3].isDisabled = !hasCourses; // Delete Course
         courseMenu.options[4].isDisabled = !hasCourses; // Search Courses
         courseMenu.options[5].isDisabled = !hasCourses; // Display All Courses
+        courseMenu.options[8].isDisabled = !hasCourses; // Export Catalog
         
         choice = runMenuWithInterface(&courseMenu);
         
@@ -177,6 +179,10 @@ int runCourseManagement(void) {
             case '8':
                 handleLoadCatalog();
                 break;
+            case 'E':
+            case 'e':
+                handleExportCatalog();
+                break;
             case '9':
                 // Check for unsaved changes before exiting
                 if (courseMgr.hasUnsavedChanges) {
@@ -707,6 +713,28 @@ int handleDisplayAllCourses(void) {
     return 0;
 }
 
+/**
+ * @brief Handles exporting the course catalog as CSV or JSON Lines
+ * @return Returns 0 on success, -1 on failure
+ */
+int handleExportCatalog(void) {
+    winTermClearScreen();
+    printf("=== Export Course Catalog ===\n\n");
+    
+    if (!courseMgr.catalog.courseList || courseMgr.catalog.courseList->size == 0) {
+        printf("No courses to export! The catalog is empty.\n");
+        waitForKeypress(NULL);
+        return -1;
+    }
+    
+    ExportFormat format = promptExportFormat();
+    char path[300];
+    getExportFilePath("course", format, path, sizeof(path));
+    long count = exportCourseCatalog(&courseMgr.catalog, format, path);
+    showExportResult(count, "courses", path);
+    return (count < 0) ? -1 : 0;
+}
+
 /**
  * @brief Handles saving the course catalog
  * @return Returns 0 on success, -1 on failure
@@ -76,6 +76,12 @@ int handleSaveCatalog(void);
  */
 int handleLoadCatalog(void);
 
+/**
+ * @brief Handles exporting the course catalog as CSV or JSON Lines
+ * @return Returns 0 on success, -1 on failure
+ */
+int handleExportCatalog(void);
+
 /**
  * @brief Gets course data from user input
  * @param course Pointer to the course structure to fill
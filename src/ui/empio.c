@@ -4,6 +4,8 @@
 #include <conio.h>
 #include "empio.h"
 #include "../modules/payroll.h"
+#include "../modules/data.h"
+#include "../modules/manifest.h"
 #include "../../include/headers/apctxt.h"
 #include "../../include/headers/apclrs.h"
 #include "../../include/headers/interface.h"
@@ -237,12 +239,46 @@ int getEmployeeNumberFromUser(char* buffer, const int bufferSize) {
     return 0;
 }
 
+/**
+ * @brief Looks up an employee number in the saved employee files without loading them.
+ * @param empNumber The employee number.
+ * @return Returns 1 if the employee was found and displayed, 0 otherwise.
+ */
+static int searchSavedEmployeeFiles(const char* empNumber) {
+    ManifestEntry* files = NULL;
+    int fileCount = getDataFileManifest("employee", &files);
+    int unsearched = 0;
+    
+    for (int i = 0; i < fileCount; i++) {
+        const char* fileName = files[i].name;
+        if (strstr(fileName, "_autosave") != NULL) {
+            continue; // Autosaves repeat the records of a list's own file
+        }
+        Employee emp;
+        int result = lookupRecordInFile(fileName, "employee", empNumber, &emp);
+        if (result == 1) {
+            printf("\n=== Employee Found in Saved File '%s' ===\n", fileName);
+            displayEmployeeDetails(&emp);
+            free(files);
+            return 1;
+        }
+        if (result < 0) {
+            unsearched++;
+        }
+    }
+    if (unsearched > 0) {
+        printf("\n%d saved file(s) could not be searched without loading them.\n", unsearched);
+    }
+    free(files);
+    return 0;
+}
+
 /**
  * @brief Prompts the user to search for an employee and displays results.
  * @param employeeList Pointer to the employee list.
  * @return Returns 0 on success, -1 on failure or cancel.
  */
-int handleSearchEmployee(const list* employeeList) {
+int handleSearchEmployee(list* employeeList) {
     winTermClearScreen();
     
     Menu searchMenu = {1, "Search Employee", (MenuOption[]){
@@ -268,6 +304,8 @@ int handleSearchEmployee(const list* employeeList) {
                         printf("\n=== Employee Found ===\n");
                         displayEmployeeDetails(emp);
                         shouldContinue = 0;
+                    } else if (searchSavedEmployeeFiles(empNumber)) {
+                        shouldContinue = 0; // Found in a list that is not loaded
                     } else {
                         printf("\n❌ Employee with number '%s' not found.\n", empNumber);
                         printf("\nWhat would you like to do?\n");
@@ -431,7 +469,7 @@ int handleEditEmployee(list* employeeList) {
         // Recalculate payroll with new data
         calculatePayroll(&newData);
         
-        if (updateEmployeeData(existingEmp, &newData) == 0) {
+        if (editEmployeeInList(employeeList, existingEmp->personal.employeeNumber, &newData) == 0) {
             winTermClearScreen();
             printf("=== Employee Update Successful ===\n\n");
             printf("✅ Employee '%s' has been updated successfully!\n\n", existingEmp->personal.employeeNumber);
@@ -10,7 +10,7 @@ int getEmployeeNumberFromUser(char* buffer, const int bufferSize);
 int editEmployeeDataFromUser(Employee* employee);
 
 // Employee operations
-int handleSearchEmployee(const list* employeeList);
+int handleSearchEmployee(list* employeeList);
 int handleEditEmployee(list* employeeList);
 int handleDeleteEmployee(list* employeeList);
 
@@ -26,6 +26,13 @@
 #include "stuio.h"
 #include "../modules/data.h"
 #include "../modules/payroll.h"
+#include "../modules/autosave.h"
+#include "../modules/columnar.h"
+#include "../modules/csvimport.h"
+#include "../modules/export.h"
+#include "../modules/extsort.h"
+#include "../modules/manifest.h"
+#include "../modules/session.h"
 #include "../../include/headers/apctxt.h"
 #include "../../include/headers/apclrs.h"
 #include "../../include/headers/state.h"
@@ -33,6 +40,8 @@
 #include "../../include/models/employee.h"
 #include "../../include/models/student.h"
 #include "../../include/headers/list.h"
+#include "../../include/headers/journal.h"
+#include "../../include/headers/delta.h"
 
 // Forward declarations for submenu functions
 int handleAddEmployeeMenu(void);
@@ -49,9 +58,61 @@ Menu mainMenu = {1, "PUP Information Management System", (MenuOption[]){
     {'3', "Course Management", "Manage course information and academic programs", false, false, 9, 0, 7, 0, 8, 0, NULL},
     {'4', "System Statistics", "View system usage and performance statistics", false, false, 9, 0, 7, 0, 8, 0, NULL},
     {'5', "Configuration Settings", "Modify system configuration and settings", false, false, 9, 0, 7, 0, 8, 0, NULL},
-    {'6', "Exit", "Close the application and return to system", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 6
+    {'6', "Load Session", "Load several saved employee and student lists at once", false, false, 9, 0, 7, 0, 8, 0, NULL},
+    {'7', "Exit", "Close the application and return to system", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 7
 };
 
+/**
+ * @brief Marks the active employee list as changed since its last save
+ */
+static void markEmployeeListModified(void) {
+    if (empManager.activeEmployeeList >= 0) {
+        empManager.employeeListModified[empManager.activeEmployeeList] = true;
+    }
+}
+
+/**
+ * @brief Marks the active student list as changed since its last save
+ */
+static void markStudentListModified(void) {
+    if (stuManager.activeStudentList >= 0) {
+        stuManager.studentListModified[stuManager.activeStudentList] = true;
+    }
+}
+
+/**
+ * @brief Hands the modified lists to the background autosave writer once per interval
+ * 
+ * Only snapshots are taken here; the files are written on the autosave
+ * thread, so the menu keeps responding while they are saved.
+ */
+static void autosaveModifiedLists(void) {
+    static time_t lastAutosave = 0;
+    int interval = getAutosaveInterval();
+    time_t now = time(NULL);
+    if (interval <= 0 || lastAutosave == 0) {
+        lastAutosave = now;
+        return;
+    }
+    if (now - lastAutosave < interval) {
+        return;
+    }
+    lastAutosave = now;
+    
+    for (int i = 0; i < empManager.employeeListCount; i++) {
+        if (empManager.employeeListModified[i] && empManager.employeeLists[i] &&
+            autosaveList(empManager.employeeLists[i], empManager.employeeListNames[i], "employee") == 0) {
+            empManager.employeeListModified[i] = false;
+        }
+    }
+    for (int i = 0; i < stuManager.studentListCount; i++) {
+        if (stuManager.studentListModified[i] && stuManager.studentLists[i] &&
+            autosaveList(stuManager.studentLists[i], stuManager.studentListNames[i], "student") == 0) {
+            stuManager.studentListModified[i] = false;
+        }
+    }
+}
+
 /**
  * @brief Helper function to run a menu with the new interface system
  * @param menu Pointer to the menu to display
@@ -119,6 +180,7 @@ static char runMenuWithInterface(Menu* menu) {
         time_t currentTime = time(NULL);
         if (currentTime > lastTimeUpdate) {
             updateInfoBoxTimeDate(lastConsoleWidth, totalMenuNameWidth, totalOptionBoxWidth, paddingX, paddingY);
+            autosaveModifiedLists();
             lastTimeUpdate = currentTime;
         }
         
@@ -222,12 +284,119 @@ void initMultiListManager(void) {
     stuManager.studentListCount = 0;
     stuManager.activeStudentList = -1;
     
+    // Modified lists are written in the background from now on
+    startAutosave();
+}
+
+/**
+ * @brief Asks for a CSV/TSV file and opens a report for the rows it rejects
+ * @param dataType Data type shown in the prompt ("employee" or "student")
+ * @param columns Column order of the file, shown before the prompt
+ * @param path Receives the path of the file to import
+ * @param pathSize Size of the path buffer
+ * @param reportPath Receives the path of the error report
+ * @param reportSize Size of the report path buffer
+ * @return The open report, or NULL if it could not be created (rows are then only counted)
+ */
+static FILE* prepareImport(const char* dataType, const char* columns, char* path, int pathSize,
+                           char* reportPath, size_t reportSize) {
+    printf("%sColumns:%s %s\n", UI_INFO, TXT_RESET, columns);
+    printf("Fields are separated by commas or tabs; the first line may hold column titles.\n\n");
+    char prompt[80];
+    snprintf(prompt, sizeof(prompt), "📂 Enter path of the %s CSV/TSV file: ", dataType);
+    appFormField field = { prompt, path, pathSize, IV_MAX_LEN_CHARS, {.maxLengthChars = {.maxLength = pathSize - 1}} };
+    appGetValidatedInput(&field, 1);
+    
+    char timestamp[32];
+    getCurrentTimestamp(timestamp, sizeof(timestamp));
+    appCreateDirectory("output");
+    snprintf(reportPath, reportSize, "output/%s_import_errors-%s.txt", dataType, timestamp);
+    return fopen(reportPath, "w");
+}
+
+/**
+ * @brief Shows the outcome of an import and removes an empty error report
+ * @param result Return value of the importer
+ * @param summary Row counts of the import
+ * @param report Error report, or NULL
+ * @param reportPath Path of the error report
+ */
+static void showImportSummary(int result, const CsvImportSummary* summary, FILE* report, const char* reportPath) {
+    if (report) {
+        fclose(report);
+        if (summary->rejectedCount == 0) {
+            remove(reportPath);
+        }
+    }
+    
+    if (result != 0) {
+        printf("%s❌ The file could not be read completely!%s\n", UI_ERROR, TXT_RESET);
+    }
+    printf("\nRows read:     %zu\n", summary->rowCount);
+    printf("Rows imported: %s%zu%s\n", UI_SUCCESS, summary->importedCount, TXT_RESET);
+    if (summary->rejectedCount > 0) {
+        printf("Rows rejected: %s%zu%s\n", UI_WARNING, summary->rejectedCount, TXT_RESET);
+        if (report) {
+            printf("The reason for each rejected row is listed in %s\n", reportPath);
+        }
+    }
+    printf("Press any key to continue...");
+    _getch();
+}
+
+/**
+ * @brief Rebuilds the grade ranking of a student list from scratch
+ * @param listIndex Index of the list in the student manager
+ * @return 0 on success, -1 on error (the list is left without a ranking)
+ */
+int rebuildStudentRanking(int listIndex) {
+    if (listIndex < 0 || listIndex >= stuManager.studentListCount) {
+        return -1;
+    }
+    
+    destroySkipList(&stuManager.gradeRankings[listIndex], NULL);
+    
+    list* studentList = stuManager.studentLists[listIndex];
+    if (!studentList || createSkipList(&stuManager.gradeRankings[listIndex], compareStudentByGrade) != 0) {
+        return -1;
+    }
+    
+    node* current = studentList->head;
+    for (int i = 0; i < studentList->size; i++) {
+        if (skipListInsert(stuManager.gradeRankings[listIndex], current->data) != 0) {
+            destroySkipList(&stuManager.gradeRankings[listIndex], NULL);
+            return -1;
+        }
+        current = current->next;
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns the grade ranking that belongs to a managed student list
+ * @param studentList Student list owned by the student manager
+ * @return The ranking, or NULL if the list is not managed or has no ranking
+ */
+SkipList* getStudentRanking(const list* studentList) {
+    for (int i = 0; i < stuManager.studentListCount; i++) {
+        if (stuManager.studentLists[i] == studentList) {
+            return stuManager.gradeRankings[i];
+        }
+    }
+    return NULL;
 }
 
 /**
  * @brief Cleans up all allocated lists and resources
  */
 void cleanupMultiListManager(void) {
+    // Let the autosave writer finish the snapshots it was given
+    stopAutosave();
+    
+    // Uncommitted changes are discarded like those of unsaved lists
+    detachAllJournals();
+    untrackAllDataFiles();
+    
     // Clean up employee lists
     for (int i = 0; i < empManager.employeeListCount; i++) {
         if (empManager.employeeLists[i]) {
@@ -240,6 +409,7 @@ void cleanupMultiListManager(void) {
         if (stuManager.studentLists[i]) {
             destroyList(&stuManager.studentLists[i], freeStudent);
         }
+        destroySkipList(&stuManager.gradeRankings[i], NULL);
     }
 }
 
@@ -274,6 +444,9 @@ int menuLoop(void) {
                 runConfigurationManagement();
                 break;
             case '6':
+                handleLoadSession();
+                break;
+            case '7':
                 winTermClearScreen();
                 printf("\nExiting PUP Information Management System...\n");
                 printf("Thank you for using the system!\n");
@@ -503,7 +676,9 @@ int runEmployeeManagement(void) {
         {'8', "Payroll Report", "Generate payroll calculations and reports", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'9', "Save Employee List", "Save current list to file", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'A', "Load Employee List", "Load employee data from saved file", false, false, 9, 0, 7, 0, 8, 0, NULL},
-        {'B', "Back to Main Menu", "Return to the main system menu", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 12};
+        {'K', "Top Earners", "Show the employees with the highest net pay", false, false, 9, 0, 7, 0, 8, 0, NULL},
+        {'E', "Export Employee List", "Write employees and payroll as CSV or JSON Lines", false, false, 9, 0, 7, 0, 8, 0, NULL},
+        {'B', "Back to Main Menu", "Return to the main system menu", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 14};
     
     do {
         // Update menu title with current active list info before displaying menu
@@ -531,12 +706,14 @@ int runEmployeeManagement(void) {
                 break;
             case '3':
                 handleAddEmployeeMenu();
+                markEmployeeListModified();
                 break;
             case '4': {
                 extern int handleEditEmployee(list* employeeList);
                 int hasActiveList = (empManager.activeEmployeeList >= 0 && empManager.employeeLists[empManager.activeEmployeeList]);
                 if (checkActiveList(hasActiveList, 0, "No active employee list!")) {
                     handleEditEmployee(empManager.employeeLists[empManager.activeEmployeeList]);
+                    markEmployeeListModified();
                 }
                 break;
             }
@@ -545,13 +722,14 @@ int runEmployeeManagement(void) {
                 if (checkActiveList(hasActiveList, 0, "No active employee list!")) {
                     extern int handleDeleteEmployee(list* employeeList);
                     handleDeleteEmployee(empManager.employeeLists[empManager.activeEmployeeList]);
+                    markEmployeeListModified();
                 }
                 break;
             }
             case '6': {
                 int hasActiveList = (empManager.activeEmployeeList >= 0 && empManager.employeeLists[empManager.activeEmployeeList]);
                 if (checkActiveList(hasActiveList, 0, "No active employee list!")) {
-                    extern int handleSearchEmployee(const list* employeeList);
+                    extern int handleSearchEmployee(list* employeeList);
                     handleSearchEmployee(empManager.employeeLists[empManager.activeEmployeeList]);
                 }
                 break;
@@ -573,6 +751,14 @@ int runEmployeeManagement(void) {
             case 'a':
                 handleLoadEmployeeList();
                 break;
+            case 'K':
+            case 'k':
+                handleTopEarners();
+                break;
+            case 'E':
+            case 'e':
+                handleExportEmployees();
+                break;
             case 'B':
             case 'b':
                 return 0; // Return to main menu
@@ -613,7 +799,9 @@ int runStudentManagement(void) {
         {'9', "Student Report", "Generate academic reports and statistics", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'S', "Save Student List", "Save current list to file", false, false, 9, 0, 7, 0, 8, 0, NULL},
         {'L', "Load Student List", "Load student data from saved file", false, false, 9, 0, 7, 0, 8, 0, NULL},
-        {'B', "Back to Main Menu", "Return to the main system menu", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 13};
+        {'K', "Top Students", "Show the highest final grades and Dean's Listers", false, false, 9, 0, 7, 0, 8, 0, NULL},
+        {'E', "Export Student List", "Write students as CSV or JSON Lines", false, false, 9, 0, 7, 0, 8, 0, NULL},
+        {'B', "Back to Main Menu", "Return to the main system menu", false, false, 9, 0, 7, 0, 8, 0, NULL}}, 15};
     
     do {
         // Update menu title with current active list info before displaying menu
@@ -649,12 +837,14 @@ int runStudentManagement(void) {
                 break;
             case '3':
                 handleAddStudentMenu();
+                markStudentListModified();
                 break;
             case '4': {
                 int hasActiveList = (stuManager.activeStudentList >= 0 && stuManager.studentLists[stuManager.activeStudentList]);
                 if (checkActiveList(hasActiveList, 0, "No active student list!")) {
                     extern int handleEditStudent(list* studentList);
                     handleEditStudent(stuManager.studentLists[stuManager.activeStudentList]);
+                    markStudentListModified();
                 }
                 break;
             }
@@ -663,13 +853,14 @@ int runStudentManagement(void) {
                 if (checkActiveList(hasActiveList, 0, "No active student list!")) {
                     extern int handleDeleteStudent(list* studentList);
                     handleDeleteStudent(stuManager.studentLists[stuManager.activeStudentList]);
+                    markStudentListModified();
                 }
                 break;
             }
             case '6': {
                 int hasActiveList = (stuManager.activeStudentList >= 0 && stuManager.studentLists[stuManager.activeStudentList]);
                 if (checkActiveList(hasActiveList, 0, "No active student list!")) {
-                    extern int handleSearchStudent(const list* studentList);
+                    extern int handleSearchStudent(list* studentList);
                     handleSearchStudent(stuManager.studentLists[stuManager.activeStudentList]);
                 }
                 break;
@@ -688,6 +879,7 @@ int runStudentManagement(void) {
             }
             case '8':
                 handleSortStudentsByGrade();
+                markStudentListModified();
                 break;
             case '9':
                 handleStudentReport();
@@ -700,6 +892,14 @@ int runStudentManagement(void) {
             case 'l':
                 handleLoadStudentList();
                 break;
+            case 'K':
+            case 'k':
+                handleTopStudents();
+                break;
+            case 'E':
+            case 'e':
+                handleExportStudents();
+                break;
             case 'B':
             case 'b':
                 return 0; // Return to main menu
@@ -824,6 +1024,29 @@ int handleAddEmployee(void) {
     return 0;
 }
 
+int handleImportEmployees(void) {
+    winTermClearScreen();
+    printf("=== Import Employees from CSV/TSV ===\n\n");
+    
+    if (empManager.activeEmployeeList < 0 || !empManager.employeeLists[empManager.activeEmployeeList]) {
+        printf("No active employee list!\n");
+        printf("Press any key to continue...");
+        _getch();
+        return -1;
+    }
+    
+    char path[260] = "";
+    char reportPath[300];
+    FILE* report = prepareImport("employee",
+                                 "number, first name, middle name, last name, status (R/C), hours worked, basic rate",
+                                 path, sizeof(path), reportPath, sizeof(reportPath));
+    
+    CsvImportSummary summary;
+    int result = importEmployeesFromCsv(path, empManager.employeeLists[empManager.activeEmployeeList], report, &summary);
+    showImportSummary(result, &summary, report, reportPath);
+    return result;
+}
+
 // Note: handleEditEmployee, handleDeleteEmployee, and handleSearchEmployee are in empio.c
 // handleEditStudent, handleDeleteStudent, and handleSearchStudent are in stuio.c
 
@@ -842,6 +1065,88 @@ int handleDisplayAllEmployees(void) {
     return 0;
 }
 
+/**
+ * @brief Asks which format a list is exported in
+ * @return The chosen format
+ */
+ExportFormat promptExportFormat(void) {
+    printf("%sExport format:%s\n", UI_INFO, TXT_RESET);
+    printf("  1. CSV (with a header line)\n");
+    printf("  2. JSON Lines (one object per line)\n\n");
+    
+    char formatInput[2];
+    appFormField formatField = { "📤 Select export format (1-2): ", formatInput, 2, IV_RANGE_INT, {.rangeInt = {.min = 1, .max = 2}} };
+    appGetValidatedInput(&formatField, 1);
+    return (atoi(formatInput) == 2) ? exportJsonLines : exportCsv;
+}
+
+/**
+ * @brief Shows where an export was written, or that it failed
+ * @param count Return value of the exporter
+ * @param recordName Plural name of the records ("employees", ...)
+ * @param path Path of the export file
+ */
+void showExportResult(long count, const char* recordName, const char* path) {
+    if (count < 0) {
+        printf("\n%s❌ The export file could not be written!%s\n", UI_ERROR, TXT_RESET);
+    } else {
+        printf("\n%s✅ Exported %ld %s to %s%s\n", UI_SUCCESS, count, recordName, path, TXT_RESET);
+    }
+    printf("Press any key to continue...");
+    _getch();
+}
+
+int handleExportEmployees(void) {
+    winTermClearScreen();
+    printf("=== Export Employee List ===\n\n");
+    
+    int hasActiveList = (empManager.activeEmployeeList >= 0 && empManager.employeeLists[empManager.activeEmployeeList]);
+    if (!checkActiveList(hasActiveList, 0, "No active employee list!")) {
+        return -1;
+    }
+    
+    ExportFormat format = promptExportFormat();
+    char path[300];
+    getExportFilePath("employee", format, path, sizeof(path));
+    long count = exportEmployeeList(empManager.employeeLists[empManager.activeEmployeeList], format, path);
+    showExportResult(count, "employees", path);
+    return (count < 0) ? -1 : 0;
+}
+
+int handleTopEarners(void) {
+    winTermClearScreen();
+    printf("=== Top Earners ===\n\n");
+    
+    int hasActiveList = (empManager.activeEmployeeList >= 0 && empManager.employeeLists[empManager.activeEmployeeList]);
+    if (!checkActiveList(hasActiveList, 0, "No active employee list!")) {
+        return -1;
+    }
+    
+    char countInput[4];
+    appFormField field = { "Number of employees to show (1-100): ", countInput, 4, IV_RANGE_INT, {.rangeInt = {.min = 1, .max = 100}} };
+    appGetValidatedInput(&field, 1);
+    int k = atoi(countInput);
+    
+    // Bounded heap over the list; the list itself is not reordered
+    Employee* topEarners[100];
+    int found = findTopEarners(empManager.employeeLists[empManager.activeEmployeeList], k, topEarners);
+    if (found <= 0) {
+        printf("\nNo employees to rank.\n");
+        waitForKeypress(NULL);
+        return 0;
+    }
+    
+    printf("\n%-4s  %-12s  %-20s  %12s\n", "Rank", "Employee No.", "Name", "Net Pay");
+    printf("------------------------------------------------------\n");
+    for (int i = 0; i < found; i++) {
+        printf("%-4d  %-12s  %-20.20s  %12.2f\n", i + 1, topEarners[i]->personal.employeeNumber,
+               topEarners[i]->personal.name.fullName, topEarners[i]->payroll.netPay);
+    }
+    
+    waitForKeypress(NULL);
+    return 0;
+}
+
 int handlePayrollReport(void) {
     winTermClearScreen();
     printf("%s", UI_HEADER);
@@ -872,6 +1177,9 @@ int handlePayrollReport(void) {
     
     printf("%s📊 Generating payroll report for: %s%s%s\n\n", UI_INFO, UI_HIGHLIGHT, empManager.employeeListNames[empManager.activeEmployeeList], TXT_RESET);
     
+    // The report lists employees by employee number
+    sortEmployeesByNumber(empManager.employeeLists[empManager.activeEmployeeList]);
+    
     // Generate the payroll report file
     char reportFilePath[512];
     int reportResult = generatePayrollReportFile(empManager.employeeLists[empManager.activeEmployeeList], reportFilePath, sizeof(reportFilePath));
@@ -927,6 +1235,8 @@ int handleSaveEmployeeList(void) {
                                            filename, "employee");
     
     if (savedCount >= 0) {
+        empManager.employeeListModified[empManager.activeEmployeeList] = false;
+        discardAutosave(empManager.employeeListNames[empManager.activeEmployeeList], "employee");
         printf("Successfully saved %d employee records!\n", savedCount);
         printf("Data saved to data directory.\n");
     } else {
@@ -937,158 +1247,165 @@ int handleSaveEmployeeList(void) {
     return 0;
 }
 
-int handleLoadEmployeeList(void) {
-    winTermClearScreen();
-    
-    // Get available employee files
-    char fileNames[20][256]; // Support up to 20 files
-    int fileCount = getEmployeeDataFileNames(fileNames, 20);
-    
-    if (fileCount == 0) {
-        printf("%s", UI_HEADER);
-        printf("╔═══════════════════════════════════════════════════════════════════╗\n");
-        printf("║                         NO FILES FOUND                            ║\n");
-        printf("╠═══════════════════════════════════════════════════════════════════╣\n");
-        printf("║                                                                   ║\n");
-        printf("║  No employee data files were found in the data directory.         ║\n");
-        printf("║  Save some employee lists first before trying to load them.       ║\n");
-        printf("║                                                                   ║\n");
-        printf("╚═══════════════════════════════════════════════════════════════════╝\n");
-        printf("%s", TXT_RESET);
-        printf("Press any key to continue...");
-        _getch();
-        return -1;
+/**
+ * @brief Formats a file size for the file table
+ * @param bytes Size in bytes
+ * @param text Receives the size, such as "512 B" or "12.4 MB"
+ * @param size Size of the text buffer
+ */
+static void formatFileSize(int64_t bytes, char* text, size_t size) {
+    static const char* units[] = { "B", "KB", "MB", "GB", "TB" };
+    double value = (double)bytes;
+    int unit = 0;
+    while (value >= 1024.0 && unit < 4) {
+        value /= 1024.0;
+        unit++;
+    }
+    if (unit == 0) {
+        snprintf(text, size, "%lld B", (long long)bytes);
+    } else {
+        snprintf(text, size, "%.1f %s", value, units[unit]);
     }
-    
-    // Ensure minimum menu height for consistent interface
-    const int MIN_MENU_OPTIONS = 10; // Minimum options to match standard interface height
-    int totalMenuOptions = (fileCount + 1 < MIN_MENU_OPTIONS) ? MIN_MENU_OPTIONS : fileCount + 1;
-    
-    // Create dynamic menu options based on available files
-    MenuOption* options = (MenuOption*)malloc(totalMenuOptions * sizeof(MenuOption));
-    if (!options) {
-        printf("Memory allocation failed!\n");
-        printf("Press any key to continue...");
-        _getch();
+}
+
+/**
+ * @brief Describes how a data file is stored, for the file table
+ * @param entry Manifest entry of the file
+ * @param expectedType Record type the caller wants (dataFileEmployees or dataFileStudents)
+ * @param text Receives the description
+ * @param size Size of the text buffer
+ */
+static void describeDataFileFormat(const ManifestEntry* entry, uint32_t expectedType, char* text, size_t size) {
+    uint32_t type = entry->flags & dataFileTypeMask;
+    if (entry->flags == 0) {
+        snprintf(text, size, "legacy");
+        return;
+    }
+    if (type != expectedType && !(expectedType == dataFileStudents && type == dataFileStudentColumns)) {
+        snprintf(text, size, "%s records", (type == dataFileEmployees) ? "employee" :
+                                           (type == dataFileStudents || type == dataFileStudentColumns) ? "student" : "other");
+        return;
+    }
+    snprintf(text, size, "%s%s%s%s",
+             (type == dataFileStudentColumns) ? "columnar" : "rows",
+             (entry->flags & dataFileCompressed) ? ", compressed" : "",
+             (entry->flags & dataFileIndexed) ? ", indexed" : "",
+             entry->journalPending ? ", journal" : "");
+}
+
+/**
+ * @brief Shows the saved files of a data type page by page and asks which one to load
+ * 
+ * The details come from the data directory manifest, so no file is opened
+ * unless it changed since the manifest last saw it.
+ * 
+ * @param dataType Data type of the files ("employee" or "student")
+ * @param title Title shown above the table
+ * @param fileName Receives the name of the chosen file
+ * @param size Size of the fileName buffer
+ * @return 1 if a file was chosen, 0 if the user cancelled, -1 if there are no files
+ */
+static int selectDataFile(const char* dataType, const char* title, char* fileName, size_t size) {
+    ManifestEntry* entries = NULL;
+    int fileCount = getDataFileManifest(dataType, &entries);
+    if (fileCount <= 0) {
+        free(entries);
         return -1;
     }
     
-    // Add file options to menu
-    for (int i = 0; i < fileCount; i++) {
-        options[i].key = '1' + i; // Keys 1, 2, 3, etc.
-        
-        // Create option text from filename (remove .dat extension)
-        char displayName[256];
-        strncpy(displayName, fileNames[i], 255);
-        displayName[255] = '\0';
+    uint32_t expectedType = (strcmp(dataType, "employee") == 0) ? dataFileEmployees : dataFileStudents;
+    const int pageSize = 15;
+    int pageCount = (fileCount + pageSize - 1) / pageSize;
+    int page = 0;
+    int chosen = -1;
+    
+    while (chosen < 0) {
+        winTermClearScreen();
+        printf("%s=== %s ===%s\n\n", UI_HEADER, title, TXT_RESET);
+        printf("%s%4s  %-32s %9s %10s  %-16s  %s%s\n", TXT_BOLD, "#", "File", "Records", "Size", "Saved", "Format", TXT_RESET);
         
-        // Remove .dat extension for display
-        char* dotPos = strstr(displayName, ".dat");
-        if (dotPos) {
-            *dotPos = '\0';
+        for (int i = page * pageSize; i < fileCount && i < (page + 1) * pageSize; i++) {
+            const ManifestEntry* entry = &entries[i];
+            char sizeText[16];
+            char savedText[20] = "";
+            char formatText[48];
+            char countText[16] = "?";
+            formatFileSize(entry->size, sizeText, sizeof(sizeText));
+            time_t modified = (time_t)entry->modified;
+            struct tm* local = localtime(&modified);
+            if (local) {
+                strftime(savedText, sizeof(savedText), "%Y-%m-%d %H:%M", local);
+            }
+            describeDataFileFormat(entry, expectedType, formatText, sizeof(formatText));
+            if (entry->flags != 0) {
+                snprintf(countText, sizeof(countText), "%s%u", entry->journalPending ? "~" : "", entry->recordCount);
+            }
+            printf("%4d  %-32.32s %9s %10s  %-16s  %s\n", i + 1, entry->name, countText, sizeText, savedText, formatText);
         }
         
-        // Allocate memory for text and description
-        options[i].text = (char*)malloc(strlen(displayName) + 1);
-        options[i].description = (char*)malloc(strlen(fileNames[i]) + 50);
+        printf("\nPage %d of %d (%d files)\n", page + 1, pageCount, fileCount);
+        printf("Enter a file number, N/P for the next/previous page, or C to cancel: ");
         
-        if (options[i].text && options[i].description) {
-            strcpy((char*)options[i].text, displayName);
-            sprintf((char*)options[i].description, "Load employee data from %s", fileNames[i]);
+        char input[16];
+        if (!fgets(input, sizeof(input), stdin)) {
+            break;
         }
-        
-        options[i].isDisabled = false;
-        options[i].isSelected = false;
-        // Initialize color fields with correct names
-        options[i].highlightTextColor = 9;
-        options[i].highlightBgColor = 0;
-        options[i].textColor = 7;
-        options[i].bgColor = 0;
-        options[i].disabledTextColor = 8;
-        options[i].disabledBgColor = 0;
-        options[i].onSelect = NULL;
-    }
-    
-    // Add placeholder options if needed to maintain consistent height
-    for (int i = fileCount; i < totalMenuOptions - 1; i++) {
-        options[i].key = '\0'; // No key for placeholder
-        options[i].text = (char*)malloc(2);
-        options[i].description = (char*)malloc(30);
-        
-        if (options[i].text && options[i].description) {
-            strcpy((char*)options[i].text, "");
-            strcpy((char*)options[i].description, "");
+        if (!strchr(input, '\n')) {
+            int c;
+            while ((c = getchar()) != '\n' && c != EOF) {
+                // Drop the rest of an overlong line
+            }
         }
         
-        options[i].isDisabled = true; // Disable placeholder options
-        options[i].isSelected = false;
-        options[i].highlightTextColor = 8;
-        options[i].highlightBgColor = 0;
-        options[i].textColor = 8;
-        options[i].bgColor = 0;
-        options[i].disabledTextColor = 8;
-        options[i].disabledBgColor = 0;
-        options[i].onSelect = NULL;
-    }
-    
-    // Add "Cancel" option (always at the end)
-    int cancelIndex = totalMenuOptions - 1;
-    options[cancelIndex].key = 'C';
-    options[cancelIndex].text = (char*)malloc(20);
-    options[cancelIndex].description = (char*)malloc(50);
-    if (options[cancelIndex].text && options[cancelIndex].description) {
-        strcpy((char*)options[cancelIndex].text, "Cancel");
-        strcpy((char*)options[cancelIndex].description, "Return to Employee Management menu");
-    }
-    options[cancelIndex].isDisabled = false;
-    options[cancelIndex].isSelected = false;
-    options[cancelIndex].highlightTextColor = 9;
-    options[cancelIndex].highlightBgColor = 0;
-    options[cancelIndex].textColor = 7;
-    options[cancelIndex].bgColor = 0;
-    options[cancelIndex].disabledTextColor = 8;
-    options[cancelIndex].disabledBgColor = 0;
-    options[cancelIndex].onSelect = NULL;
-    
-    // Create the file selection menu
-    Menu fileMenu = {1, "Load Employee List - Select File", options, totalMenuOptions};
-    
-    char choice = runMenuWithInterface(&fileMenu);
-    
-    char selectedFileName[256] = "";
-    int selectedIndex = -1;
-    
-    // Find which file was selected
-    if (choice >= '1' && choice <= '9') {
-        selectedIndex = choice - '1';
-        if (selectedIndex < fileCount) {
-            strcpy(selectedFileName, fileNames[selectedIndex]);
-        }
-    } else if (choice == 'C' || choice == 'c') {
-        // User cancelled
-        // Free allocated memory
-        for (int i = 0; i < totalMenuOptions; i++) {
-            free((char*)options[i].text);
-            free((char*)options[i].description);
+        char command = input[0];
+        if (command == 'C' || command == 'c') {
+            break;
+        } else if (command == 'N' || command == 'n') {
+            page = (page + 1 < pageCount) ? page + 1 : page;
+        } else if (command == 'P' || command == 'p') {
+            page = (page > 0) ? page - 1 : 0;
+        } else {
+            int number = atoi(input);
+            if (number >= 1 && number <= fileCount) {
+                chosen = number - 1;
+            }
         }
-        free(options);
-        return 0;
     }
     
-    // Free allocated memory
-    for (int i = 0; i < totalMenuOptions; i++) {
-        free((char*)options[i].text);
-        free((char*)options[i].description);
+    if (chosen >= 0) {
+        snprintf(fileName, size, "%s", entries[chosen].name);
     }
-    free(options);
+    free(entries);
+    return (chosen >= 0) ? 1 : 0;
+}
+
+int handleLoadEmployeeList(void) {
+    winTermClearScreen();
+    
+    // Let the user pick from every saved employee file
+    char selectedFileName[256] = "";
+    int selection = selectDataFile("employee", "Load Employee List - Select File", selectedFileName, sizeof(selectedFileName));
     
-    if (selectedFileName[0] == '\0') {
-        printf("Invalid selection!\n");
+    if (selection < 0) {
+        printf("%s", UI_HEADER);
+        printf("╔═══════════════════════════════════════════════════════════════════╗\n");
+        printf("║                         NO FILES FOUND                            ║\n");
+        printf("╠═══════════════════════════════════════════════════════════════════╣\n");
+        printf("║                                                                   ║\n");
+        printf("║  No employee data files were found in the data directory.         ║\n");
+        printf("║  Save some employee lists first before trying to load them.       ║\n");
+        printf("║                                                                   ║\n");
+        printf("╚═══════════════════════════════════════════════════════════════════╝\n");
+        printf("%s", TXT_RESET);
         printf("Press any key to continue...");
         _getch();
         return -1;
     }
     
+    if (selection == 0) {
+        return 0; // User cancelled
+    }
+    
     // Now get the list name using the beautiful interface
     winTermClearScreen();
     printf("%s", UI_HEADER);
@@ -1118,7 +1435,8 @@ int handleLoadEmployeeList(void) {
     appGetValidatedInput(&field, 1);
     
     // Load the data
-    list* newList = loadListWithName(selectedFileName, "employee", SINGLY);
+    // Loaded lists can be large, so keep them array-backed for fast paging
+    list* newList = loadListWithName(selectedFileName, "employee", DYNAMIC_ARRAY);
     if (!newList) {
         printf("%s❌ Failed to load employee data from file '%s'!%s\n", UI_ERROR, selectedFileName, TXT_RESET);
         printf("%sPlease make sure the file exists and is in the correct format.%s\n", UI_WARNING, TXT_RESET);
@@ -1130,6 +1448,8 @@ int handleLoadEmployeeList(void) {
     // Check if we can add another list
     if (empManager.employeeListCount >= 10) {
         printf("%s⚠️  Maximum number of employee lists reached!%s\n", UI_WARNING, TXT_RESET);
+        detachJournal(newList);
+        untrackDataFile(newList);
         destroyList(&newList, freeEmployee);
         printf("Press any key to continue...");
         _getch();
@@ -1181,6 +1501,7 @@ int handleCreateStudentList(void) {
     stuManager.studentListNames[stuManager.studentListCount][49] = '\0';
     stuManager.activeStudentList = stuManager.studentListCount;
     stuManager.studentListCount++;
+    rebuildStudentRanking(stuManager.activeStudentList);
     
     printf("Student list '%s' created successfully!\n", listName);
     printf("This list is now active. Add students to get started.\n");
@@ -1227,6 +1548,11 @@ int handleAddStudent(void) {
         return -1;
     }
     
+    // Keep the grade ranking in step; rebuild it if the insert fails
+    if (skipListInsert(stuManager.gradeRankings[stuManager.activeStudentList], newStudent) != 0) {
+        rebuildStudentRanking(stuManager.activeStudentList);
+    }
+    
     printf("\nStudent '%s %s' added successfully to list '%s'!\n", 
            newStudent->personal.name.firstName, 
            newStudent->personal.name.lastName,
@@ -1238,6 +1564,50 @@ int handleAddStudent(void) {
     return 0;
 }
 
+int handleImportStudents(void) {
+    winTermClearScreen();
+    printf("=== Import Students from CSV/TSV ===\n\n");
+    
+    if (stuManager.activeStudentList < 0 || !stuManager.studentLists[stuManager.activeStudentList]) {
+        printf("No active student list!\n");
+        printf("Press any key to continue...");
+        _getch();
+        return -1;
+    }
+    
+    char path[260] = "";
+    char reportPath[300];
+    FILE* report = prepareImport("student",
+                                 "number, first name, middle name, last name, gender (M/F), program code, "
+                                 "year level, units, prelim, midterm, final exam",
+                                 path, sizeof(path), reportPath, sizeof(reportPath));
+    
+    CsvImportSummary summary;
+    int result = importStudentsFromCsv(path, stuManager.studentLists[stuManager.activeStudentList], report, &summary);
+    if (summary.importedCount > 0) {
+        rebuildStudentRanking(stuManager.activeStudentList);
+    }
+    showImportSummary(result, &summary, report, reportPath);
+    return result;
+}
+
+int handleExportStudents(void) {
+    winTermClearScreen();
+    printf("=== Export Student List ===\n\n");
+    
+    int hasActiveList = (stuManager.activeStudentList >= 0 && stuManager.studentLists[stuManager.activeStudentList]);
+    if (!checkActiveList(hasActiveList, 0, "No active student list!")) {
+        return -1;
+    }
+    
+    ExportFormat format = promptExportFormat();
+    char path[300];
+    getExportFilePath("student", format, path, sizeof(path));
+    long count = exportStudentList(stuManager.studentLists[stuManager.activeStudentList], format, path);
+    showExportResult(count, "students", path);
+    return (count < 0) ? -1 : 0;
+}
+
 // Student edit, delete, and search functions are implemented in stuio.c
 
 int handleDisplayAllStudents(void) {
@@ -1255,7 +1625,130 @@ int handleDisplayAllStudents(void) {
     return 0;
 }
 
+int handleTopStudents(void) {
+    winTermClearScreen();
+    printf("=== Top Students ===\n\n");
+    
+    int hasActiveList = (stuManager.activeStudentList >= 0 && stuManager.studentLists[stuManager.activeStudentList]);
+    if (!checkActiveList(hasActiveList, 0, "No active student list!")) {
+        return -1;
+    }
+    
+    char countInput[4];
+    char deansInput[3];
+    appFormField fields[] = {
+        { "Number of students to show (1-100): ", countInput, 4, IV_RANGE_INT, {.rangeInt = {.min = 1, .max = 100}} },
+        { "Dean's Listers only? (Y/N): ", deansInput, 3, IV_CHOICES, {.choices = {.choices = (const char*[]){"Y", "N", "y", "n"}, .count = 4}} }
+    };
+    appGetValidatedInput(fields, 2);
+    int k = atoi(countInput);
+    bool deansListOnly = (deansInput[0] == 'Y' || deansInput[0] == 'y');
+    
+    // Bounded heap over the list; the list itself is not reordered
+    Student* topStudents[100];
+    int found = findTopStudents(stuManager.studentLists[stuManager.activeStudentList], k, deansListOnly, topStudents);
+    if (found <= 0) {
+        printf("\n%s\n", deansListOnly ? "No Dean's Listers in this list." : "No students to rank.");
+        waitForKeypress(NULL);
+        return 0;
+    }
+    
+    printf("\n%-4s  %-12s  %-25s  %-8s  %-4s  %11s\n", "Rank", "Student No.", "Full Name", "Course", "Year", "Final Grade");
+    printf("--------------------------------------------------------------------------\n");
+    for (int i = 0; i < found; i++) {
+        const Student* stu = topStudents[i];
+        printf("%-4d  %-12s  %-25.25s  %-8s  %-4d  %11.2f\n", i + 1, stu->personal.studentNumber,
+               stu->personal.name.fullName, stu->personal.programCode, stu->personal.yearLevel, stu->academic.finalGrade);
+    }
+    
+    waitForKeypress(NULL);
+    return 0;
+}
+
+/**
+ * @brief Sorts a saved student file by grade without loading it
+ * 
+ * The file is sorted in place by externalSortStudentFile() within the
+ * sort memory (sort_memory_mb in config.ini): a file that fits is sorted
+ * in one pass, a larger one in sorted runs that are merged on disk.
+ * Changes still in the file's journal are sorted with it. Lists already
+ * loaded from the file keep their order; saving one rewrites the file.
+ * 
+ * @return 0 on success or if the user cancelled, -1 on error
+ */
+static int sortStudentFileByGrade(void) {
+    static const StudentSortSpec gradeOrder[] = { { STUDENT_SORT_FINAL_GRADE, true }, { STUDENT_SORT_NUMBER, false } };
+    
+    char fileName[256] = "";
+    int selection = selectDataFile("student", "Sort Student File by Grade - Select File", fileName, sizeof(fileName));
+    if (selection <= 0) {
+        if (selection < 0) {
+            printf("No student data files were found in the data directory.\n");
+            waitForKeypress(NULL);
+        }
+        return selection;
+    }
+    
+    if (isStudentColumnFile(fileName)) {
+        printf("%s is a columnar file; load it and sort the list instead.\n", fileName);
+        waitForKeypress(NULL);
+        return -1;
+    }
+    
+    char path[300];
+    snprintf(path, sizeof(path), "data/%s", fileName);
+    int64_t fileSize = -1;
+    FILE* file = fopen(path, "rb");
+    if (file) {
+        if (seekDataFile(file, 0, SEEK_END) == 0) {
+            fileSize = tellDataFile(file);
+        }
+        fclose(file);
+    }
+    
+    winTermClearScreen();
+    printf("=== Sort Student File by Grade ===\n\n");
+    size_t memoryLimit = getSortMemoryLimit();
+    char sizeText[16];
+    char limitText[16];
+    formatFileSize(fileSize, sizeText, sizeof(sizeText));
+    formatFileSize((int64_t)memoryLimit, limitText, sizeof(limitText));
+    if (fileSize > (int64_t)memoryLimit) {
+        printf("%s is %s, more than the sort memory of %s.\n", fileName, sizeText, limitText);
+        printf("Sorting on disk in sorted runs that are merged (sort_memory_mb in config.ini)...\n\n");
+    } else {
+        printf("Sorting %s (%s) by final grade (descending order)...\n\n", fileName, sizeText);
+    }
+    
+    int sorted = externalSortStudentFile(fileName, fileName, gradeOrder, 2, memoryLimit);
+    if (sorted >= 0) {
+        printf("%s✅ Sorted %d students in %s.%s\n", UI_SUCCESS, sorted, fileName, TXT_RESET);
+        printf("%sLoad the file to see the sorted list.%s\n", UI_INFO, TXT_RESET);
+    } else {
+        printf("%s❌ Failed to sort %s; the file was not changed.%s\n", UI_ERROR, fileName, TXT_RESET);
+    }
+    waitForKeypress(NULL);
+    return (sorted >= 0) ? 0 : -1;
+}
+
 int handleSortStudentsByGrade(void) {
+    winTermClearScreen();
+    
+    // Saved files are sorted on disk, so a file larger than the sort memory never has to be loaded
+    MenuOption sortOpts[3] = {
+        {'1', "Sort Active List", "Reorder the students of the active list", false, false, 9,0,7,0,8,0,NULL},
+        {'2', "Sort Saved File", "Sort a student file on disk, even one larger than memory", false, false, 9,0,7,0,8,0,NULL},
+        {27,  "Back", "Return without sorting", false, false, 9,0,7,0,8,0,NULL}
+    };
+    Menu sortMenu = {1, "📊 Sort Students by Grade", sortOpts, 3};
+    char sel = runMenuWithInterface(&sortMenu);
+    if (sel == '2') {
+        return sortStudentFileByGrade();
+    }
+    if (sel != '1') {
+        return 0;
+    }
+    
     winTermClearScreen();
     printf("=== Sort Students by Grade ===\n\n");
     
@@ -1274,9 +1767,18 @@ int handleSortStudentsByGrade(void) {
     
     printf("Sorting students by final grade (descending order)...\n\n");
     
-    // Sort the students using the existing sortStudentsByGrade function
-    // The second parameter is set to 1 for descending order
-    if (sortStudentsByGrade(studentList, 1)) {
+    // The grade ranking is kept ordered on every change, so copying its order
+    // is O(n); the full sort is only a fallback when no ranking is available
+    SkipList* ranking = stuManager.gradeRankings[stuManager.activeStudentList];
+    int sorted = (ranking && skipListApplyOrder(ranking, studentList) == 0);
+    if (sorted) {
+        journalListReordered(studentList);
+    }
+    if (!sorted) {
+        printf("Using up to %d sort thread(s) (sort_threads in config.ini)...\n\n", getSortThreads());
+        sorted = sortStudentsByGrade(studentList, 1);
+    }
+    if (sorted) {
         printf("Students sorted successfully!\n");
         printf("\nSorted student list:\n");
         displayAllStudents(studentList);
@@ -1288,7 +1790,73 @@ int handleSortStudentsByGrade(void) {
     return 0;
 }
 
+/**
+ * @brief Shows the grade summary of a saved columnar student file
+ * 
+ * The average grade and pass rate come from summarizeStudentColumnFile(),
+ * which reads only the prelim, midterm and final exam columns, so the
+ * names, remarks and other fields of the file are never loaded. Row
+ * files have no separate grade columns; they can be converted with
+ * Save as Columnar in the save menu.
+ * 
+ * @return 0 on success or if the user cancelled, -1 on error
+ */
+static int showStudentFileGradeSummary(void) {
+    char fileName[256] = "";
+    int selection = selectDataFile("student", "Grade Summary - Select Columnar File", fileName, sizeof(fileName));
+    if (selection <= 0) {
+        if (selection < 0) {
+            printf("No student data files were found in the data directory.\n");
+            waitForKeypress(NULL);
+        }
+        return selection;
+    }
+    
+    winTermClearScreen();
+    printf("=== Grade Summary of %s ===\n\n", fileName);
+    if (!isStudentColumnFile(fileName)) {
+        printf("%s%s is not a columnar file.%s\n", UI_ERROR, fileName, TXT_RESET);
+        printf("%sLoad it and use Save as Columnar to convert it.%s\n", UI_INFO, TXT_RESET);
+        waitForKeypress(NULL);
+        return -1;
+    }
+    
+    StudentGradeSummary summary;
+    if (summarizeStudentColumnFile(fileName, &summary) != 0) {
+        printf("%s❌ Failed to read the grade columns of %s.%s\n", UI_ERROR, fileName, TXT_RESET);
+        waitForKeypress(NULL);
+        return -1;
+    }
+    double passRate = (summary.count > 0) ? 100.0 * summary.passedCount / summary.count : 0.0;
+    printf("Students:           %d\n", summary.count);
+    printf("Average grade:      %.2f\n", summary.averageGrade);
+    printf("Passed:             %d (%.1f%% pass rate, passing grade %.2f)\n", summary.passedCount, passRate,
+           getPassingGrade());
+    printf("Failed:             %d\n", summary.failedCount);
+    printf("Dean's list:        %d\n\n", summary.deansListCount);
+    printf("%sRead from the exam grade columns only.%s\n", UI_INFO, TXT_RESET);
+    waitForKeypress(NULL);
+    return 0;
+}
+
 int handleStudentReport(void) {
+    winTermClearScreen();
+    
+    // A saved columnar file is summarized from its grade columns without loading the students
+    MenuOption reportOpts[3] = {
+        {'1', "Report Active List", "Write the full report of the active list", false, false, 9,0,7,0,8,0,NULL},
+        {'2', "Grade Summary of File", "Average and pass rate from a columnar file's grade columns", false, false, 9,0,7,0,8,0,NULL},
+        {27,  "Back", "Return without a report", false, false, 9,0,7,0,8,0,NULL}
+    };
+    Menu reportMenu = {1, "📊 Student Report", reportOpts, 3};
+    char sel = runMenuWithInterface(&reportMenu);
+    if (sel == '2') {
+        return showStudentFileGradeSummary();
+    }
+    if (sel != '1') {
+        return 0;
+    }
+    
     winTermClearScreen();
     printf("%s", UI_HEADER);
     printf("╔═══════════════════════════════════════════════════════════════════╗\n");
@@ -1316,11 +1884,41 @@ int handleStudentReport(void) {
         return -1;
     }
     
-    printf("%s📊 Generating student report for: %s%s%s\n\n", UI_INFO, UI_HIGHLIGHT, stuManager.studentListNames[stuManager.activeStudentList], TXT_RESET);
+    // Report row orders, most significant field first
+    static const StudentSortSpec numberOrder[] = { { STUDENT_SORT_NUMBER, false } };
+    static const StudentSortSpec gradeOrder[] = { { STUDENT_SORT_FINAL_GRADE, true }, { STUDENT_SORT_NUMBER, false } };
+    static const StudentSortSpec registrarOrder[] = {
+        { STUDENT_SORT_PROGRAM, false },
+        { STUDENT_SORT_YEAR_LEVEL, false },
+        { STUDENT_SORT_FINAL_GRADE, true },
+        { STUDENT_SORT_LAST_NAME, false }
+    };
+    
+    printf("%sReport order:%s\n", UI_INFO, TXT_RESET);
+    printf("  1. List order\n");
+    printf("  2. Student number\n");
+    printf("  3. Final grade (highest first)\n");
+    printf("  4. Registrar (program, year level, grade, last name)\n\n");
+    
+    char orderInput[2];
+    appFormField orderField = { "📋 Select report order (1-4): ", orderInput, 2, IV_RANGE_INT, {.rangeInt = {.min = 1, .max = 4}} };
+    appGetValidatedInput(&orderField, 1);
+    
+    const StudentSortSpec* order = NULL;
+    int orderCount = 0;
+    switch (atoi(orderInput)) {
+        case 2: order = numberOrder; orderCount = 1; break;
+        case 3: order = gradeOrder; orderCount = 2; break;
+        case 4: order = registrarOrder; orderCount = 4; break;
+        default: break;
+    }
+    
+    printf("\n%s📊 Generating student report for: %s%s%s\n\n", UI_INFO, UI_HIGHLIGHT, stuManager.studentListNames[stuManager.activeStudentList], TXT_RESET);
     
     // Generate the student report file
     char reportFilePath[512];
-    int reportResult = generateStudentReportFile(stuManager.studentLists[stuManager.activeStudentList], reportFilePath, sizeof(reportFilePath));
+    int reportResult = generateStudentReportFile(stuManager.studentLists[stuManager.activeStudentList], order, orderCount,
+                                                 reportFilePath, sizeof(reportFilePath));
     
     if (reportResult > 0) {
         printf("%s✅ Successfully generated student report!%s\n", UI_SUCCESS, TXT_RESET);
@@ -1363,23 +1961,34 @@ int handleSaveStudentList(void) {
     }
 
     // Build a simple menu for save options
-    MenuOption saveOpts[2] = {
+    MenuOption saveOpts[3] = {
         {'1', "Enter Filename", "Specify a new filename to save", false, false, 9,0,7,0,8,0,NULL},
+        {'2', "Save as Columnar", "Store each field as a column for fast grade summaries", false, false, 9,0,7,0,8,0,NULL},
         {27,  "Back",          "Return without saving",          false, false, 9,0,7,0,8,0,NULL}
     };
-    Menu saveMenu = {1, "💾 Save Student List", saveOpts, 2};
+    Menu saveMenu = {1, "💾 Save Student List", saveOpts, 3};
     char sel = runMenuWithInterface(&saveMenu);
 
     if (sel == 27) return 0; // user chose Back / Esc
-    if (sel != '1') return 0;
+    if (sel != '1' && sel != '2') return 0;
 
     // User selected to enter a filename
     char filename[100] = "";
     appFormField field = { "Enter filename (will be saved as 'student_LISTNAME.dat'): ", filename, 100, IV_MAX_LEN, {.rangeInt = {.min = 0, .max = 99}} };
     appGetValidatedInput(&field, 1);
 
-    int savedCount = saveListWithCustomName(stuManager.studentLists[stuManager.activeStudentList], filename, "student");
+    // Saving a columnar file again keeps it columnar, so option 1 only chooses rows for new files
+    int savedCount;
+    if (sel == '2') {
+        char columnFileName[256];
+        snprintf(columnFileName, sizeof(columnFileName), "student_%s.dat", filename);
+        savedCount = saveStudentColumnDataFromFile(stuManager.studentLists[stuManager.activeStudentList], columnFileName);
+    } else {
+        savedCount = saveListWithCustomName(stuManager.studentLists[stuManager.activeStudentList], filename, "student");
+    }
     if (savedCount >= 0) {
+        stuManager.studentListModified[stuManager.activeStudentList] = false;
+        discardAutosave(stuManager.studentListNames[stuManager.activeStudentList], "student");
         printf("Successfully saved %d student records!\nData saved to data directory.\n", savedCount);
     } else {
         printf("Failed to save student list.\n");
@@ -1391,11 +2000,11 @@ int handleSaveStudentList(void) {
 int handleLoadStudentList(void) {
     winTermClearScreen();
     
-    // Get available student files
-    char fileNames[20][256]; // Support up to 20 files
-    int fileCount = getStudentDataFileNames(fileNames, 20);
+    // Let the user pick from every saved student file
+    char selectedFileName[256] = "";
+    int selection = selectDataFile("student", "Load Student List - Select File", selectedFileName, sizeof(selectedFileName));
     
-    if (fileCount == 0) {
+    if (selection < 0) {
         printf("%s", UI_HEADER);
         printf("╔═══════════════════════════════════════════════════════════════════╗\n");
         printf("║                         NO FILES FOUND                           ║\n");
@@ -1411,133 +2020,8 @@ int handleLoadStudentList(void) {
         return -1;
     }
     
-    // Ensure minimum menu height for consistent interface
-    const int MIN_MENU_OPTIONS = 10; // Minimum options to match standard interface height
-    int totalMenuOptions = (fileCount + 1 < MIN_MENU_OPTIONS) ? MIN_MENU_OPTIONS : fileCount + 1;
-    
-    // Create dynamic menu options based on available files
-    MenuOption* options = (MenuOption*)malloc(totalMenuOptions * sizeof(MenuOption));
-    if (!options) {
-        printf("Memory allocation failed!\n");
-        printf("Press any key to continue...");
-        _getch();
-        return -1;
-    }
-    
-    // Add file options to menu
-    for (int i = 0; i < fileCount; i++) {
-        options[i].key = '1' + i; // Keys 1, 2, 3, etc.
-        
-        // Create option text from filename (remove .dat extension)
-        char displayName[256];
-        strncpy(displayName, fileNames[i], 255);
-        displayName[255] = '\0';
-        
-        // Remove .dat extension for display
-        char* dotPos = strstr(displayName, ".dat");
-        if (dotPos) {
-            *dotPos = '\0';
-        }
-        
-        // Allocate memory for text and description
-        options[i].text = (char*)malloc(strlen(displayName) + 1);
-        options[i].description = (char*)malloc(strlen(fileNames[i]) + 50);
-        
-        if (options[i].text && options[i].description) {
-            strcpy((char*)options[i].text, displayName);
-            sprintf((char*)options[i].description, "Load student data from %s", fileNames[i]);
-        }
-        
-        options[i].isDisabled = false;
-        options[i].isSelected = false;
-        // Initialize color fields with correct names
-        options[i].highlightTextColor = 9;
-        options[i].highlightBgColor = 0;
-        options[i].textColor = 7;
-        options[i].bgColor = 0;
-        options[i].disabledTextColor = 8;
-        options[i].disabledBgColor = 0;
-        options[i].onSelect = NULL;
-    }
-    
-    // Add placeholder options if needed to maintain consistent height
-    for (int i = fileCount; i < totalMenuOptions - 1; i++) {
-        options[i].key = '\0'; // No key for placeholder
-        options[i].text = (char*)malloc(2);
-        options[i].description = (char*)malloc(30);
-        
-        if (options[i].text && options[i].description) {
-            strcpy((char*)options[i].text, "");
-            strcpy((char*)options[i].description, "");
-        }
-        
-        options[i].isDisabled = true; // Disable placeholder options
-        options[i].isSelected = false;
-        options[i].highlightTextColor = 8;
-        options[i].highlightBgColor = 0;
-        options[i].textColor = 8;
-        options[i].bgColor = 0;
-        options[i].disabledTextColor = 8;
-        options[i].disabledBgColor = 0;
-        options[i].onSelect = NULL;
-    }
-    
-    // Add "Cancel" option (always at the end)
-    int cancelIndex = totalMenuOptions - 1;
-    options[cancelIndex].key = 'C';
-    options[cancelIndex].text = (char*)malloc(20);
-    options[cancelIndex].description = (char*)malloc(50);
-    if (options[cancelIndex].text && options[cancelIndex].description) {
-        strcpy((char*)options[cancelIndex].text, "Cancel");
-        strcpy((char*)options[cancelIndex].description, "Return to Student Management menu");
-    }
-    options[cancelIndex].isDisabled = false;
-    options[cancelIndex].isSelected = false;
-    options[cancelIndex].highlightTextColor = 9;
-    options[cancelIndex].highlightBgColor = 0;
-    options[cancelIndex].textColor = 7;
-    options[cancelIndex].bgColor = 0;
-    options[cancelIndex].disabledTextColor = 8;
-    options[cancelIndex].disabledBgColor = 0;
-    options[cancelIndex].onSelect = NULL;
-    
-    // Create the file selection menu
-    Menu fileMenu = {1, "Load Student List - Select File", options, totalMenuOptions};
-    
-    char choice = runMenuWithInterface(&fileMenu);
-    
-    char selectedFileName[256] = "";
-    int selectedIndex = -1;
-    
-    // Find which file was selected
-    if (choice >= '1' && choice <= '9') {
-        selectedIndex = choice - '1';
-        if (selectedIndex < fileCount) {
-            strcpy(selectedFileName, fileNames[selectedIndex]);
-        }
-    } else if (choice == 'C' || choice == 'c') {
-        // User cancelled
-        // Free allocated memory
-        for (int i = 0; i < totalMenuOptions; i++) {
-            free((char*)options[i].text);
-            free((char*)options[i].description);
-        }
-        free(options);
-        return 0;
-    }
-    
-    // Free allocated memory
-    for (int i = 0; i < totalMenuOptions; i++) {
-        free((char*)options[i].text);
-        free((char*)options[i].description);
-    }
-    free(options);
-    
-    if (selectedFileName[0] == '\0') {
-        printf("Invalid selection!\n");
-        printf("Press any key to continue...");
-        _getch();
-        return -1;
+    if (selection == 0) {
+        return 0; // User cancelled
     }
     
     // Now get the list name using the beautiful interface
@@ -1569,7 +2053,8 @@ int handleLoadStudentList(void) {
     appGetValidatedInput(&field, 1);
     
     // Load the data
-    list* newList = loadListWithName(selectedFileName, "student", SINGLY);
+    // Loaded lists can be large, so keep them array-backed for fast paging
+    list* newList = loadListWithName(selectedFileName, "student", DYNAMIC_ARRAY);
     if (!newList) {
         printf("%s❌ Failed to load student data from file '%s'!%s\n", UI_ERROR, selectedFileName, TXT_RESET);
         printf("%sPlease make sure the file exists and is in the correct format.%s\n", UI_WARNING, TXT_RESET);
@@ -1581,6 +2066,8 @@ int handleLoadStudentList(void) {
     // Check if we can add another list
     if (stuManager.studentListCount >= 10) {
         printf("%s⚠️  Maximum number of student lists reached!%s\n", UI_WARNING, TXT_RESET);
+        detachJournal(newList);
+        untrackDataFile(newList);
         destroyList(&newList, freeStudent);
         printf("Press any key to continue...");
         _getch();
@@ -1593,6 +2080,7 @@ int handleLoadStudentList(void) {
     stuManager.studentListNames[stuManager.studentListCount][49] = '\0';
     stuManager.activeStudentList = stuManager.studentListCount;
     stuManager.studentListCount++;
+    rebuildStudentRanking(stuManager.activeStudentList);
     
     printf("%s✅ Student list '%s' loaded successfully!%s\n", UI_SUCCESS, listName, TXT_RESET);
     printf("%s📊 Loaded %d student records from %s.%s\n", UI_INFO, newList->size, selectedFileName, TXT_RESET);
@@ -1602,6 +2090,213 @@ int handleLoadStudentList(void) {
     return 0;
 }
 
+/**
+ * @brief Checks that the lists of a session fit into the managers
+ * @param files Files of the session
+ * @param count Number of files
+ * @param employeeFiles Receives the number of employee files
+ * @param studentFiles Receives the number of student files
+ * @return true if the managers have room for every list
+ */
+static bool sessionFitsManagers(const SessionFile* files, int count, int* employeeFiles, int* studentFiles) {
+    *employeeFiles = 0;
+    *studentFiles = 0;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(files[i].dataType, "employee") == 0) {
+            (*employeeFiles)++;
+        } else {
+            (*studentFiles)++;
+        }
+    }
+    return empManager.employeeListCount + *employeeFiles <= 10 &&
+           stuManager.studentListCount + *studentFiles <= 10;
+}
+
+/**
+ * @brief Adds the lists of a loaded session to the managers in one step
+ * 
+ * The first list of each type becomes active if no list of that type was.
+ * 
+ * @param files Files of the session, all loaded
+ * @param count Number of files
+ */
+static void addSessionLists(SessionFile* files, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(files[i].dataType, "employee") == 0) {
+            int index = empManager.employeeListCount++;
+            empManager.employeeLists[index] = files[i].dataList;
+            snprintf(empManager.employeeListNames[index], sizeof(empManager.employeeListNames[index]), "%s", files[i].listName);
+            empManager.employeeListModified[index] = false;
+            if (empManager.activeEmployeeList < 0) {
+                empManager.activeEmployeeList = index;
+            }
+        } else {
+            int index = stuManager.studentListCount++;
+            stuManager.studentLists[index] = files[i].dataList;
+            snprintf(stuManager.studentListNames[index], sizeof(stuManager.studentListNames[index]), "%s", files[i].listName);
+            stuManager.studentListModified[index] = false;
+            stuManager.gradeRankings[index] = files[i].ranking;
+            if (!files[i].ranking) {
+                rebuildStudentRanking(index);
+            }
+            if (stuManager.activeStudentList < 0) {
+                stuManager.activeStudentList = index;
+            }
+        }
+        files[i].dataList = NULL;
+        files[i].ranking = NULL;
+    }
+}
+
+int handleLoadSession(void) {
+    winTermClearScreen();
+    printf("%s=== Load Session ===%s\n\n", UI_HEADER, TXT_RESET);
+    
+    SessionFile* files = NULL;
+    int fileCount = getSessionFiles(&files);
+    if (fileCount <= 0) {
+        printf("%sNo saved employee or student lists were found in the data directory.%s\n", UI_WARNING, TXT_RESET);
+        printf("Press any key to continue...");
+        _getch();
+        return -1;
+    }
+    
+    printf("%s%4s  %-36s %-9s %10s  %s%s\n", TXT_BOLD, "#", "File", "Type", "Size", "List name", TXT_RESET);
+    for (int i = 0; i < fileCount; i++) {
+        char sizeText[16];
+        formatFileSize(files[i].size, sizeText, sizeof(sizeText));
+        printf("%4d  %-36.36s %-9s %10s  %s\n", i + 1, files[i].fileName, files[i].dataType, sizeText, files[i].listName);
+    }
+    printf("\nThe files are loaded at the same time on up to %d threads.\n", getLoadThreads());
+    printf("Enter file numbers separated by spaces, A for all, or C to cancel: ");
+    
+    char input[512];
+    if (!fgets(input, sizeof(input), stdin) || input[0] == 'C' || input[0] == 'c') {
+        free(files);
+        return 0;
+    }
+    if (!strchr(input, '\n')) {
+        int c;
+        while ((c = getchar()) != '\n' && c != EOF) {
+            // Drop the rest of an overlong line
+        }
+    }
+    
+    // Move the chosen files to the front, in the order of the table
+    int selectedCount = fileCount;
+    if (input[0] != 'A' && input[0] != 'a') {
+        bool* chosen = (bool*)calloc((size_t)fileCount, sizeof(bool));
+        if (!chosen) {
+            free(files);
+            return -1;
+        }
+        for (char* token = strtok(input, " ,\t\n"); token; token = strtok(NULL, " ,\t\n")) {
+            int number = atoi(token);
+            if (number >= 1 && number <= fileCount) {
+                chosen[number - 1] = true;
+            }
+        }
+        selectedCount = 0;
+        for (int i = 0; i < fileCount; i++) {
+            if (chosen[i]) {
+                if (selectedCount != i) {
+                    files[selectedCount] = files[i];
+                }
+                selectedCount++;
+            }
+        }
+        free(chosen);
+    }
+    if (selectedCount == 0) {
+        free(files);
+        return 0;
+    }
+    
+    int employeeFiles;
+    int studentFiles;
+    if (!sessionFitsManagers(files, selectedCount, &employeeFiles, &studentFiles)) {
+        printf("\n%s⚠️  The session has %d employee and %d student lists, but only %d and %d more fit (10 of each).%s\n",
+               UI_WARNING, employeeFiles, studentFiles, 10 - empManager.employeeListCount,
+               10 - stuManager.studentListCount, TXT_RESET);
+        printf("Press any key to continue...");
+        _getch();
+        free(files);
+        return -1;
+    }
+    
+    printf("\nLoading %d file(s)...\n", selectedCount);
+    double seconds = 0.0;
+    if (loadSession(files, selectedCount, &seconds) < 0) {
+        printf("\n%s❌ The session was not loaded; no lists were added.%s\n", UI_ERROR, TXT_RESET);
+        for (int i = 0; i < selectedCount; i++) {
+            if (files[i].failed) {
+                printf("%s   Could not load '%s' (missing, damaged or in the wrong format).%s\n", UI_ERROR, files[i].fileName, TXT_RESET);
+            }
+        }
+        printf("Press any key to continue...");
+        _getch();
+        free(files);
+        return -1;
+    }
+    
+    double fileSeconds = 0.0;
+    printf("\n%s%-24s %-9s %10s %10s%s\n", TXT_BOLD, "List", "Type", "Records", "Time", TXT_RESET);
+    for (int i = 0; i < selectedCount; i++) {
+        printf("%-24.24s %-9s %10d %7.0f ms\n", files[i].listName, files[i].dataType, files[i].dataList->size,
+               files[i].seconds * 1000.0);
+        fileSeconds += files[i].seconds;
+    }
+    addSessionLists(files, selectedCount);
+    free(files);
+    
+    printf("\n%s✅ Loaded %d list(s) in %.0f ms (%.0f ms one after another).%s\n", UI_SUCCESS, selectedCount,
+           seconds * 1000.0, fileSeconds * 1000.0, TXT_RESET);
+    printf("Press any key to continue...");
+    _getch();
+    return 0;
+}
+
+int loadStartupSession(void) {
+    SessionFile* files = NULL;
+    int fileCount = getSessionFiles(&files);
+    if (fileCount <= 0) {
+        return 0;
+    }
+    
+    // Keep the first lists of each type that fit, in name order
+    int employeeSlots = 10 - empManager.employeeListCount;
+    int studentSlots = 10 - stuManager.studentListCount;
+    int selectedCount = 0;
+    for (int i = 0; i < fileCount; i++) {
+        int* slots = (strcmp(files[i].dataType, "employee") == 0) ? &employeeSlots : &studentSlots;
+        if (*slots > 0) {
+            (*slots)--;
+            if (selectedCount != i) {
+                files[selectedCount] = files[i];
+            }
+            selectedCount++;
+        }
+    }
+    if (selectedCount < fileCount) {
+        printf("Startup session: %d list(s) skipped, only 10 of each type can be open.\n", fileCount - selectedCount);
+    }
+    
+    double seconds = 0.0;
+    if (loadSession(files, selectedCount, &seconds) < 0) {
+        for (int i = 0; i < selectedCount; i++) {
+            if (files[i].failed) {
+                printf("Startup session: could not load '%s'; no lists were loaded.\n", files[i].fileName);
+            }
+        }
+        free(files);
+        return -1;
+    }
+    addSessionLists(files, selectedCount);
+    free(files);
+    printf("Startup session: loaded %d list(s) in %.0f ms.\n", selectedCount, seconds * 1000.0);
+    return selectedCount;
+}
+
 int handleSwitchEmployeeList(void) {
     // Ensure there are multiple lists
     if (empManager.employeeListCount == 0) {
@@ -2009,11 +2704,12 @@ int handleAddEmployeeMenu(void) {
         return -1;
     }
 
-    // Base options (4 functional)
+    // Base options (5 functional)
     MenuOption baseOpts[] = {
         {'1', "Add an Employee", "Add a single employee to the active list", false, false, 9,0,7,0,8,0,NULL},
         {'2', "Add 5 Employees", "Add five employees in succession", false, false, 9,0,7,0,8,0,NULL},
         {'3', "Add N Employees", "Specify a custom number of employees to add", false, false, 9,0,7,0,8,0,NULL},
+        {'4', "Import from CSV/TSV File", "Append every valid row of a text file", false, false, 9,0,7,0,8,0,NULL},
         {'B', "Back", "Return to Employee Management menu", false, false, 9,0,7,0,8,0,NULL}
     };
 
@@ -2068,6 +2764,9 @@ int handleAddEmployeeMenu(void) {
                 }
                 break;
             }
+            case '4':
+                handleImportEmployees();
+                break;
             case 'B':
             case 'b':
                 free(options);
@@ -2089,6 +2788,7 @@ int handleAddStudentMenu(void) {
         {'1', "Add a Student", "Add a single student to the active list", false, false, 9,0,7,0,8,0,NULL},
         {'2', "Add 10 Students", "Add ten students in succession", false, false, 9,0,7,0,8,0,NULL},
         {'3', "Add N Students", "Specify a custom number of students to add", false, false, 9,0,7,0,8,0,NULL},
+        {'4', "Import from CSV/TSV File", "Append every valid row of a text file", false, false, 9,0,7,0,8,0,NULL},
         {'B', "Back", "Return to Student Management menu", false, false, 9,0,7,0,8,0,NULL}
     };
     const int MIN_MENU_OPTIONS = 5;
@@ -2129,6 +2829,9 @@ int handleAddStudentMenu(void) {
                 }
                 break;
             }
+            case '4':
+                handleImportStudents();
+                break;
             case 'B':
             case 'b':
                 free(options);
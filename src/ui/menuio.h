@@ -6,6 +6,7 @@
 #include "../../include/headers/interface.h"
 #include "../../include/models/employee.h"
 #include "../../include/models/student.h"
+#include "../modules/export.h"
 
 // Main coordination functions
 void initMultiListManager(void);
@@ -14,6 +15,10 @@ int menuLoop(void);
 void checkStates(void);
 void displaySystemInformation(void);
 
+// Load sessions (several lists loaded at once)
+int handleLoadSession(void);
+int loadStartupSession(void);
+
 // Configuration management functions
 int runConfigurationManagement(void);
 int handleUpdatePayrollSettings(void);
@@ -26,8 +31,11 @@ int runEmployeeManagement(void);
 int handleCreateEmployeeList(void);
 int handleSwitchEmployeeList(void);
 int handleAddEmployee(void);
+int handleImportEmployees(void);
 int handleDisplayAllEmployees(void);
 int handlePayrollReport(void);
+int handleTopEarners(void);
+int handleExportEmployees(void);
 int handleSaveEmployeeList(void);
 int handleLoadEmployeeList(void);
 
@@ -36,12 +44,19 @@ int runStudentManagement(void);
 int handleCreateStudentList(void);
 int handleSwitchStudentList(void);
 int handleAddStudent(void);
+int handleImportStudents(void);
 int handleDisplayAllStudents(void);
 int handleSortStudentsByGrade(void);
+int handleTopStudents(void);
+int handleExportStudents(void);
 int handleStudentReport(void);
 int handleSaveStudentList(void);
 int handleLoadStudentList(void);
 
+// Export helpers (shared with courseio.c)
+ExportFormat promptExportFormat(void);
+void showExportResult(long count, const char* recordName, const char* path);
+
 // Course management function (implemented in courseio.c)
 int runCourseManagement(void);
 
@@ -6,6 +6,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include "stuio.h"
+#include "../modules/data.h"
+#include "../modules/manifest.h"
 #include "../../include/headers/apctxt.h"
 #include "../../include/headers/apclrs.h"
 #include "../../include/headers/interface.h"
@@ -366,12 +368,46 @@ int getStudentNumberFromUser(char* buffer, int bufferSize) {
     return 0;
 }
 
+/**
+ * @brief Looks up a student number in the saved student files without loading them.
+ * @param stuNumber The student number.
+ * @return Returns 1 if the student was found and displayed, 0 otherwise.
+ */
+static int searchSavedStudentFiles(const char* stuNumber) {
+    ManifestEntry* files = NULL;
+    int fileCount = getDataFileManifest("student", &files);
+    int unsearched = 0;
+    
+    for (int i = 0; i < fileCount; i++) {
+        const char* fileName = files[i].name;
+        if (strstr(fileName, "_autosave") != NULL) {
+            continue; // Autosaves repeat the records of a list's own file
+        }
+        Student stu;
+        int result = lookupRecordInFile(fileName, "student", stuNumber, &stu);
+        if (result == 1) {
+            printf("\n=== Student Found in Saved File '%s' ===\n", fileName);
+            displayStudentDetails(&stu);
+            free(files);
+            return 1;
+        }
+        if (result < 0) {
+            unsearched++;
+        }
+    }
+    if (unsearched > 0) {
+        printf("\n%d saved file(s) could not be searched without loading them.\n", unsearched);
+    }
+    free(files);
+    return 0;
+}
+
 /**
  * @brief Prompts the user to search for a student and displays results.
  * @param studentList Pointer to the student list.
  * @return Returns 0 on success, -1 on failure or cancel.
  */
-int handleSearchStudent(const list* studentList) {
+int handleSearchStudent(list* studentList) {
     winTermClearScreen();
     
     Menu searchMenu = {1, "Search Student", (MenuOption[]){
@@ -392,7 +428,7 @@ int handleSearchStudent(const list* studentList) {
                 if (stu) {
                     printf("\n=== Student Found ===\n");
                     displayStudentDetails(stu);
-                } else {
+                } else if (!searchSavedStudentFiles(stuNumber)) {
                     printf("\nStudent with number '%s' not found.\n", stuNumber);
                 }
             }
@@ -478,7 +514,13 @@ int handleEditStudent(list* studentList) {
         // Recalculate final grade with new data
         calculateFinalGrade(&newData);
         
-        if (updateStudentData(existingStu, &newData) == 0) {
+        // The grade may change, so take the student out of the ranking while updating
+        SkipList* ranking = getStudentRanking(studentList);
+        skipListRemove(ranking, existingStu);
+        int updated = editStudentInList(studentList, existingStu->personal.studentNumber, &newData);
+        skipListInsert(ranking, existingStu);
+        
+        if (updated == 0) {
             winTermClearScreen();
             printf("=== Student Update Successful ===\n\n");
             printf("✅ Student '%s' has been updated successfully!\n\n", stuNumber);
@@ -544,6 +586,8 @@ int handleDeleteStudent(list* studentList) {
             printf("\n⚠️  WARNING: This action cannot be undone!\n");
             if (appYesNoPrompt("Are you sure you want to delete this student?")) {
                 printf("\nDeleting student...\n");
+                SkipList* ranking = getStudentRanking(studentList);
+                skipListRemove(ranking, stu);
                 if (removeStudentFromList(studentList, stuNumber) == 0) {
                     printf("✅ Student '%s' deleted successfully!\n", stuNumber);
                     printf("Student count is now: %d\n", studentList->size);
@@ -10,7 +10,7 @@ int getStudentNumberFromUser(char* buffer, const int bufferSize);
 int editStudentDataFromUser(Student* student);
 
 // Student operations
-int handleSearchStudent(const list* studentList);
+int handleSearchStudent(list* studentList);
 int handleEditStudent(list* studentList);
 int handleDeleteStudent(list* studentList);
 